@@ -0,0 +1,60 @@
+#!/bin/bash
+# Shell script to check that 2 runs of the same game give the same state for OpenDungeons.
+# A server is launched twice on the same level with the same random seed and writes the state
+# hash of each turn in a trace file. Each game is driven by the given boost test client. The
+# traces are then compared for the turns both runs reached.
+# With these options, every server turn advances the game by the same time. However, the commands
+# sent by the clients are applied on the turn they are received, which depends on the network timing.
+# So only games where the clients send no game command can be checked (the game is played by the
+# AI players only, like in aa-LaunchGame where the human player stays idle).
+
+OD_BINARY="opendungeons"
+TEST_BASENAME="boosttest-source_tests-"
+TEST_NAME=${1:-"aa-LaunchGame"}
+SEED=${2:-42}
+TRACE_DIR="$(pwd)/determinism"
+
+if [ ! -x $(pwd)/${OD_BINARY} ]; then
+    echo "Can't find the ${OD_BINARY} binary in the current directory, aborting."
+    exit 1
+fi
+
+if [ ! -x $(pwd)/${TEST_BASENAME}${TEST_NAME} ]; then
+    echo "Can't find the ${TEST_BASENAME}${TEST_NAME} test in the current directory, aborting."
+    exit 1
+fi
+
+level=$(echo ${TEST_NAME} |cut -d'-' -f1)
+mkdir -p "${TRACE_DIR}"
+
+for run in 1 2; do
+    echo -e "\n### Run ${run}: map ${level}.level, seed ${SEED}\n"
+    rm -f "${TRACE_DIR}/trace${run}.txt"
+    ./${OD_BINARY} --server "${level}.level" --port 32222 --log srvLog${run}.txt \
+        --appData "${TRACE_DIR}" --seed ${SEED} --statehashtrace trace${run}.txt &
+    pid=$!
+
+    ./${TEST_BASENAME}${TEST_NAME}
+
+    kill $pid
+    wait $pid  # Wait for the process to terminate
+done
+
+nb1=$(wc -l < "${TRACE_DIR}/trace1.txt")
+nb2=$(wc -l < "${TRACE_DIR}/trace2.txt")
+nb=$(( nb1 < nb2 ? nb1 : nb2 ))
+if [ ${nb} -eq 0 ]; then
+    echo "No turn was traced, aborting."
+    exit 1
+fi
+
+echo -e "\n#####################################"
+if diff <(head -n ${nb} "${TRACE_DIR}/trace1.txt") <(head -n ${nb} "${TRACE_DIR}/trace2.txt"); then
+    echo "The ${nb} traced turns are identical"
+    echo -e "#####################################\n"
+    exit 0
+fi
+
+echo "The runs diverged (see the first line above)"
+echo -e "#####################################\n"
+exit 2
@@ -83,7 +83,10 @@ void ODApplication::startServer()
 
     OD_LOG_INF("Initializing");
 
-    Random::initialize();
+    if(resMgr.getRandomSeed() >= 0)
+        Random::initialize(static_cast<unsigned long>(resMgr.getRandomSeed()));
+    else
+        Random::initialize();
     ConfigManager configManager(resMgr.getConfigPath(), "", resMgr.getSoundPath());
     OD_LOG_INF("Launching server");
 
@@ -19,14 +19,28 @@
 
 #include "ai/AIFactory.h"
 #include "ai/BaseAI.h"
+#include "utils/ConfigManager.h"
+#include "utils/Helper.h"
+#include "utils/LogManager.h"
+
+#include <algorithm>
+
+//! \brief Priority a task gains for each turn it has been deferred. It ensures low priority
+//! tasks are run eventually even when the budget is always spent
+const int32_t PRIORITY_PER_DEFERRED_TURN = 10;
 
 AIManager::AIManager(GameMap& gameMap)
-    : mGameMap(gameMap)
+    : mGameMap(gameMap),
+      mWorkersTurn(0),
+      mNbWorkersRunning(0),
+      mStopWorkers(false),
+      mNextAi(0)
 {
 }
 
 AIManager::~AIManager()
 {
+    stopWorkers();
     clearAIList();
 }
 
@@ -42,13 +56,148 @@ bool AIManager::assignAI(Player& player, KeeperAIType type)
 
 bool AIManager::doTurn(double timeSinceLastTurn)
 {
+    mDueTasks.clear();
     for(BaseAI* ai : mAiList)
     {
-        ai->doTurn(timeSinceLastTurn);
+        if(!ai->prepareTurn(timeSinceLastTurn))
+            continue;
+
+        for(AITask& task : ai->getTasks())
+        {
+            if(task.isDue())
+                mDueTasks.push_back(&task);
+        }
+    }
+
+    scheduleTasks();
+
+    // The AIs only read the game state while they are evaluated so they can be evaluated in parallel.
+    // The actions they decide are queued and applied afterwards in the AI list order so that the result
+    // does not depend on the evaluation order
+    uint32_t nbThreads = std::thread::hardware_concurrency();
+    if(nbThreads > mAiList.size())
+        nbThreads = static_cast<uint32_t>(mAiList.size());
+
+    if(nbThreads <= 1)
+    {
+        for(BaseAI* ai : mAiList)
+            ai->evaluateTurn();
+    }
+    else
+    {
+        // This thread evaluates AIs too. The workers are only created the first time they are needed
+        // (or when AIs are added) and are kept for the next turns
+        {
+            std::lock_guard<std::mutex> lock(mWorkersMutex);
+            while(mWorkers.size() + 1 < nbThreads)
+                mWorkers.emplace_back(&AIManager::workerThread, this, mWorkersTurn);
+
+            mNextAi = 0;
+            mNbWorkersRunning = static_cast<uint32_t>(mWorkers.size());
+            ++mWorkersTurn;
+        }
+        mWorkersWakeUp.notify_all();
+
+        evaluateAIs();
+
+        std::unique_lock<std::mutex> lock(mWorkersMutex);
+        mWorkersDone.wait(lock, [this]() { return mNbWorkersRunning == 0; });
     }
+
+    for(AITask* task : mScheduledTasks)
+    {
+        AITaskStats& stats = mTaskStats[task->getName()];
+        ++stats.mNbRuns;
+        stats.mTotalTime += task->getLastTime();
+        if(task->getLastTime() > stats.mMaxTime)
+            stats.mMaxTime = task->getLastTime();
+    }
+
+    for(BaseAI* ai : mAiList)
+        ai->applyCommands();
+
     return true;
 }
 
+void AIManager::evaluateAIs()
+{
+    uint32_t index;
+    while((index = mNextAi++) < mAiList.size())
+        mAiList[index]->evaluateTurn();
+}
+
+void AIManager::workerThread(uint64_t startTurn)
+{
+    uint64_t turn = startTurn;
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mWorkersMutex);
+            mWorkersWakeUp.wait(lock, [this, turn]() { return mStopWorkers || (mWorkersTurn != turn); });
+            if(mStopWorkers)
+                return;
+
+            turn = mWorkersTurn;
+        }
+
+        evaluateAIs();
+
+        {
+            std::lock_guard<std::mutex> lock(mWorkersMutex);
+            --mNbWorkersRunning;
+        }
+        mWorkersDone.notify_one();
+    }
+}
+
+void AIManager::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mWorkersMutex);
+        mStopWorkers = true;
+    }
+    mWorkersWakeUp.notify_all();
+
+    for(std::thread& worker : mWorkers)
+        worker.join();
+
+    mWorkers.clear();
+}
+
+void AIManager::scheduleTasks()
+{
+    // Tasks deferred for a long time get a higher priority so that they are not starved. The sort
+    // is stable to keep the AI list order between tasks with the same priority
+    std::stable_sort(mDueTasks.begin(), mDueTasks.end(), [](const AITask* a, const AITask* b)
+    {
+        int32_t priorityA = a->getPriority() + static_cast<int32_t>(a->getTurnsDeferred()) * PRIORITY_PER_DEFERRED_TURN;
+        int32_t priorityB = b->getPriority() + static_cast<int32_t>(b->getTurnsDeferred()) * PRIORITY_PER_DEFERRED_TURN;
+        return priorityA > priorityB;
+    });
+
+    // A budget of 0 means no limit
+    uint64_t budget = ConfigManager::getSingleton().getAITurnBudget();
+    uint64_t spent = 0;
+    mScheduledTasks.clear();
+    for(AITask* task : mDueTasks)
+    {
+        // We always run at least one task so that a task costlier than the whole budget
+        // can still be run
+        if((budget > 0) &&
+           !mScheduledTasks.empty() &&
+           (spent + task->getCost() > budget))
+        {
+            ++task->mTurnsDeferred;
+            ++mTaskStats[task->getName()].mNbDeferred;
+            continue;
+        }
+
+        task->mIsScheduled = true;
+        spent += task->getCost();
+        mScheduledTasks.push_back(task);
+    }
+}
+
 void AIManager::clearAIList()
 {
     for(BaseAI* ai : mAiList)
@@ -56,4 +205,24 @@ void AIManager::clearAIList()
         delete ai;
     }
     mAiList.clear();
+    mDueTasks.clear();
+    mScheduledTasks.clear();
+    mTaskStats.clear();
+}
+
+void AIManager::logTaskStats() const
+{
+    OD_LOG_INF("AI tasks stats (times in microseconds), turn budget="
+        + Helper::toString(ConfigManager::getSingleton().getAITurnBudget()));
+    for(const std::pair<const std::string, AITaskStats>& p : mTaskStats)
+    {
+        const AITaskStats& stats = p.second;
+        uint64_t average = (stats.mNbRuns > 0) ? stats.mTotalTime / stats.mNbRuns : 0;
+        OD_LOG_INF("task=" + p.first
+            + ", runs=" + Helper::toString(stats.mNbRuns)
+            + ", deferred=" + Helper::toString(stats.mNbDeferred)
+            + ", total=" + Helper::toString(stats.mTotalTime)
+            + ", average=" + Helper::toString(average)
+            + ", max=" + Helper::toString(stats.mMaxTime));
+    }
 }
@@ -18,6 +18,15 @@
 #ifndef AIMANAGER_H
 #define AIMANAGER_H
 
+#include "ai/AITask.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 class BaseAI;
@@ -36,12 +45,50 @@ public:
     virtual ~AIManager();
 
     bool assignAI(Player& player, KeeperAIType type);
+
+    //! \brief Schedules the due tasks of every AI within the turn budget (see ConfigManager::getAITurnBudget),
+    //! runs them and applies the resulting actions
     bool doTurn(double timeSinceLastTurn);
     void clearAIList();
 
+    //! \brief Logs the timing statistics of the AI tasks since the AIs were assigned
+    void logTaskStats() const;
+
 private:
     GameMap& mGameMap;
     AIList mAiList;
+
+    //! \brief Due tasks and tasks scheduled this turn. Kept as members to avoid reallocating them each turn
+    std::vector<AITask*> mDueTasks;
+    std::vector<AITask*> mScheduledTasks;
+
+    std::map<std::string, AITaskStats> mTaskStats;
+
+    //! \brief Threads evaluating the AIs with the server thread. They are created once and wait
+    //! for the next turn between 2 evaluations
+    std::vector<std::thread> mWorkers;
+    std::mutex mWorkersMutex;
+    std::condition_variable mWorkersWakeUp;
+    std::condition_variable mWorkersDone;
+    //! \brief Incremented each time the workers are woken up to evaluate a turn
+    uint64_t mWorkersTurn;
+    uint32_t mNbWorkersRunning;
+    bool mStopWorkers;
+    //! \brief Index of the next AI to evaluate in mAiList
+    std::atomic<uint32_t> mNextAi;
+
+    //! \brief Chooses the tasks to run this turn from mDueTasks
+    void scheduleTasks();
+
+    //! \brief Evaluates the AIs until every one has been taken by a thread
+    void evaluateAIs();
+
+    //! \brief Worker loop. startTurn is the value of mWorkersTurn when the worker was created: the worker
+    //! waits for the next turn so that it does not evaluate a turn the other workers already started
+    void workerThread(uint64_t startTurn);
+
+    //! \brief Stops and joins the worker threads
+    void stopWorkers();
 };
 
 #endif // AIMANAGER_H
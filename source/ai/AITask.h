@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef AITASK_H
+#define AITASK_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+//! \brief Timing statistics of an AI task. They are aggregated by task name over every AI by
+//! the AIManager
+struct AITaskStats
+{
+    AITaskStats() :
+        mNbRuns(0),
+        mNbDeferred(0),
+        mTotalTime(0),
+        mMaxTime(0)
+    {}
+
+    //! \brief Number of times the task has been run
+    uint64_t mNbRuns;
+    //! \brief Number of times the task was due but has been deferred because the turn budget was spent
+    uint64_t mNbDeferred;
+    //! \brief Time spent running the task (in microseconds)
+    uint64_t mTotalTime;
+    //! \brief Longest run (in microseconds)
+    uint32_t mMaxTime;
+};
+
+//! \brief Work an AI does periodically (looking for gold, building rooms, ...). Every turn, the AIManager
+//! picks the due tasks of every AI by priority and runs them as long as their cost fits in the
+//! turn budget. The others are deferred to the next turns.
+//! The cost is a fixed value given by the task and not a measured time so that the tasks run on a
+//! given turn do not depend on the machine load (2 runs of the same game should behave the same way).
+class AITask
+{
+public:
+    //! \brief priority: Tasks with the highest priority are run first
+    //! cost: Cost units counted against the turn budget (roughly the running time in microseconds)
+    //! periodMin/periodMax: Number of turns the task waits after being run (randomly picked between both)
+    AITask(const std::string& name, int32_t priority, uint32_t cost,
+            int32_t periodMin, int32_t periodMax, std::function<void()>&& function) :
+        mName(name),
+        mPriority(priority),
+        mCost(cost),
+        mPeriodMin(periodMin),
+        mPeriodMax(periodMax),
+        mFunction(std::move(function)),
+        mTurnsBeforeRun(0),
+        mTurnsDeferred(0),
+        mIsScheduled(false),
+        mLastTime(0)
+    {}
+
+    inline const std::string& getName() const
+    { return mName; }
+
+    inline int32_t getPriority() const
+    { return mPriority; }
+
+    inline uint32_t getCost() const
+    { return mCost; }
+
+    inline bool isDue() const
+    { return mTurnsBeforeRun <= 0; }
+
+    inline uint32_t getTurnsDeferred() const
+    { return mTurnsDeferred; }
+
+    inline bool isScheduled() const
+    { return mIsScheduled; }
+
+    //! \brief Time taken by the last run (in microseconds)
+    inline uint32_t getLastTime() const
+    { return mLastTime; }
+
+private:
+    friend class AIManager;
+    friend class BaseAI;
+
+    std::string mName;
+    int32_t mPriority;
+    uint32_t mCost;
+    int32_t mPeriodMin;
+    int32_t mPeriodMax;
+    std::function<void()> mFunction;
+
+    //! \brief Turns to wait before the task is due again
+    int32_t mTurnsBeforeRun;
+    //! \brief Number of consecutive turns the task has been deferred while being due
+    uint32_t mTurnsDeferred;
+    //! \brief Set by the AIManager if the task should be run this turn
+    bool mIsScheduled;
+    uint32_t mLastTime;
+};
+
+#endif // AITASK_H
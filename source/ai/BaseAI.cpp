@@ -23,82 +23,175 @@
 #include "entities/Tile.h"
 
 #include "game/Player.h"
+#include "game/RoomPlacementMap.h"
+#include "game/Seat.h"
 
 #include "gamemap/GameMap.h"
 
 #include "network/ODServer.h"
 
 #include "rooms/Room.h"
+#include "rooms/RoomManager.h"
 #include "rooms/RoomType.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
+#include "utils/Random.h"
+
+#include <algorithm>
+#include <chrono>
 
 const int32_t pointsPerWallSpot = 50;
 const int32_t handicapPerTileOffset = 20;
 
 BaseAI::BaseAI(GameMap& gameMap, Player& player):
     mGameMap(gameMap),
-    mPlayer(player)
+    mPlayer(player),
+    mGoldSpent(0),
+    mRandomGenerator((Random::Uint(0, 0x7FFF) << 15) | Random::Uint(0, 0x7FFF))
 {
 }
 
-Room* BaseAI::getDungeonTemple()
+bool BaseAI::prepareTurn(double timeSinceLastTurn)
 {
-    std::vector<Room*> dt = mGameMap.getRoomsByTypeAndSeat(RoomType::dungeonTemple, mPlayer.getSeat());
-    if(!dt.empty())
-        return dt.front();
-    else
-        return nullptr;
+    mCommands.clear();
+    mGoldSpent = 0;
+    for(AITask& task : mTasks)
+    {
+        if(task.mTurnsBeforeRun > 0)
+            --task.mTurnsBeforeRun;
+    }
+
+    return doTurn(timeSinceLastTurn);
+}
+
+void BaseAI::evaluateTurn()
+{
+    for(AITask& task : mTasks)
+    {
+        if(!task.mIsScheduled)
+            continue;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        task.mFunction();
+        std::chrono::steady_clock::duration duration = std::chrono::steady_clock::now() - start;
+
+        // The measured time is only used for statistics. Scheduling uses the fixed task cost
+        task.mLastTime = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+        task.mTurnsBeforeRun = randomInt(task.mPeriodMin, task.mPeriodMax);
+        task.mTurnsDeferred = 0;
+        task.mIsScheduled = false;
+    }
+}
+
+void BaseAI::applyCommands()
+{
+    for(std::function<void()>& command : mCommands)
+        command();
+
+    mCommands.clear();
 }
 
-bool BaseAI::shouldGroundTileBeConsideredForBestPlaceForRoom(Tile* tile, Seat* mPlayerSeat)
+void BaseAI::addTask(const std::string& name, int32_t priority, uint32_t cost,
+        int32_t periodMin, int32_t periodMax, std::function<void()>&& function)
 {
-    switch(tile->getType())
+    mTasks.emplace_back(name, priority, cost, periodMin, periodMax, std::move(function));
+}
+
+void BaseAI::queueCommand(std::function<void()>&& command)
+{
+    mCommands.push_back(std::move(command));
+}
+
+bool BaseAI::queueBuildRoom(RoomType roomType, const std::vector<Tile*>& tiles)
+{
+    if(tiles.empty())
+        return false;
+
+    int pricePerTile = RoomManager::costPerTile(roomType);
+    int price = static_cast<int>(tiles.size()) * pricePerTile;
+    // First treasury tile is free
+    if((roomType == RoomType::treasury) && (mPlayer.getSeat()->getNbRooms(RoomType::treasury) <= 0))
+        price -= pricePerTile;
+
+    if(price > getAvailableGold())
+        return false;
+
+    spendGold(price);
+    queueCommand([this, roomType, tiles]()
     {
-        case TileType::dirt:
-        case TileType::gold:
+        if(!RoomManager::buildRoomOnTiles(&mGameMap, roomType, &mPlayer, tiles))
         {
-            // Dirt and gold can always be built (even if digging may be needed depending on fullness)
-            if(!tile->isClaimed())
-                return true;
-
-            // We check if we can build on that tile and if there is no building currently
-            if(!tile->isClaimedForSeat(mPlayerSeat))
-                return false;
-            if(tile->getCoveringBuilding() != nullptr)
-                return false;
-
-            // We don't want to break a wall where there are activespots from another one
-            for(Tile* t : tile->getAllNeighbors())
-            {
-                if(t->isClaimedForSeat(mPlayerSeat) &&
-                    (t->getCoveringRoom() != nullptr))
-                {
-                    return false;
-                }
-            }
-            return true;
+            OD_LOG_INF("AI seatId=" + Helper::toString(mPlayer.getSeat()->getId()) + " could not build room type="
+                + Helper::toString(static_cast<uint32_t>(roomType)));
         }
-        default:
-            return false;
+    });
+    return true;
+}
+
+void BaseAI::queueMarkTilesForDigging(const std::vector<Tile*>& tiles)
+{
+    if(tiles.empty())
+        return;
+
+    queueCommand([this, tiles]()
+    {
+        for(Tile* tile : tiles)
+            tile->setMarkedForDigging(true, &mPlayer);
+    });
+}
+
+void BaseAI::queuePickUpAndDrop(Creature& creature, Tile& tile)
+{
+    queueCommand([this, &creature, &tile]()
+    {
+        // Another command may have changed the creature state
+        if(!creature.tryPickup(mPlayer.getSeat()))
+            return;
+
+        mPlayer.pickUpEntity(&creature);
+        mPlayer.dropHand(&tile);
+    });
+}
+
+int BaseAI::getAvailableGold() const
+{
+    int gold = 0;
+    for(Room* room : mGameMap.getRooms())
+    {
+        if(room->getSeat() != mPlayer.getSeat())
+            continue;
+
+        gold += room->getTotalGoldStored();
     }
 
-    return false;
+    return gold - mGoldSpent;
 }
 
-bool BaseAI::shouldWallTileBeConsideredForBestPlaceForRoom(Tile* tile, Seat* mPlayerSeat)
+int BaseAI::randomInt(int min, int max)
 {
-    // We only consider wall claimed for the correct seat or dirt (that can be claimed)
-    if(tile->getFullness() <= 0.0)
-        return false;
+    if(min > max)
+        std::swap(min, max);
 
-    if(tile->getType() == TileType::dirt)
-        return true;
+    std::uniform_int_distribution<int> distribution(min, max);
+    return distribution(mRandomGenerator);
+}
 
-    if(tile->isWallClaimedForSeat(mPlayerSeat))
-        return true;
+unsigned int BaseAI::randomUint(unsigned int min, unsigned int max)
+{
+    if(min > max)
+        std::swap(min, max);
 
-    return false;
+    std::uniform_int_distribution<unsigned int> distribution(min, max);
+    return distribution(mRandomGenerator);
+}
+
+Room* BaseAI::getDungeonTemple()
+{
+    std::vector<Room*> dt = mGameMap.getRoomsByTypeAndSeat(RoomType::dungeonTemple, mPlayer.getSeat());
+    if(!dt.empty())
+        return dt.front();
+    else
+        return nullptr;
 }
 
 //! To find the position, we try every square of the wantedSize width around the given tile for each possible distance
@@ -232,38 +325,15 @@ bool BaseAI::computePointsForRoom(Tile* tile, Seat* mPlayerSeat, int32_t wantedS
 {
     int tileX = tile->getX();
     int tileY = tile->getY();
-    bool isOk = true;
+    RoomPlacementMap& placementMap = mPlayerSeat->getRoomPlacementMap();
 
-    // We check if the tile is reachable. No need to compute if the tile is behind rocks
     points = 0;
-    // We start by searching for a place fitting the min size. If we find it,
-    // we increase tile by tile until the max size. If not, no need to continue
-    for(int32_t xx = 0; xx < wantedSize; ++xx)
-    {
-        for(int32_t yy = 0; yy < wantedSize; ++yy)
-        {
-            Tile* t;
-            if(bottomLeft2TopRight)
-                t  = mGameMap.getTile(tileX + xx, tileY + yy);
-            else
-                t  = mGameMap.getTile(tileX - xx, tileY - yy);
-
-            if(t == nullptr)
-            {
-                isOk = false;
-                break;
-            }
-
-            if(!shouldGroundTileBeConsideredForBestPlaceForRoom(t, mPlayerSeat))
-            {
-                isOk = false;
-                break;
-            }
-        }
-
-        if(!isOk)
-            break;
-    }
+    // The whole square should be buildable
+    bool isOk;
+    if(bottomLeft2TopRight)
+        isOk = placementMap.isGroundBuildable(tileX, tileY, tileX + wantedSize - 1, tileY + wantedSize - 1);
+    else
+        isOk = placementMap.isGroundBuildable(tileX - wantedSize + 1, tileY - wantedSize + 1, tileX, tileY);
 
     if(!isOk)
         return false;
@@ -273,123 +343,30 @@ bool BaseAI::computePointsForRoom(Tile* tile, Seat* mPlayerSeat, int32_t wantedS
     if(!useWalls)
         return true;
 
-    // We search points for first wall. That's not exactly how the activespots will be computed but it will be enough (especially
+    // We search points for each wall. That's not exactly how the activespots will be computed but it will be enough (especially
     // when the room size is even)
-    int nbConsecutiveTiles;
-    int nbActiveWallSpots;
-    // We search points for first wall
-    nbConsecutiveTiles = 0;
-    nbActiveWallSpots = 0;
-    for(int32_t kk = 0; kk < wantedSize; ++kk)
-    {
-        Tile* t;
-        if(bottomLeft2TopRight)
-            t  = mGameMap.getTile(tileX - 1, tileY + kk);
-        else
-            t  = mGameMap.getTile(tileX + 1, tileY - kk);
-        if(t == nullptr)
-            continue;
+    int32_t direction = bottomLeft2TopRight ? 1 : -1;
+    points += countWallActiveSpots(placementMap, tileX - direction, tileY, 0, direction, wantedSize) * pointsPerWallSpot;
+    points += countWallActiveSpots(placementMap, tileX + direction * wantedSize, tileY, 0, direction, wantedSize) * pointsPerWallSpot;
+    points += countWallActiveSpots(placementMap, tileX, tileY - direction, direction, 0, wantedSize) * pointsPerWallSpot;
+    points += countWallActiveSpots(placementMap, tileX, tileY + direction * wantedSize, direction, 0, wantedSize) * pointsPerWallSpot;
 
-        if(shouldWallTileBeConsideredForBestPlaceForRoom(t, mPlayerSeat))
-            ++nbConsecutiveTiles;
-        else
-            nbConsecutiveTiles = 0;
-
-        if(nbActiveWallSpots == 0)
-        {
-            if(nbConsecutiveTiles >= 3)
-            {
-                nbConsecutiveTiles = 0;
-                ++nbActiveWallSpots;
-            }
-        }
-        else if(nbConsecutiveTiles >= 2)
-        {
-            nbConsecutiveTiles = 0;
-            ++nbActiveWallSpots;
-        }
-    }
-    points += nbActiveWallSpots * pointsPerWallSpot;
-    // We search points for second wall
-    nbConsecutiveTiles = 0;
-    nbActiveWallSpots = 0;
-    for(int32_t kk = 0; kk < wantedSize; ++kk)
-    {
-        Tile* t;
-        if(bottomLeft2TopRight)
-            t = mGameMap.getTile(tileX + wantedSize, tileY + kk);
-        else
-            t = mGameMap.getTile(tileX - wantedSize, tileY - kk);
-        if(t == nullptr)
-            continue;
-
-        if(shouldWallTileBeConsideredForBestPlaceForRoom(t, mPlayerSeat))
-            ++nbConsecutiveTiles;
-        else
-            nbConsecutiveTiles = 0;
-
-        if(nbActiveWallSpots == 0)
-        {
-            if(nbConsecutiveTiles >= 3)
-            {
-                nbConsecutiveTiles = 0;
-                ++nbActiveWallSpots;
-            }
-        }
-        else if(nbConsecutiveTiles >= 2)
-        {
-            nbConsecutiveTiles = 0;
-            ++nbActiveWallSpots;
-        }
-    }
-    points += nbActiveWallSpots * pointsPerWallSpot;
-    // We search points for first wall
-    nbConsecutiveTiles = 0;
-    nbActiveWallSpots = 0;
-    for(int32_t kk = 0; kk < wantedSize; ++kk)
-    {
-        Tile* t;
-        if(bottomLeft2TopRight)
-            t = mGameMap.getTile(tileX + kk, tileY - 1);
-        else
-            t = mGameMap.getTile(tileX - kk, tileY + 1);
-        if(t == nullptr)
-            continue;
-
-        if(shouldWallTileBeConsideredForBestPlaceForRoom(t, mPlayerSeat))
-            ++nbConsecutiveTiles;
-        else
-            nbConsecutiveTiles = 0;
+    return true;
+}
 
-        if(nbActiveWallSpots == 0)
-        {
-            if(nbConsecutiveTiles >= 3)
-            {
-                nbConsecutiveTiles = 0;
-                ++nbActiveWallSpots;
-            }
-        }
-        else if(nbConsecutiveTiles >= 2)
-        {
-            nbConsecutiveTiles = 0;
-            ++nbActiveWallSpots;
-        }
-    }
-    points += nbActiveWallSpots * pointsPerWallSpot;
-    // We search points for first wall
-    nbConsecutiveTiles = 0;
-    nbActiveWallSpots = 0;
-    for(int32_t kk = 0; kk < wantedSize; ++kk)
+int32_t BaseAI::countWallActiveSpots(RoomPlacementMap& placementMap, int32_t startX, int32_t startY,
+    int32_t stepX, int32_t stepY, int32_t wallSize)
+{
+    int nbConsecutiveTiles = 0;
+    int nbActiveWallSpots = 0;
+    for(int32_t kk = 0; kk < wallSize; ++kk)
     {
-        Tile* t;
-        if(bottomLeft2TopRight)
-            t = mGameMap.getTile(tileX + kk, tileY + wantedSize);
-        else
-            t = mGameMap.getTile(tileX - kk, tileY - wantedSize);
-        if(t == nullptr)
+        int32_t x = startX + kk * stepX;
+        int32_t y = startY + kk * stepY;
+        if(mGameMap.getTile(x, y) == nullptr)
             continue;
 
-        if(shouldWallTileBeConsideredForBestPlaceForRoom(t, mPlayerSeat))
+        if(placementMap.isWallUsable(x, y))
             ++nbConsecutiveTiles;
         else
             nbConsecutiveTiles = 0;
@@ -408,68 +385,25 @@ bool BaseAI::computePointsForRoom(Tile* tile, Seat* mPlayerSeat, int32_t wantedS
             ++nbActiveWallSpots;
         }
     }
-    points += nbActiveWallSpots * pointsPerWallSpot;
 
-    return true;
+    return nbActiveWallSpots;
 }
 
 bool BaseAI::digWayToTile(Tile* tileStart, Tile* tileEnd)
 {
-    // We find a way to tileEnd. We search in reverse order to stop when we reach the first
-    // accessible tile
-
-    // Set a diggable path up to the first gold spot for the given team color, by the first available worker
+    // Set the cheapest diggable path up to tileEnd for the given team color, by the first available worker.
+    // The tiles the worker can already go through cost their walking time only so the path goes
+    // through the reachable tiles as long as possible
     Seat* seat = mPlayer.getSeat();
     Creature* worker = mGameMap.getWorkerForPathFinding(seat);
     if (worker == nullptr)
         return false;
 
-    std::list<Tile*> pathToDig = mGameMap.path(tileEnd, tileStart, worker, seat, true);
-    if (pathToDig.empty())
+    std::vector<Tile*> tilesToDig;
+    if(!mDigPathSearch.findDigPath(mGameMap, *tileStart, *tileEnd, *worker, tilesToDig))
         return false;
 
-    // We search for the first reachable tile in the list
-    bool isPathFound = false;
-    for(std::list<Tile*>::iterator it = pathToDig.begin(); it != pathToDig.end();)
-    {
-        Tile* tile = *it;
-        if(!isPathFound &&
-           (tile->getFullness() == 0.0) &&
-           (mGameMap.pathExists(worker, tileStart, tile)))
-        {
-            isPathFound = true;
-        }
-
-        if(isPathFound)
-        {
-            it = pathToDig.erase(it);
-            continue;
-        }
-
-        // If the tile should be dug, we check if one of its neighboors can be reached.
-        // If yes, we will stop after digging it to avoid digging through a wall as much as
-        // possible
-        for(Tile* t : tile->getAllNeighbors())
-        {
-            if(!isPathFound &&
-               (t->getFullness() == 0.0) &&
-               (mGameMap.pathExists(worker, tileStart, t)))
-            {
-                // we let the iterator increment because we want to dig the currently
-                // tested tile
-                isPathFound = true;
-                break;
-            }
-        }
-
-        ++it;
-    }
-
-    for(Tile* tile : pathToDig)
-    {
-        if (tile && tile->isDiggable(seat))
-            tile->setMarkedForDigging(true, &mPlayer);
-    }
+    queueMarkTilesForDigging(tilesToDig);
 
     return true;
 }
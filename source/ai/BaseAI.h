@@ -18,17 +18,25 @@
 #ifndef BASEAI_H
 #define BASEAI_H
 
+#include "ai/AITask.h"
+#include "gamemap/DigPathSearch.h"
+
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <functional>
+#include <random>
 
+class Creature;
 class GameMap;
 class Player;
 class Room;
+class RoomPlacementMap;
 class Tile;
 class Seat;
 
 enum class KeeperAIType;
+enum class RoomType;
 
 class BaseAI
 {
@@ -36,17 +44,60 @@ public:
     virtual ~BaseAI()
     {}
 
-     /** \brief This is the function that will be called each turn for the ai.
-     *  This is the function that will be called each turn for the ai.
-     *  For custom AI's this should be overridden and return true on a
-     *  successful call.
-     *  \param frameTime Time elapsed since last call in seconds.
-     */
+    //! \brief Called each turn on the server thread before the AI tasks are scheduled. Returns false if
+    //! the AI should not run any task this turn (for example, if it has lost)
     virtual bool doTurn(double timeSinceLastTurn) = 0;
 
+    //! \brief Starts a new turn: clears the commands, counts down the turns before the tasks are due
+    //! and calls doTurn. Returns the doTurn result
+    bool prepareTurn(double timeSinceLastTurn);
+
+    //! \brief Runs the tasks scheduled by the AIManager for this turn. The evaluation may run on another
+    //! thread than the server one (see AIManager::doTurn) at the same time as other AIs. During the
+    //! evaluation, the game state should only be read. The actions are queued with queueCommand and the
+    //! other helper functions and are applied when applyCommands is called.
+    void evaluateTurn();
+
+    //! \brief Applies the commands queued during evaluateTurn in the order they were queued.
+    //! Must be called on the server thread
+    void applyCommands();
+
+    inline std::vector<AITask>& getTasks()
+    { return mTasks; }
+
 protected:
     BaseAI(GameMap& gameMap, Player& player);
 
+    //! \brief Registers a task the AI should run periodically. See AITask for the parameters
+    void addTask(const std::string& name, int32_t priority, uint32_t cost,
+        int32_t periodMin, int32_t periodMax, std::function<void()>&& function);
+
+    //! \brief Queues an action that will be applied after all the AIs have been evaluated
+    void queueCommand(std::function<void()>&& command);
+
+    //! \brief Queues the construction of the given room if the seat has enough gold. Returns true if
+    //! the room has been queued and false otherwise.
+    bool queueBuildRoom(RoomType roomType, const std::vector<Tile*>& tiles);
+
+    //! \brief Queues marking the given tiles for digging
+    void queueMarkTilesForDigging(const std::vector<Tile*>& tiles);
+
+    //! \brief Queues picking up the given creature and dropping it on the given tile
+    void queuePickUpAndDrop(Creature& creature, Tile& tile);
+
+    //! \brief Returns the gold the seat can spend. The gold spent by the commands queued during this
+    //! turn is taken into account
+    int getAvailableGold() const;
+
+    //! \brief Gold spent by the commands queued during this turn
+    inline void spendGold(int gold)
+    { mGoldSpent += gold; }
+
+    //! \brief Random numbers for the AI decisions. The generator is owned by the AI so that the result
+    //! does not depend on the order the AIs are evaluated in
+    int randomInt(int min, int max);
+    unsigned int randomUint(unsigned int min, unsigned int max);
+
     Room* getDungeonTemple();
 
     //! \brief Searches for the best place where to place a room around the given tile. It will take
@@ -56,6 +107,8 @@ protected:
     bool findBestPlaceForRoom(Tile* tile, Seat* playerSeat, int32_t wantedSize, bool useWalls,
         int32_t& bestX, int32_t& bestY);
 
+    //! \brief Queues marking for digging the tiles on the way from tileStart to tileEnd that takes the least
+    //! time to walk and dig (see DigPathSearch). Returns false if tileEnd cannot be reached
     bool digWayToTile(Tile* tileStart, Tile* tileEnd);
     bool computePointsForRoom(Tile* tile, Seat* playerSeat, int32_t wantedSize,
         bool bottomLeft2TopRight, bool useWalls, int32_t& points);
@@ -64,8 +117,16 @@ protected:
     Player& mPlayer;
 
 private:
-    bool shouldGroundTileBeConsideredForBestPlaceForRoom(Tile* tile, Seat* playerSeat);
-    bool shouldWallTileBeConsideredForBestPlaceForRoom(Tile* tile, Seat* playerSeat);
+    std::vector<AITask> mTasks;
+    std::vector<std::function<void()>> mCommands;
+    int mGoldSpent;
+    std::mt19937 mRandomGenerator;
+    DigPathSearch mDigPathSearch;
+
+    //! \brief Counts the wall active spots a room could get along the wallSize tiles starting from
+    //! (startX, startY) in the given direction
+    int32_t countWallActiveSpots(RoomPlacementMap& placementMap, int32_t startX, int32_t startY,
+        int32_t stepX, int32_t stepY, int32_t wallSize);
 };
 
 #endif // BASEAI_H
@@ -31,7 +31,6 @@
 #include "spells/SpellSummonWorker.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/Random.h"
 
 #include <vector>
 
@@ -52,25 +51,34 @@ KeeperAI::KeeperAI(GameMap& gameMap, Player& player, int cooldownDefenseMin, int
              int cooldownSaveWoundedCreaturesMin, int cooldownSaveWoundedCreaturesMax,
              int cooldownLookingForRoomsMin, int cooldownLookingForRoomsMax):
     BaseAI(gameMap, player),
-    mCooldownCheckTreasury(0),
-    mCooldownLookingForRooms(0),
-    mCooldownLookingForRoomsMin(cooldownLookingForRoomsMin),
-    mCooldownLookingForRoomsMax(cooldownLookingForRoomsMax),
     mRoomPosX(-1),
     mRoomPosY(-1),
     mRoomSize(-1),
     mNoMoreReachableGold(false),
-    mCooldownLookingForGold(0),
-    mCooldownDefense(0),
-    mCooldownDefenseMin(cooldownDefenseMin),
-    mCooldownDefenseMax(cooldownDefenseMax),
-    mCooldownWorkers(0),
-    mCooldownRepairRooms(0),
-    mCooldownSaveWoundedCreatures(0),
-    mCooldownSaveWoundedCreaturesMin(cooldownSaveWoundedCreaturesMin),
-    mCooldownSaveWoundedCreaturesMax(cooldownSaveWoundedCreaturesMax),
     mIsFirstUpkeepDone(false)
 {
+    // Tasks are run by decreasing priority. The estimated costs (in microseconds) are only used until the
+    // tasks have been measured
+    addTask("handleDefense", 100, 200, cooldownDefenseMin, cooldownDefenseMax,
+        [this]() { handleDefense(); });
+    addTask("saveWoundedCreatures", 90, 200, cooldownSaveWoundedCreaturesMin, cooldownSaveWoundedCreaturesMax,
+        [this]() { saveWoundedCreatures(); });
+    addTask("handleWorkers", 80, 50, 3, 10,
+        [this]() { handleWorkers(); });
+    // If the treasury gets destroyed, we don't want the AI to build each turn the
+    // free treasury
+    addTask("checkTreasury", 70, 300, 10, 30,
+        [this]() { checkTreasury(); });
+    addTask("handleRooms", 60, 2000, cooldownLookingForRoomsMin, cooldownLookingForRoomsMax,
+        [this]() { handleRooms(); });
+    addTask("lookForGold", 50, 1000, 70, 120,
+        [this]() { lookForGold(); });
+    addTask("repairRooms", 40, 100, 20, 60,
+        [this]() { repairRooms(); });
+    addTask("handleTiredCreatures", 30, 300, 0, 0,
+        [this]() { handleTiredCreatures(); });
+    addTask("handleHungryCreatures", 20, 300, 0, 0,
+        [this]() { handleHungryCreatures(); });
 }
 
 bool KeeperAI::doTurn(double timeSinceLastTurn)
@@ -85,45 +93,11 @@ bool KeeperAI::doTurn(double timeSinceLastTurn)
         handleFirstTurn();
     }
 
-    saveWoundedCreatures();
-
-    handleDefense();
-
-    if (handleWorkers())
-        return true;
-
-    if (checkTreasury())
-        return true;
-
-    if (handleRooms())
-        return true;
-
-    if (lookForGold())
-        return true;
-
-    if (repairRooms())
-        return true;
-
-    if(handleTiredCreatures())
-        return true;
-
-    if(handleHungryCreatures())
-        return true;
-
     return true;
 }
 
 bool KeeperAI::checkTreasury()
 {
-    // If the treasury gets destroyed, we don't want the AI to build each turn the
-    // free treasury
-    if(mCooldownCheckTreasury > 0)
-    {
-        --mCooldownCheckTreasury;
-        return false;
-    }
-    mCooldownCheckTreasury = Random::Int(10,30);
-
     int totalGold = 0;
     int totalStorage = 0;
     for(Room* room : mGameMap.getRooms())
@@ -165,10 +139,7 @@ bool KeeperAI::checkTreasury()
                     std::vector<Tile*> tiles;
                     tiles.push_back(neigh);
 
-                    if(!RoomManager::buildRoomOnTiles(&mGameMap, RoomType::treasury, &mPlayer, tiles))
-                        return false;
-
-                    return true;
+                    return queueBuildRoom(RoomType::treasury, tiles);
                 }
             }
         }
@@ -275,22 +246,11 @@ bool KeeperAI::checkTreasury()
     std::vector<Tile*> tiles;
     tiles.push_back(firstAvailableTile);
 
-    if(!RoomManager::buildRoomOnTiles(&mGameMap, RoomType::treasury, &mPlayer, tiles))
-        return false;
-
-    return true;
+    return queueBuildRoom(RoomType::treasury, tiles);
 }
 
 bool KeeperAI::handleRooms()
 {
-    if(mCooldownLookingForRooms > 0)
-    {
-        --mCooldownLookingForRooms;
-        return false;
-    }
-
-    mCooldownLookingForRooms = Random::Int(mCooldownLookingForRoomsMin, mCooldownLookingForRoomsMax);
-
     // We check if the last built room is done
     if(mRoomSize != -1)
     {
@@ -337,6 +297,7 @@ bool KeeperAI::handleRooms()
     if(!digWayToTile(central, tileDest))
         return false;
 
+    std::vector<Tile*> tilesToDig;
     for(int xx = 0; xx < mRoomSize; ++xx)
     {
         for(int yy = 0; yy < mRoomSize; ++yy)
@@ -348,9 +309,10 @@ bool KeeperAI::handleRooms()
                 continue;
             }
 
-            tile->setMarkedForDigging(true, &mPlayer);
+            tilesToDig.push_back(tile);
         }
     }
+    queueMarkTilesForDigging(tilesToDig);
 
     return true;
 }
@@ -360,14 +322,6 @@ bool KeeperAI::lookForGold()
     if (mNoMoreReachableGold)
         return false;
 
-    if(mCooldownLookingForGold > 0)
-    {
-        --mCooldownLookingForGold;
-        return false;
-    }
-
-    mCooldownLookingForGold = Random::Int(70,120);
-
     // Do we need gold ?
     int emptyStorage = 0;
     for(Room* room : mGameMap.getRooms())
@@ -383,96 +337,20 @@ bool KeeperAI::lookForGold()
         return false;
 
     Tile* central = getDungeonTemple()->getCentralTile();
-    int widerSide = mGameMap.getMapSizeX() > mGameMap.getMapSizeY() ?
-        mGameMap.getMapSizeX() : mGameMap.getMapSizeY();
-
-    // We search for the closest gold tile
-    Tile* firstGoldTile = nullptr;
-    for(int32_t distance = 1; distance < widerSide; ++distance)
+    Creature* worker = mGameMap.getWorkerForPathFinding(mPlayer.getSeat());
+    if(worker == nullptr)
     {
-        for(int k = 0; k <= distance; ++k)
-        {
-            Tile* t;
-            // North-East
-            t = mGameMap.getTile(central->getX() + k, central->getY() + distance);
-            if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-            {
-                // If we already have a tile at same distance, we randomly change to
-                // try to not be too predictable
-                if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                    firstGoldTile = t;
-            }
-            // North-West
-            if(k > 0)
-            {
-                t = mGameMap.getTile(central->getX() - k, central->getY() + distance);
-                if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-                {
-                    if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                        firstGoldTile = t;
-                }
-            }
-            // South-East
-            t = mGameMap.getTile(central->getX() + k, central->getY() - distance);
-            if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-            {
-                if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                    firstGoldTile = t;
-            }
-            // South-West
-            if(k > 0)
-            {
-                t = mGameMap.getTile(central->getX() - k, central->getY() - distance);
-                if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-                {
-                    if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                        firstGoldTile = t;
-                }
-            }
-            // East-North
-            t = mGameMap.getTile(central->getX() + distance, central->getY() + k);
-            if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-            {
-                if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                    firstGoldTile = t;
-            }
-            // East-South
-            if(k > 0)
-            {
-                t = mGameMap.getTile(central->getX() + distance, central->getY() - k);
-                if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-                {
-                    if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                        firstGoldTile = t;
-                }
-            }
-            // West-North
-            t = mGameMap.getTile(central->getX() - distance, central->getY() + k);
-            if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-            {
-                if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                    firstGoldTile = t;
-            }
-            // West-South
-            if(k > 0)
-            {
-                t = mGameMap.getTile(central->getX() - distance, central->getY() - k);
-                if(t != nullptr && t->getType() == TileType::gold && t->getFullness() > 0.0)
-                {
-                    if((firstGoldTile == nullptr) || (Random::Uint(1,2) == 1))
-                        firstGoldTile = t;
-                }
-            }
-
-            if(firstGoldTile != nullptr)
-                break;
-        }
-
-        // If we found a tile, no need to continue
-        if(firstGoldTile != nullptr)
-            break;
+        mNoMoreReachableGold = true;
+        return false;
     }
 
+    // We search for the closest gold tile. If there are more than one at the same distance, we
+    // randomly choose one to try to not be too predictable
+    Tile* firstGoldTile = nullptr;
+    std::vector<Tile*> goldTiles;
+    if(mPlayer.getSeat()->getGoldVeinIndex().getClosestReachableGoldTiles(*central, *worker, goldTiles))
+        firstGoldTile = goldTiles[randomUint(0, static_cast<unsigned int>(goldTiles.size()) - 1)];
+
     // No more gold
     if (firstGoldTile == nullptr)
     {
@@ -506,8 +384,7 @@ bool KeeperAI::lookForGold()
         }
     }
 
-    for(Tile* tile : tilesDig)
-        tile->setMarkedForDigging(true, &mPlayer);
+    queueMarkTilesForDigging(std::vector<Tile*>(tilesDig.begin(), tilesDig.end()));
 
     return true;
 }
@@ -536,7 +413,7 @@ bool KeeperAI::buildRoom(RoomType roomType, int x, int y, int roomSize)
     if (tiles.size() < static_cast<uint32_t>(roomSize * roomSize))
         return false;
 
-    if(!RoomManager::buildRoomOnTiles(&mGameMap, roomType, &mPlayer, tiles))
+    if(!queueBuildRoom(roomType, tiles))
         return false;
 
     OD_LOG_INF("AI seatId=" + Helper::toString(mPlayer.getSeat()->getId())+ " builds room type=" + Helper::toString(static_cast<uint32_t>(roomType)) + ", x=" + Helper::toString(x) + ", y=" + Helper::toString(y) + ", roomSize=" + Helper::toString(roomSize));
@@ -602,13 +479,6 @@ bool KeeperAI::checkNeedRoom(RoomType roomType)
 
 void KeeperAI::saveWoundedCreatures()
 {
-    if(mCooldownSaveWoundedCreatures > 0)
-    {
-        --mCooldownSaveWoundedCreatures;
-        return;
-    }
-    mCooldownSaveWoundedCreatures = Random::Int(mCooldownSaveWoundedCreaturesMin, mCooldownSaveWoundedCreaturesMax);
-
     Tile* dungeonTempleTile = getDungeonTemple()->getCentralTile();
     if(dungeonTempleTile == nullptr)
     {
@@ -637,21 +507,12 @@ void KeeperAI::saveWoundedCreatures()
         if(!creature->tryPickup(seat))
             continue;
 
-        mPlayer.pickUpEntity(creature);
-
-        mPlayer.dropHand(dungeonTempleTile);
+        queuePickUpAndDrop(*creature, *dungeonTempleTile);
     }
 }
 
 void KeeperAI::handleDefense()
 {
-    if(mCooldownDefense > 0)
-    {
-        --mCooldownDefense;
-        return;
-    }
-    mCooldownDefense = Random::Int(mCooldownDefenseMin, mCooldownDefenseMax);
-
     Seat* seat = mPlayer.getSeat();
     // We drop creatures nearby owned or allied attacked creatures
     std::vector<Creature*> creatures = mGameMap.getCreaturesByAlliedSeat(seat);
@@ -690,8 +551,7 @@ void KeeperAI::handleDefense()
         {
             if(creatureToDrop->tryDrop(seat, neigh))
             {
-                mPlayer.pickUpEntity(creatureToDrop);
-                mPlayer.dropHand(neigh);
+                queuePickUpAndDrop(*creatureToDrop, *neigh);
                 return;
             }
         }
@@ -700,14 +560,6 @@ void KeeperAI::handleDefense()
 
 bool KeeperAI::handleWorkers()
 {
-    if(mCooldownWorkers > 0)
-    {
-        --mCooldownWorkers;
-        return false;
-    }
-
-    mCooldownWorkers = Random::Int(3,10);
-
     // We want to use the first covered tile because the central might be destroyed and enemy claimed
     // and, if it is the case, we will not be able to spawn a worker.
     int mana = static_cast<int>(mPlayer.getSeat()->getMana());
@@ -719,13 +571,15 @@ bool KeeperAI::handleWorkers()
     // If we have less than 4 workers or we have the chance, we summon
     int nbWorkers = mPlayer.getSeat()->getNumCreaturesWorkers();
     if((nbWorkers < 4) ||
-       (Random::Int(0, nbWorkers * 3) == 0))
+       (randomInt(0, nbWorkers * 3) == 0))
     {
         Tile* tile = getDungeonTemple()->getCoveredTile(0);
-        std::vector<Tile*> tiles;
-        tiles.push_back(tile);
-        if(!SpellSummonWorker::summonWorkersOnTiles(&mGameMap, &mPlayer, tiles))
-            return false;
+        queueCommand([this, tile]()
+        {
+            std::vector<Tile*> tiles;
+            tiles.push_back(tile);
+            SpellSummonWorker::summonWorkersOnTiles(&mGameMap, &mPlayer, tiles);
+        });
 
         return true;
     }
@@ -735,14 +589,6 @@ bool KeeperAI::handleWorkers()
 
 bool KeeperAI::repairRooms()
 {
-    if(mCooldownRepairRooms > 0)
-    {
-        --mCooldownRepairRooms;
-        return false;
-    }
-
-    mCooldownRepairRooms = Random::Int(20,60);
-
     Seat* seat = mPlayer.getSeat();
     for(Room* room : mGameMap.getRooms())
     {
@@ -753,11 +599,17 @@ bool KeeperAI::repairRooms()
             continue;
 
         int goldRequired = room->getCostRepair();
-
-        if(!mGameMap.withdrawFromTreasuries(goldRequired, mPlayer.getSeat()))
+        if(goldRequired > getAvailableGold())
             return false;
 
-        room->repairRoom();
+        spendGold(goldRequired);
+        queueCommand([this, room, goldRequired]()
+        {
+            if(!mGameMap.withdrawFromTreasuries(goldRequired, mPlayer.getSeat()))
+                return;
+
+            room->repairRoom();
+        });
         // We only repair one room at a time. Note that if we want to repair more than one room at a time, we should pay
         // attention to not modify the room list (if room absorbed in RoomManager::buildRoom) while iterating it
         break;
@@ -825,9 +677,7 @@ bool KeeperAI::handleTiredCreatures()
         if(!creature->tryPickup(mPlayer.getSeat()))
             continue;
 
-        mPlayer.pickUpEntity(creature);
-
-        mPlayer.dropHand(dropTile);
+        queuePickUpAndDrop(*creature, *dropTile);
 
         // We help only 1 creature per turn
         return true;
@@ -868,9 +718,7 @@ bool KeeperAI::handleHungryCreatures()
         if(!creature->tryPickup(mPlayer.getSeat()))
             continue;
 
-        mPlayer.pickUpEntity(creature);
-
-        mPlayer.dropHand(dungeonTempleTile);
+        queuePickUpAndDrop(*creature, *dungeonTempleTile);
 
         // We help only 1 creature per turn
         return true;
@@ -881,10 +729,13 @@ bool KeeperAI::handleHungryCreatures()
 
 void KeeperAI::handleFirstTurn()
 {
-    Seat* seat = mPlayer.getSeat();
-    // We set the skills to research. We start with pending skills to not modify research
-    // order if it was already set in the level
-    std::vector<SkillType> skills = seat->getSkillPending();
-    SkillManager::buildRandomPendingSkillsForSeat(skills, seat);
-    seat->setSkillTree(skills);
+    queueCommand([this]()
+    {
+        Seat* seat = mPlayer.getSeat();
+        // We set the skills to research. We start with pending skills to not modify research
+        // order if it was already set in the level
+        std::vector<SkillType> skills = seat->getSkillPending();
+        SkillManager::buildRandomPendingSkillsForSeat(skills, seat);
+        seat->setSkillTree(skills);
+    });
 }
@@ -84,23 +84,10 @@ private:
     //! \brief Returns true if the given room is needed and false otherwise
     bool checkNeedRoom(RoomType roomType);
 
-    int mCooldownCheckTreasury;
-    int mCooldownLookingForRooms;
-    int mCooldownLookingForRoomsMin;
-    int mCooldownLookingForRoomsMax;
     int mRoomPosX;
     int mRoomPosY;
     int mRoomSize;
     bool mNoMoreReachableGold;
-    int mCooldownLookingForGold;
-    int mCooldownDefense;
-    int mCooldownDefenseMin;
-    int mCooldownDefenseMax;
-    int mCooldownWorkers;
-    int mCooldownRepairRooms;
-    int mCooldownSaveWoundedCreatures;
-    int mCooldownSaveWoundedCreaturesMin;
-    int mCooldownSaveWoundedCreaturesMax;
     bool mIsFirstUpkeepDone;
 };
 
@@ -21,6 +21,7 @@
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+#include <cassert>
 #include <istream>
 
 std::string CreatureAction::toString(CreatureActionType actionType)
@@ -21,7 +21,6 @@
 #include "entities/CreatureMoodValues.h"
 
 #include <cstdint>
-#include <functional>
 #include <istream>
 
 class Creature;
@@ -80,11 +79,12 @@ public:
     inline int32_t getNbTurnsActive() const
     { return mNbTurnsActive; }
 
-    //! Returns a pointer to the given action from CreatureAction class. Note that
-    //! we don't want to do stuff in the child classes because many actions will
-    //! pop themselves which might result in errors. Instead, we expect every action
-    //! to call the expected action from CreatureAction with the good parameters.
-    virtual std::function<bool()> action() = 0;
+    //! Runs one step of the action. Returns true if the creature should try another
+    //! action during this turn. Note that many actions will pop themselves, which
+    //! destroys them while they are running. Thus, we expect every action to call
+    //! its static handler with its members passed as parameters and not to use
+    //! its members after that.
+    virtual bool action() = 0;
 
     //! \brief Returns the mood value modifier that should be applied to the creature
     //! when this action is in its list. The value should be used as defined
@@ -29,7 +29,6 @@
 #include "rooms/Room.h"
 #include "utils/ConfigManager.h"
 #include "utils/Helper.h"
-#include "utils/MakeUnique.h"
 #include "utils/LogManager.h"
 
 CreatureActionDigTile::CreatureActionDigTile(Creature& creature, Tile& tileDig, Tile& tilePos) :
@@ -45,10 +44,9 @@ CreatureActionDigTile::~CreatureActionDigTile()
     mTileDig.removeWorkerDigging(mCreature, mTilePos);
 }
 
-std::function<bool()> CreatureActionDigTile::action()
+bool CreatureActionDigTile::action()
 {
-    return std::bind(&CreatureActionDigTile::handleDigTile,
-        std::ref(mCreature), std::ref(mTileDig), std::ref(mTilePos));
+    return handleDigTile(mCreature, mTileDig, mTilePos);
 }
 
 bool CreatureActionDigTile::handleDigTile(Creature& creature, Tile& tileDig, Tile& tilePos)
@@ -146,11 +144,10 @@ bool CreatureActionDigTile::handleDigTile(Creature& creature, Tile& tileDig, Til
         obj->setPosition(pos);
 
         bool isTreasuryAvailable = false;
-        for(Room* room : creature.getGameMap()->getRooms())
+        std::vector<Room*> rooms;
+        creature.getSeat()->getRoomAvailabilityIndex().getAvailableRooms(RoomAvailability::goldStorage, rooms);
+        for(Room* room : rooms)
         {
-            if(room->getSeat() != creature.getSeat())
-                continue;
-
             if(room->getTotalGoldStorage() <= 0)
                 continue;
 
@@ -172,7 +169,7 @@ bool CreatureActionDigTile::handleDigTile(Creature& creature, Tile& tileDig, Til
         {
             // We do not push CreatureActionType::searchEntityToCarry because we want
             // this worker to be count as digging, not as carrying stuff
-            creature.pushAction(Utils::make_unique<CreatureActionGrabEntity>(creature, *obj));
+            creature.pushAction<CreatureActionGrabEntity>(creature, *obj);
             return true;
         }
 
@@ -24,11 +24,16 @@
 #include "gamemap/GameMap.h"
 #include "gamemap/Pathfinding.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
+static ConfigParam<double> HATCHERY_HUNGER_PER_CHICKEN(ConfigParamCategory::rooms, "HatcheryHungerPerChicken");
+static ConfigParam<uint32_t> HATCHERY_COOLDOWN_CHICKEN_MIN(ConfigParamCategory::rooms, "HatcheryCooldownChickenMin");
+static ConfigParam<uint32_t> HATCHERY_COOLDOWN_CHICKEN_MAX(ConfigParamCategory::rooms, "HatcheryCooldownChickenMax");
+static ConfigParam<double> HATCHERY_HP_RECOVERED_PER_CHICKEN(ConfigParamCategory::rooms, "HatcheryHpRecoveredPerChicken");
+
 CreatureActionEatChicken::CreatureActionEatChicken(Creature& creature, ChickenEntity& chicken) :
     CreatureAction(creature),
     mChicken(&chicken)
@@ -46,10 +51,9 @@ CreatureActionEatChicken::~CreatureActionEatChicken()
     }
 }
 
-std::function<bool()> CreatureActionEatChicken::action()
+bool CreatureActionEatChicken::action()
 {
-    return std::bind(&CreatureActionEatChicken::handleEatChicken,
-        std::ref(mCreature), mChicken);
+    return handleEatChicken(mCreature, mChicken);
 }
 
 bool CreatureActionEatChicken::handleEatChicken(Creature& creature, ChickenEntity* chicken)
@@ -102,16 +106,16 @@ bool CreatureActionEatChicken::handleEatChicken(Creature& creature, ChickenEntit
         std::vector<Ogre::Vector3> path;
         creature.tileToVector3(pathToChicken, path, true, 0.0);
         creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-        creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+        creature.pushAction<CreatureActionWalkToTile>(creature);
         return false;
     }
 
     // We can eat the chicken
     chicken->eatChicken(&creature);
-    creature.foodEaten(ConfigManager::getSingleton().getRoomConfigDouble("HatcheryHungerPerChicken"));
-    creature.setJobCooldown(Random::Int(ConfigManager::getSingleton().getRoomConfigUInt32("HatcheryCooldownChickenMin"),
-        ConfigManager::getSingleton().getRoomConfigUInt32("HatcheryCooldownChickenMax")));
-    creature.setHP(creature.getHP() + ConfigManager::getSingleton().getRoomConfigDouble("HatcheryHpRecoveredPerChicken"));
+    creature.foodEaten(HATCHERY_HUNGER_PER_CHICKEN.get());
+    creature.setJobCooldown(Random::Int(HATCHERY_COOLDOWN_CHICKEN_MIN.get(),
+        HATCHERY_COOLDOWN_CHICKEN_MAX.get()));
+    creature.setHP(creature.getHP() + HATCHERY_HP_RECOVERED_PER_CHICKEN.get());
     creature.computeCreatureOverlayHealthValue();
     Ogre::Vector3 walkDirection = Ogre::Vector3(chickenTile->getX(), chickenTile->getY(), 0) - creature.getPosition();
     walkDirection.normalise();
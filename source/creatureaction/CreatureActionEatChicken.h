@@ -33,7 +33,7 @@ public:
     CreatureActionType getType() const override
     { return CreatureActionType::eatChicken; }
 
-    std::function<bool()> action() override;
+    bool action() override;
 
     std::string getListenerName() const override;
     bool notifyDead(GameEntity* entity) override;
@@ -26,7 +26,6 @@
 #include "gamemap/GameMap.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
 CreatureActionFight::CreatureActionFight(Creature& creature, GameEntity* entityAttack, bool koOpponent, bool notifyPlayerIfHit) :
     CreatureAction(creature),
@@ -44,10 +43,9 @@ CreatureActionFight::~CreatureActionFight()
         mEntityAttack->removeGameEntityListener(this);
 }
 
-std::function<bool()> CreatureActionFight::action()
+bool CreatureActionFight::action()
 {
-    return std::bind(&CreatureActionFight::handleFight,
-        std::ref(mCreature), mEntityAttack, mKoOpponent, mNotifyPlayerIfHit);
+    return handleFight(mCreature, mEntityAttack, mKoOpponent, mNotifyPlayerIfHit);
 }
 
 bool CreatureActionFight::handleFight(Creature& creature, GameEntity* entityAttack, bool koOpponent, bool notifyPlayerIfHit)
@@ -157,7 +155,7 @@ bool CreatureActionFight::handleFight(Creature& creature, GameEntity* entityAtta
             std::vector<Ogre::Vector3> path;
             creature.tileToVector3(result, path, true, 0.0);
             creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-            creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+            creature.pushAction<CreatureActionWalkToTile>(creature);
             return false;
         }
     }
@@ -194,7 +192,7 @@ bool CreatureActionFight::handleFight(Creature& creature, GameEntity* entityAtta
             std::vector<Ogre::Vector3> path;
             creature.tileToVector3(result, path, true, 0.0);
             creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-            creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+            creature.pushAction<CreatureActionWalkToTile>(creature);
             return false;
         }
     }
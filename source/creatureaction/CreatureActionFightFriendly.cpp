@@ -26,7 +26,6 @@
 #include "gamemap/GameMap.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
 CreatureActionFightFriendly::CreatureActionFightFriendly(Creature& creature, GameEntity* entityAttack, bool koOpponent, const std::vector<Tile*>& tilesFilter, bool notifyPlayerIfHit) :
     CreatureAction(creature),
@@ -45,10 +44,9 @@ CreatureActionFightFriendly::~CreatureActionFightFriendly()
         mEntityAttack->removeGameEntityListener(this);
 }
 
-std::function<bool()> CreatureActionFightFriendly::action()
+bool CreatureActionFightFriendly::action()
 {
-    return std::bind(&CreatureActionFightFriendly::handleFight,
-        std::ref(mCreature), mEntityAttack, mKoOpponent, mTilesFilter, mNotifyPlayerIfHit);
+    return handleFight(mCreature, mEntityAttack, mKoOpponent, mTilesFilter, mNotifyPlayerIfHit);
 }
 
 bool CreatureActionFightFriendly::handleFight(Creature& creature, GameEntity* entityAttack, bool koOpponent, const std::vector<Tile*>& tilesFilter, bool notifyPlayerIfHit)
@@ -157,7 +155,7 @@ bool CreatureActionFightFriendly::handleFight(Creature& creature, GameEntity* en
             std::vector<Ogre::Vector3> path;
             creature.tileToVector3(result, path, true, 0.0);
             creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-            creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+            creature.pushAction<CreatureActionWalkToTile>(creature);
             return false;
         }
     }
@@ -194,7 +192,7 @@ bool CreatureActionFightFriendly::handleFight(Creature& creature, GameEntity* en
             std::vector<Ogre::Vector3> path;
             creature.tileToVector3(result, path, true, 0.0);
             creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-            creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+            creature.pushAction<CreatureActionWalkToTile>(creature);
             return false;
         }
     }
@@ -27,14 +27,10 @@
 #include "rooms/RoomDormitory.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
-#include <functional>
-
-std::function<bool()> CreatureActionFindHome::action()
+bool CreatureActionFindHome::action()
 {
-    return std::bind(&CreatureActionFindHome::handleFindHome,
-        std::ref(mCreature), mForced);
+    return handleFindHome(mCreature, mForced);
 }
 
 bool CreatureActionFindHome::handleFindHome(Creature& creature, bool forced)
@@ -99,7 +95,8 @@ bool CreatureActionFindHome::handleFindHome(Creature& creature, bool forced)
     }
 
     // Check to see if we can walk to a dormitory that does have an open tile.
-    std::vector<Room*> tempRooms = creature.getGameMap()->getRoomsByTypeAndSeat(RoomType::dormitory, creature.getSeat());
+    std::vector<Room*> tempRooms;
+    creature.getSeat()->getRoomAvailabilityIndex().getAvailableRooms(RoomType::dormitory, RoomAvailability::bed, tempRooms);
     std::vector<Tile*> availableDormitories;
     for (Room* room : tempRooms)
     {
@@ -140,6 +137,6 @@ bool CreatureActionFindHome::handleFindHome(Creature& creature, bool forced)
     std::vector<Ogre::Vector3> path;
     creature.tileToVector3(tempPath, path, true, 0.0);
     creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-    creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+    creature.pushAction<CreatureActionWalkToTile>(creature);
     return false;
 }
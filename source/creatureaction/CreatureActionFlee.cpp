@@ -24,15 +24,13 @@
 #include "rooms/RoomType.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
 static const int NB_TURN_FLEE_MAX = 5;
 
-std::function<bool()> CreatureActionFlee::action()
+bool CreatureActionFlee::action()
 {
-    return std::bind(&CreatureActionFlee::handleFlee,
-        std::ref(mCreature), getNbTurns());
+    return handleFlee(mCreature, getNbTurns());
 }
 
 bool CreatureActionFlee::handleFlee(Creature& creature, int32_t nbTurns)
@@ -69,7 +67,7 @@ bool CreatureActionFlee::handleFlee(Creature& creature, int32_t nbTurns)
             std::vector<Ogre::Vector3> path;
             creature.tileToVector3(result, path, true, 0.0);
             creature.setWalkPath(EntityAnimation::flee_anim, EntityAnimation::idle_anim, true, true, path);
-            creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+            creature.pushAction<CreatureActionWalkToTile>(creature);
             return false;
         }
     }
@@ -33,7 +33,7 @@ public:
     CreatureActionType getType() const override
     { return CreatureActionType::flee; }
 
-    std::function<bool()> action() override;
+    bool action() override;
 
     static bool handleFlee(Creature& creature, int32_t nbTurns);
 };
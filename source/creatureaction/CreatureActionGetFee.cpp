@@ -28,13 +28,11 @@
 #include "rooms/Room.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
-std::function<bool()> CreatureActionGetFee::action()
+bool CreatureActionGetFee::action()
 {
-    return std::bind(&CreatureActionGetFee::handleGetFee,
-        std::ref(mCreature));
+    return handleGetFee(mCreature);
 }
 
 bool CreatureActionGetFee::handleGetFee(Creature& creature)
@@ -75,12 +73,11 @@ bool CreatureActionGetFee::handleGetFee(Creature& creature)
     }
 
     // We try to go to some treasury were there is still some gold
+    std::vector<Room*> rooms;
+    creature.getSeat()->getRoomAvailabilityIndex().getAvailableRooms(RoomAvailability::goldStored, rooms);
     std::vector<Tile*> availableTreasuries;
-    for(Room* room : creature.getGameMap()->getRooms())
+    for(Room* room : rooms)
     {
-        if(room->getSeat() != creature.getSeat())
-            continue;
-
         if(room->getTotalGoldStored() <= 0)
             continue;
 
@@ -115,6 +112,6 @@ bool CreatureActionGetFee::handleGetFee(Creature& creature)
     std::vector<Ogre::Vector3> vectorPath;
     creature.tileToVector3(tilePath, vectorPath, true, 0.0);
     creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, vectorPath);
-    creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+    creature.pushAction<CreatureActionWalkToTile>(creature);
     return false;
 }
@@ -24,7 +24,6 @@
 #include "gamemap/GameMap.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
 CreatureActionGrabEntity::CreatureActionGrabEntity(Creature& creature, GameEntity& entityToCarry) :
     CreatureAction(creature),
@@ -43,10 +42,9 @@ CreatureActionGrabEntity::~CreatureActionGrabEntity()
     }
 }
 
-std::function<bool()> CreatureActionGrabEntity::action()
+bool CreatureActionGrabEntity::action()
 {
-    return std::bind(&CreatureActionGrabEntity::handleGrabEntity,
-        std::ref(mCreature), std::ref(mEntityToCarry));
+    return handleGrabEntity(mCreature, mEntityToCarry);
 }
 
 bool CreatureActionGrabEntity::handleGrabEntity(Creature& creature, GameEntity* entityToCarry)
@@ -120,7 +118,7 @@ bool CreatureActionGrabEntity::handleGrabEntity(Creature& creature, GameEntity*
     }
 
     creature.popAction();
-    creature.pushAction(Utils::make_unique<CreatureActionCarryEntity>(creature, *entityToCarry, *buildingWants));
+    creature.pushAction<CreatureActionCarryEntity>(creature, *entityToCarry, *buildingWants);
     return true;
 }
 
@@ -37,7 +37,7 @@ public:
     uint32_t updateMoodModifier() const override
     { return CreatureMoodValues::LeaveDungeon; }
 
-    std::function<bool()> action() override;
+    bool action() override;
 
     static bool handleLeaveDungeon(Creature& creature);
 };
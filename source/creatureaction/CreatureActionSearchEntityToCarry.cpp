@@ -20,13 +20,13 @@
 #include "creatureaction/CreatureActionGrabEntity.h"
 #include "entities/Building.h"
 #include "entities/Creature.h"
+#include "entities/CreatureDefinition.h"
 #include "entities/Tile.h"
 #include "game/Player.h"
 #include "game/Seat.h"
 #include "gamemap/GameMap.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
 CreatureActionSearchEntityToCarry::CreatureActionSearchEntityToCarry(Creature& creature, bool forced) :
@@ -41,10 +41,9 @@ CreatureActionSearchEntityToCarry::~CreatureActionSearchEntityToCarry()
     mCreature.getSeat()->getPlayer()->notifyWorkerStopsAction(mCreature, getType());
 }
 
-std::function<bool()> CreatureActionSearchEntityToCarry::action()
+bool CreatureActionSearchEntityToCarry::action()
 {
-    return std::bind(&CreatureActionSearchEntityToCarry::handleSearchEntityToCarry,
-        std::ref(mCreature), mForced);
+    return handleSearchEntityToCarry(mCreature, mForced);
 }
 
 bool CreatureActionSearchEntityToCarry::handleSearchEntityToCarry(Creature& creature, bool forced)
@@ -58,7 +57,11 @@ bool CreatureActionSearchEntityToCarry::handleSearchEntityToCarry(Creature& crea
     }
 
     std::vector<Building*> buildings = creature.getGameMap()->getReachableBuildingsPerSeat(creature.getSeat(), myTile, &creature);
-    std::vector<GameEntity*> carryableEntities = creature.getGameMap()->getCarryableEntities(&creature, creature.getTilesWithinSightRadius());
+    // We only look at the tiles with entities within our sight radius
+    std::vector<Tile*> candidates;
+    creature.getSeat()->getWorkerJobBoard().getCandidates(WorkerJobType::carry, *myTile,
+        creature.getDefinition()->getSightRadius(), candidates);
+    std::vector<GameEntity*> carryableEntities = creature.getGameMap()->getCarryableEntities(&creature, candidates);
     std::vector<Tile*> carryableEntityInMyTileClients;
     std::vector<GameEntity*> availableEntities;
     EntityCarryType highestPriority = EntityCarryType::notCarryable;
@@ -144,13 +147,13 @@ bool CreatureActionSearchEntityToCarry::handleSearchEntityToCarry(Creature& crea
     // If a carryable entity is in my tile, I take it
     if(carryableEntityInMyTile != nullptr)
     {
-        creature.pushAction(Utils::make_unique<CreatureActionGrabEntity>(creature, *carryableEntityInMyTile));
+        creature.pushAction<CreatureActionGrabEntity>(creature, *carryableEntityInMyTile);
         return true;
     }
 
     // We randomly choose one of the visible carryable entities
     uint32_t index = Random::Uint(0,availableEntities.size()-1);
     GameEntity* entity = availableEntities[index];
-    creature.pushAction(Utils::make_unique<CreatureActionGrabEntity>(creature, *entity));
+    creature.pushAction<CreatureActionGrabEntity>(creature, *entity);
     return true;
 }
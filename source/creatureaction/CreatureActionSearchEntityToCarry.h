@@ -29,7 +29,7 @@ public:
     CreatureActionType getType() const override
     { return CreatureActionType::searchEntityToCarry; }
 
-    std::function<bool()> action() override;
+    bool action() override;
 
     static bool handleSearchEntityToCarry(Creature& creature, bool forced);
 
@@ -31,13 +31,11 @@
 #include "utils/ConfigManager.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
-std::function<bool()> CreatureActionSearchFood::action()
+bool CreatureActionSearchFood::action()
 {
-    return std::bind(&CreatureActionSearchFood::handleSearchFood,
-        std::ref(mCreature), mForced);
+    return handleSearchFood(mCreature, mForced);
 }
 
 bool CreatureActionSearchFood::handleSearchFood(Creature& creature, bool forced)
@@ -89,13 +87,14 @@ bool CreatureActionSearchFood::handleSearchFood(Creature& creature, bool forced)
     // If we found a chicken, we go for it
     if(chickenClosest != nullptr)
     {
-        creature.pushAction(Utils::make_unique<CreatureActionEatChicken>(creature, *chickenClosest));
+        creature.pushAction<CreatureActionEatChicken>(creature, *chickenClosest);
         return true;
     }
 
     // We couldn't find a wandering chicken. We look for a room where we can eat
     // Get the list of hatchery controlled by our seat and make sure there is at least one.
-    std::vector<Room*> hatcheries = creature.getGameMap()->getRoomsByTypeAndSeat(RoomType::hatchery, creature.getSeat());
+    std::vector<Room*> hatcheries;
+    creature.getSeat()->getRoomAvailabilityIndex().getRooms(RoomType::hatchery, hatcheries);
     if (hatcheries.empty())
     {
         if((creature.getSeat()->getPlayer() != nullptr) &&
@@ -109,6 +108,8 @@ bool CreatureActionSearchFood::handleSearchFood(Creature& creature, bool forced)
     }
 
     // Pick a hatchery where we can eat and try to walk to it.
+    hatcheries.clear();
+    creature.getSeat()->getRoomAvailabilityIndex().getAvailableRooms(RoomType::hatchery, RoomAvailability::creatureSpot, hatcheries);
     std::vector<Tile*> hatcheriesTiles;
     for(Room* hatcheryRoom : hatcheries)
     {
@@ -163,6 +164,6 @@ bool CreatureActionSearchFood::handleSearchFood(Creature& creature, bool forced)
 
     // Now, we let the hatchery handle the creature
     creature.popAction();
-    creature.pushAction(Utils::make_unique<CreatureActionUseRoom>(creature, *chosenTile->getCoveringRoom(), forced));
+    creature.pushAction<CreatureActionUseRoom>(creature, *chosenTile->getCoveringRoom(), forced);
     return true;
 }
@@ -19,6 +19,7 @@
 
 #include "creatureaction/CreatureActionClaimGroundTile.h"
 #include "entities/Creature.h"
+#include "entities/CreatureDefinition.h"
 #include "entities/Tile.h"
 #include "game/Player.h"
 #include "game/Seat.h"
@@ -26,7 +27,6 @@
 #include "gamemap/Pathfinding.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
 CreatureActionSearchGroundTileToClaim::CreatureActionSearchGroundTileToClaim(Creature& creature, bool forced) :
     CreatureAction(creature),
@@ -40,10 +40,9 @@ CreatureActionSearchGroundTileToClaim::~CreatureActionSearchGroundTileToClaim()
     mCreature.getSeat()->getPlayer()->notifyWorkerStopsAction(mCreature, getType());
 }
 
-std::function<bool()> CreatureActionSearchGroundTileToClaim::action()
+bool CreatureActionSearchGroundTileToClaim::action()
 {
-    return std::bind(&CreatureActionSearchGroundTileToClaim::handleSearchGroundTileToClaim,
-        std::ref(mCreature), getNbTurns(), mForced);
+    return handleSearchGroundTileToClaim(mCreature, getNbTurns(), mForced);
 }
 
 bool CreatureActionSearchGroundTileToClaim::handleSearchGroundTileToClaim(Creature& creature, int32_t nbTurns, bool forced)
@@ -88,7 +87,7 @@ bool CreatureActionSearchGroundTileToClaim::handleSearchGroundTileToClaim(Creatu
             // We found a neighbor that is claimed for our side than we can start
             // dancing on this tile.  If there is "left over" claiming that can be done
             // it will spill over into neighboring tiles until it is gone.
-            creature.pushAction(Utils::make_unique<CreatureActionClaimGroundTile>(creature, *myTile));
+            creature.pushAction<CreatureActionClaimGroundTile>(creature, *myTile);
             return true;
         }
     }
@@ -120,15 +119,19 @@ bool CreatureActionSearchGroundTileToClaim::handleSearchGroundTileToClaim(Creatu
                 continue;
 
             // We lock the tile
-            creature.pushAction(Utils::make_unique<CreatureActionClaimGroundTile>(creature, *tile));
+            creature.pushAction<CreatureActionClaimGroundTile>(creature, *tile);
             return true;
         }
     }
 
-    // If we still haven't found a tile to claim, we try to take the closest one
+    // If we still haven't found a tile to claim, we try to take the closest one. The job board only gives
+    // the claimable tiles next to a claimed one within our sight radius
+    std::vector<Tile*> candidates;
+    creature.getSeat()->getWorkerJobBoard().getCandidates(WorkerJobType::claimGround, *myTile,
+        creature.getDefinition()->getSightRadius(), candidates);
     float distBest = -1;
     Tile* tileToClaim = nullptr;
-    for (Tile* tile : creature.getTilesWithinSightRadius())
+    for (Tile* tile : candidates)
     {
         // if this tile is not fully claimed yet or the tile is of another player's color
         if(tile == nullptr)
@@ -166,7 +169,7 @@ bool CreatureActionSearchGroundTileToClaim::handleSearchGroundTileToClaim(Creatu
     if(tileToClaim != nullptr)
     {
         // We lock the tile
-        creature.pushAction(Utils::make_unique<CreatureActionClaimGroundTile>(creature, *tileToClaim));
+        creature.pushAction<CreatureActionClaimGroundTile>(creature, *tileToClaim);
         return true;
     }
 
@@ -32,13 +32,11 @@
 #include "rooms/RoomType.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
-std::function<bool()> CreatureActionSearchJob::action()
+bool CreatureActionSearchJob::action()
 {
-    return std::bind(&CreatureActionSearchJob::handleSearchJob,
-        std::ref(mCreature), mForced);
+    return handleSearchJob(mCreature, mForced);
 }
 
 bool CreatureActionSearchJob::handleSearchJob(Creature& creature, bool forced)
@@ -83,7 +81,7 @@ bool CreatureActionSearchJob::handleSearchJob(Creature& creature, bool forced)
            (!creature.hasActionBeenTried(CreatureActionType::getFee)) &&
            (creature.getSeat()->getGold() > 0))
         {
-            creature.pushAction(Utils::make_unique<CreatureActionGetFee>(creature));
+            creature.pushAction<CreatureActionGetFee>(creature);
             return true;
         }
 
@@ -91,7 +89,7 @@ bool CreatureActionSearchJob::handleSearchJob(Creature& creature, bool forced)
         if (creature.isTired())
         {
             creature.popAction();
-            creature.pushAction(Utils::make_unique<CreatureActionSleep>(creature));
+            creature.pushAction<CreatureActionSleep>(creature);
             return true;
         }
 
@@ -99,7 +97,7 @@ bool CreatureActionSearchJob::handleSearchJob(Creature& creature, bool forced)
         if (creature.isHungry())
         {
             creature.popAction();
-            creature.pushAction(Utils::make_unique<CreatureActionSearchFood>(creature, false));
+            creature.pushAction<CreatureActionSearchFood>(creature, false);
             return true;
         }
     }
@@ -122,7 +120,7 @@ bool CreatureActionSearchJob::handleSearchJob(Creature& creature, bool forced)
             // It is the room responsibility to test if the creature is suited for working in it
             if(room->hasOpenCreatureSpot(&creature))
             {
-                creature.pushAction(Utils::make_unique<CreatureActionUseRoom>(creature, *room, forced));
+                creature.pushAction<CreatureActionUseRoom>(creature, *room, forced);
                 return false;
             }
             break;
@@ -160,26 +158,27 @@ bool CreatureActionSearchJob::handleSearchJob(Creature& creature, bool forced)
             // It is the room responsibility to test if the creature is suited for working in it
             if(room->hasOpenCreatureSpot(&creature))
             {
-                creature.pushAction(Utils::make_unique<CreatureActionUseRoom>(creature, *room, forced));
+                creature.pushAction<CreatureActionUseRoom>(creature, *room, forced);
                 return true;
             }
         }
 
         // We are not in a room of the good type or we couldn't use it. We check if there is a reachable room
         // of the good type
+        // If efficiency is 0, we just want to wander so no need to check if the room is available
+        std::vector<Room*> candidateRooms;
+        RoomAvailabilityIndex& roomIndex = creature.getSeat()->getRoomAvailabilityIndex();
+        if(affinity.getEfficiency() > 0)
+            roomIndex.getAvailableRooms(affinity.getRoomType(), RoomAvailability::creatureSpot, candidateRooms);
+        else
+            roomIndex.getRooms(affinity.getRoomType(), candidateRooms);
+
         std::vector<Tile*> rooms;
-        for(Room* room : creature.getGameMap()->getRooms())
+        for(Room* room : candidateRooms)
         {
-            if(room->getSeat() != creature.getSeat())
-                continue;
-
             if(room->numCoveredTiles() <= 0)
                 continue;
 
-            if(room->getType() != affinity.getRoomType())
-                continue;
-
-            // If efficiency is 0, we just want to wander so no need to check if the room is available
             if((affinity.getEfficiency() > 0) && !room->hasOpenCreatureSpot(&creature))
                 continue;
 
@@ -202,7 +201,7 @@ bool CreatureActionSearchJob::handleSearchJob(Creature& creature, bool forced)
         std::vector<Ogre::Vector3> vectorPath;
         creature.tileToVector3(tilePath, vectorPath, true, 0.0);
         creature.setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, vectorPath);
-        creature.pushAction(Utils::make_unique<CreatureActionWalkToTile>(creature));
+        creature.pushAction<CreatureActionWalkToTile>(creature);
         return false;
     }
 
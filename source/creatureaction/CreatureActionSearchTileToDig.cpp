@@ -20,6 +20,7 @@
 #include "creatureaction/CreatureActionDigTile.h"
 #include "creatureaction/CreatureActionGrabEntity.h"
 #include "entities/Creature.h"
+#include "entities/CreatureDefinition.h"
 #include "entities/Tile.h"
 #include "entities/TreasuryObject.h"
 #include "game/Player.h"
@@ -28,7 +29,6 @@
 #include "gamemap/Pathfinding.h"
 #include "rooms/Room.h"
 #include "utils/Helper.h"
-#include "utils/MakeUnique.h"
 #include "utils/LogManager.h"
 
 CreatureActionSearchTileToDig::CreatureActionSearchTileToDig(Creature& creature, bool forced) :
@@ -43,10 +43,9 @@ CreatureActionSearchTileToDig::~CreatureActionSearchTileToDig()
     mCreature.getSeat()->getPlayer()->notifyWorkerStopsAction(mCreature, getType());
 }
 
-std::function<bool()> CreatureActionSearchTileToDig::action()
+bool CreatureActionSearchTileToDig::action()
 {
-    return std::bind(&CreatureActionSearchTileToDig::handleSearchTileToDig,
-        std::ref(mCreature), getNbTurns(), mForced);
+    return handleSearchTileToDig(mCreature, getNbTurns(), mForced);
 }
 
 bool CreatureActionSearchTileToDig::handleSearchTileToDig(Creature& creature, int32_t nbTurns, bool forced)
@@ -75,6 +74,7 @@ bool CreatureActionSearchTileToDig::handleSearchTileToDig(Creature& creature, in
 
     // See if any of the tiles is one of our neighbors
     Player* tempPlayer = creature.getGameMap()->getPlayerBySeat(creature.getSeat());
+    std::vector<Tile*> tiles;
     for (Tile* tempTile : myTile->getAllNeighbors())
     {
         if (tempPlayer == nullptr)
@@ -84,7 +84,7 @@ bool CreatureActionSearchTileToDig::handleSearchTileToDig(Creature& creature, in
             continue;
 
         // Check if there is still empty space for digging the tile
-        std::vector<Tile*> tiles;
+        tiles.clear();
         tempTile->canWorkerDig(creature, tiles);
         if(tiles.empty())
             continue;
@@ -104,22 +104,25 @@ bool CreatureActionSearchTileToDig::handleSearchTileToDig(Creature& creature, in
             continue;
 
         // We found a tile marked by our controlling seat, dig out the tile.
-        creature.pushAction(Utils::make_unique<CreatureActionDigTile>(creature, *tempTile, *myTile));
+        creature.pushAction<CreatureActionDigTile>(creature, *tempTile, *myTile);
         return true;
     }
 
-    // Find the closest tile to dig
+    // Find the closest tile to dig. We only check the tiles marked for digging within our sight radius
+    std::vector<Tile*> candidates;
+    creature.getSeat()->getWorkerJobBoard().getCandidates(WorkerJobType::dig, *myTile,
+        creature.getDefinition()->getSightRadius(), candidates);
     float distBest = -1;
     Tile* tileToDig = nullptr;
     Tile* tilePos = nullptr;
-    for (Tile* tile : creature.getTilesWithinSightRadius())
+    for (Tile* tile : candidates)
     {
         // Check to see whether the tile is marked for digging
         if(!tile->getMarkedForDigging(tempPlayer))
             continue;
 
         // and there is still room to work on it
-        std::vector<Tile*> tiles;
+        tiles.clear();
         tile->canWorkerDig(creature, tiles);
         if(tiles.empty())
             continue;
@@ -143,7 +146,7 @@ bool CreatureActionSearchTileToDig::handleSearchTileToDig(Creature& creature, in
     if((tileToDig != nullptr) && (tilePos != nullptr))
     {
         // We also push the dig action to lock the tile to make sure not every worker will try to go to the same tile
-        creature.pushAction(Utils::make_unique<CreatureActionDigTile>(creature, *tileToDig, *tilePos));
+        creature.pushAction<CreatureActionDigTile>(creature, *tileToDig, *tilePos);
         return true;
     }
 
@@ -160,11 +163,10 @@ bool CreatureActionSearchTileToDig::handleSearchTileToDig(Creature& creature, in
         obj->setPosition(pos);
 
         bool isTreasuryAvailable = false;
-        for(Room* room : creature.getGameMap()->getRooms())
+        std::vector<Room*> rooms;
+        creature.getSeat()->getRoomAvailabilityIndex().getAvailableRooms(RoomAvailability::goldStorage, rooms);
+        for(Room* room : rooms)
         {
-            if(room->getSeat() != creature.getSeat())
-                continue;
-
             if(room->getTotalGoldStorage() <= 0)
                 continue;
 
@@ -185,7 +187,7 @@ bool CreatureActionSearchTileToDig::handleSearchTileToDig(Creature& creature, in
         {
             // We do not push CreatureActionType::searchEntityToCarry because we want
             // this worker to be count as digging, not as carrying stuff
-            creature.pushAction(Utils::make_unique<CreatureActionGrabEntity>(creature, *obj));
+            creature.pushAction<CreatureActionGrabEntity>(creature, *obj);
             return true;
         }
         else if(creature.getSeat()->getPlayer()->getIsHuman() &&
@@ -19,6 +19,7 @@
 
 #include "creatureaction/CreatureActionClaimWallTile.h"
 #include "entities/Creature.h"
+#include "entities/CreatureDefinition.h"
 #include "entities/Tile.h"
 #include "game/Player.h"
 #include "game/Seat.h"
@@ -26,7 +27,6 @@
 #include "gamemap/Pathfinding.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
 CreatureActionSearchWallTileToClaim::CreatureActionSearchWallTileToClaim(Creature& creature, bool forced) :
     CreatureAction(creature),
@@ -39,10 +39,9 @@ CreatureActionSearchWallTileToClaim::~CreatureActionSearchWallTileToClaim()
 {
     mCreature.getSeat()->getPlayer()->notifyWorkerStopsAction(mCreature, getType());
 }
-std::function<bool()> CreatureActionSearchWallTileToClaim::action()
+bool CreatureActionSearchWallTileToClaim::action()
 {
-    return std::bind(&CreatureActionSearchWallTileToClaim::handleSearchWallTileToClaim,
-        std::ref(mCreature), getNbTurns(), mForced);
+    return handleSearchWallTileToClaim(mCreature, getNbTurns(), mForced);
 }
 
 bool CreatureActionSearchWallTileToClaim::handleSearchWallTileToClaim(Creature& creature, int32_t nbTurns, bool forced)
@@ -80,14 +79,17 @@ bool CreatureActionSearchWallTileToClaim::handleSearchWallTileToClaim(Creature&
         if (!tile->canWorkerClaim(creature))
             continue;
 
-        creature.pushAction(Utils::make_unique<CreatureActionClaimWallTile>(creature, *tile));
+        creature.pushAction<CreatureActionClaimWallTile>(creature, *tile);
         return true;
     }
 
-    // Find paths to all of the neighbor tiles for all of the visible wall tiles.
+    // Find paths to all of the neighbor tiles for all of the claimable wall tiles within our sight radius.
+    std::vector<Tile*> candidates;
+    creature.getSeat()->getWorkerJobBoard().getCandidates(WorkerJobType::claimWall, *myTile,
+        creature.getDefinition()->getSightRadius(), candidates);
     float distBest = -1;
     Tile* tileToClaim = nullptr;
-    for(Tile* tile : creature.getTilesWithinSightRadius())
+    for(Tile* tile : candidates)
     {
         // Check to see whether the tile is a claimable wall
         if(tile->getMarkedForDigging(tempPlayer))
@@ -115,7 +117,7 @@ bool CreatureActionSearchWallTileToClaim::handleSearchWallTileToClaim(Creature&
     if(tileToClaim != nullptr)
     {
         // We also push the dig action to lock the tile to make sure not every worker will try to go to the same tile
-        creature.pushAction(Utils::make_unique<CreatureActionClaimWallTile>(creature, *tileToClaim));
+        creature.pushAction<CreatureActionClaimWallTile>(creature, *tileToClaim);
         return true;
     }
 
@@ -25,12 +25,10 @@
 #include "rooms/RoomDormitory.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
-std::function<bool()> CreatureActionSleep::action()
+bool CreatureActionSleep::action()
 {
-    return std::bind(&CreatureActionSleep::handleSleep,
-        std::ref(mCreature), getNbTurnsActive());
+    return handleSleep(mCreature, getNbTurnsActive());
 }
 
 bool CreatureActionSleep::handleSleep(Creature& creature, int32_t nbTurnsActive)
@@ -39,7 +37,7 @@ bool CreatureActionSleep::handleSleep(Creature& creature, int32_t nbTurnsActive)
     {
         if(!creature.hasActionBeenTried(CreatureActionType::findHome))
         {
-            creature.pushAction(Utils::make_unique<CreatureActionFindHome>(creature, false));
+            creature.pushAction<CreatureActionFindHome>(creature, false);
             return true;
         }
 
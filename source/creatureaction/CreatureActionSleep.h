@@ -33,7 +33,7 @@ public:
     CreatureActionType getType() const override
     { return CreatureActionType::sleep; }
 
-    std::function<bool()> action() override;
+    bool action() override;
 
     static bool handleSleep(Creature& creature, int32_t nbTurnsActive);
 };
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef CREATUREACTIONSTACK_H
+#define CREATUREACTIONSTACK_H
+
+#include "creatureaction/CreatureAction.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//! \brief Stack of the actions of a creature. The first actions are constructed in
+//! slots stored inline so that pushing/popping actions does not allocate. Actions
+//! pushed when every slot is used (or too big to fit in a slot) are allocated on
+//! the heap.
+class CreatureActionStack
+{
+public:
+    //! \brief Number of actions that can be stored inline
+    static const uint32_t NB_INLINE_ACTIONS = 8;
+    //! \brief Size of an inline slot. It should be big enough for every CreatureAction
+    static const size_t INLINE_ACTION_SIZE = 80;
+
+    CreatureActionStack() :
+        mInlineMask(0)
+    {
+        mActions.reserve(NB_INLINE_ACTIONS);
+    }
+
+    ~CreatureActionStack()
+    { clear(); }
+
+    //! \brief Constructs a new action on top of the stack with the given arguments
+    template<typename T, typename... Args>
+    T& emplace(Args&&... args)
+    {
+        uint32_t index = static_cast<uint32_t>(mActions.size());
+        T* action;
+        if((index < NB_INLINE_ACTIONS) &&
+           (sizeof(T) <= INLINE_ACTION_SIZE) &&
+           (alignof(T) <= alignof(Slot)))
+        {
+            action = new (&mSlots[index]) T(std::forward<Args>(args)...);
+            mInlineMask |= (1u << index);
+        }
+        else
+            action = new T(std::forward<Args>(args)...);
+
+        mActions.push_back(action);
+        return *action;
+    }
+
+    //! \brief Destroys the action on top of the stack. Note that the action may be the
+    //! one currently running. In that case, it should not use its members after this call.
+    void pop()
+    {
+        uint32_t index = static_cast<uint32_t>(mActions.size()) - 1;
+        CreatureAction* action = mActions.back();
+        mActions.pop_back();
+        if((mInlineMask & (1u << index)) == 0)
+        {
+            delete action;
+            return;
+        }
+
+        mInlineMask &= ~(1u << index);
+        action->~CreatureAction();
+    }
+
+    void clear()
+    {
+        while(!mActions.empty())
+            pop();
+    }
+
+    inline bool empty() const
+    { return mActions.empty(); }
+
+    inline size_t size() const
+    { return mActions.size(); }
+
+    inline CreatureAction* back() const
+    { return mActions.back(); }
+
+    inline std::vector<CreatureAction*>::const_iterator begin() const
+    { return mActions.begin(); }
+
+    inline std::vector<CreatureAction*>::const_iterator end() const
+    { return mActions.end(); }
+
+private:
+    typedef std::aligned_storage<INLINE_ACTION_SIZE, alignof(std::max_align_t)>::type Slot;
+
+    CreatureActionStack(const CreatureActionStack&) = delete;
+    CreatureActionStack& operator=(const CreatureActionStack&) = delete;
+
+    Slot mSlots[NB_INLINE_ACTIONS];
+    //! \brief Bit i is set if the action at index i is stored in mSlots[i]
+    uint32_t mInlineMask;
+    //! \brief Actions from the bottom to the top of the stack
+    std::vector<CreatureAction*> mActions;
+};
+
+#endif // CREATUREACTIONSTACK_H
@@ -30,10 +30,9 @@
 // for high tier/level creatures
 const int GOLD_STEAL = 500;
 
-std::function<bool()> CreatureActionStealFreeGold::action()
+bool CreatureActionStealFreeGold::action()
 {
-    return std::bind(&CreatureActionStealFreeGold::handleStealFreeGold,
-        std::ref(mCreature));
+    return handleStealFreeGold(mCreature);
 }
 
 bool CreatureActionStealFreeGold::handleStealFreeGold(Creature& creature)
@@ -27,7 +27,6 @@
 #include "rooms/Room.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
 CreatureActionUseRoom::CreatureActionUseRoom(Creature& creature, Room& room, bool forced) :
@@ -56,10 +55,9 @@ CreatureActionUseRoom::~CreatureActionUseRoom()
     }
 }
 
-std::function<bool()> CreatureActionUseRoom::action()
+bool CreatureActionUseRoom::action()
 {
-    return std::bind(&CreatureActionUseRoom::handleJob,
-        std::ref(mCreature), mRoom, mForced);
+    return handleJob(mCreature, mRoom, mForced);
 }
 
 bool CreatureActionUseRoom::handleJob(Creature& creature, Room* room, bool forced)
@@ -139,14 +137,14 @@ bool CreatureActionUseRoom::handleJob(Creature& creature, Room* room, bool force
            (!creature.hasActionBeenTried(CreatureActionType::getFee)) &&
            (creature.getSeat()->getGold() > 0))
         {
-            creature.pushAction(Utils::make_unique<CreatureActionGetFee>(creature));
+            creature.pushAction<CreatureActionGetFee>(creature);
             return true;
         }
 
         if (creature.isTired())
         {
             creature.popAction();
-            creature.pushAction(Utils::make_unique<CreatureActionSleep>(creature));
+            creature.pushAction<CreatureActionSleep>(creature);
             return true;
         }
 
@@ -154,7 +152,7 @@ bool CreatureActionUseRoom::handleJob(Creature& creature, Room* room, bool force
         if (creature.isHungry())
         {
             creature.popAction();
-            creature.pushAction(Utils::make_unique<CreatureActionSearchFood>(creature, false));
+            creature.pushAction<CreatureActionSearchFood>(creature, false);
             return true;
         }
     }
@@ -32,7 +32,7 @@ public:
     CreatureActionType getType() const override
     { return CreatureActionType::useRoom; }
 
-    std::function<bool()> action() override;
+    bool action() override;
 
     std::string getListenerName() const override;
     bool notifyDead(GameEntity* entity) override;
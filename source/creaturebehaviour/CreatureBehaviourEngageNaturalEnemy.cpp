@@ -48,7 +48,8 @@ class CreatureBehaviourFactoryEngageNaturalEnemy : public CreatureBehaviourFacto
 static CreatureBehaviourRegister reg(new CreatureBehaviourFactoryEngageNaturalEnemy);
 }
 
-CreatureBehaviourEngageNaturalEnemy::CreatureBehaviourEngageNaturalEnemy(const CreatureBehaviourEngageNaturalEnemy& behaviour)
+CreatureBehaviourEngageNaturalEnemy::CreatureBehaviourEngageNaturalEnemy(const CreatureBehaviourEngageNaturalEnemy& behaviour) :
+    mNaturalEnemyClassIds(behaviour.mNaturalEnemyClassIds)
 {
     for(const std::string& str : behaviour.mNaturalEnemyClasses)
     {
@@ -83,9 +84,10 @@ bool CreatureBehaviourEngageNaturalEnemy::processBehaviour(Creature& creature) c
 
         Creature* alliedCreature = static_cast<Creature*>(entity);
         // Check if the given creature is a natural enemy
-        for(const std::string& enemyClass : mNaturalEnemyClasses)
+        uint32_t classId = alliedCreature->getDefinition()->getClassId();
+        for(uint32_t enemyClassId : mNaturalEnemyClassIds)
         {
-            if(alliedCreature->getDefinition()->getClassName().compare(enemyClass) != 0)
+            if(classId != enemyClassId)
                 continue;
 
             alliedNaturalEnemies.push_back(alliedCreature);
@@ -160,6 +162,7 @@ bool CreatureBehaviourEngageNaturalEnemy::importFromStream(std::istream& is)
             return false;
 
         mNaturalEnemyClasses.push_back(str);
+        mNaturalEnemyClassIds.push_back(CreatureDefinition::getClassIdFromName(str));
     }
 
     return true;
@@ -50,6 +50,8 @@ private:
     CreatureBehaviourEngageNaturalEnemy(const CreatureBehaviourEngageNaturalEnemy& behaviour);
 
     std::vector<std::string> mNaturalEnemyClasses;
+    //! \brief Interned ids of mNaturalEnemyClasses
+    std::vector<uint32_t> mNaturalEnemyClassIds;
 };
 
 #endif // CREATUREBEHAVIOURENGAGENATURALENEMY_H
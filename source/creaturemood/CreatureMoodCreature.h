@@ -28,6 +28,7 @@ class CreatureMoodCreature : public CreatureMood
 {
 public:
     CreatureMoodCreature() :
+        mCreatureClassId(0),
         mMoodModifier(0)
     {}
 
@@ -45,6 +46,8 @@ public:
 
 private:
     std::string mCreatureClass;
+    //! \brief Interned id of mCreatureClass
+    uint32_t mCreatureClassId;
     int32_t mMoodModifier;
 };
 
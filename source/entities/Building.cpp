@@ -437,7 +437,11 @@ bool Building::importFromStream(std::istream& is)
         }
 
         if(tileData->mHP > 0)
+        {
+            Seat* oldClaimedSeat = tile->getClaimedSeat();
             tile->setSeat(getSeat());
+            tile->updateClaimedSeat(oldClaimedSeat);
+        }
     }
 
     return true;
@@ -58,6 +58,7 @@
 #include "gamemap/GameMap.h"
 #include "gamemap/Pathfinding.h"
 #include "giftboxes/GiftBoxSkill.h"
+#include "goals/Goal.h"
 #include "network/ODClient.h"
 #include "network/ODServer.h"
 #include "network/ServerNotification.h"
@@ -72,7 +73,6 @@
 #include "utils/ConfigManager.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
 #include <CEGUI/Event.h>
@@ -171,7 +171,9 @@ Creature::Creature(GameMap* gameMap, const CreatureDefinition* definition, Seat*
     mSeatPrison              (nullptr),
     mNbTurnsTorture          (0),
     mNbTurnsPrison           (0),
-    mActiveSlapsCount        (0)
+    mActiveSlapsCount        (0),
+    mIsInCreaturesList       (false),
+    mAliveCountersSeat       (nullptr)
 
 {
     //TODO: This should be set in initialiser list in parent classes
@@ -249,7 +251,9 @@ Creature::Creature(GameMap* gameMap) :
     mSeatPrison              (nullptr),
     mNbTurnsTorture          (0),
     mNbTurnsPrison           (0),
-    mActiveSlapsCount        (0)
+    mActiveSlapsCount        (0),
+    mIsInCreaturesList       (false),
+    mAliveCountersSeat       (nullptr)
 {
 }
 
@@ -521,8 +525,10 @@ Creature* Creature::getCreatureFromPacket(GameMap* gameMap, ODPacket& is)
 void Creature::exportToPacket(ODPacket& os, const Seat* seat) const
 {
     MovableGameEntity::exportToPacket(os, seat);
-    const std::string& className = mDefinition->getClassName();
-    os << className;
+    // Definitions and weapons are sent by index. The client got them in the same order when
+    // the game started. -1 means the default worker definition or no weapon
+    int32_t definitionIndex = getGameMap()->getClassDescriptionIndex(mDefinition);
+    os << definitionIndex;
     os << mLevel;
     os << mExp;
 
@@ -558,23 +564,31 @@ void Creature::exportToPacket(ODPacket& os, const Seat* seat) const
     os << moodValue;
     os << mSpeedModifier;
 
+    int32_t weaponIndex = -1;
     if(mWeaponL != nullptr)
-        os << mWeaponL->getName();
-    else
-        os << "none";
+        weaponIndex = getGameMap()->getWeaponIndex(mWeaponL);
+    os << weaponIndex;
 
+    weaponIndex = -1;
     if(mWeaponR != nullptr)
-        os << mWeaponR->getName();
-    else
-        os << "none";
+        weaponIndex = getGameMap()->getWeaponIndex(mWeaponR);
+    os << weaponIndex;
 }
 
 void Creature::importFromPacket(ODPacket& is)
 {
     MovableGameEntity::importFromPacket(is);
-    std::string tempString;
+    int32_t index;
 
-    OD_ASSERT_TRUE(is >> mDefinitionString);
+    OD_ASSERT_TRUE(is >> index);
+    if(index >= 0)
+    {
+        mDefinition = getGameMap()->getClassDescription(index);
+        if(mDefinition == nullptr)
+        {
+            OD_LOG_ERR("Unknown definition index=" + Helper::toString(index));
+        }
+    }
 
     OD_ASSERT_TRUE(is >> mLevel);
     OD_ASSERT_TRUE(is >> mExp);
@@ -599,23 +613,23 @@ void Creature::importFromPacket(ODPacket& is)
     OD_ASSERT_TRUE(is >> mOverlayMoodValue);
     OD_ASSERT_TRUE(is >> mSpeedModifier);
 
-    OD_ASSERT_TRUE(is >> tempString);
-    if(tempString != "none")
+    OD_ASSERT_TRUE(is >> index);
+    if(index >= 0)
     {
-        mWeaponL = getGameMap()->getWeapon(tempString);
+        mWeaponL = getGameMap()->getWeapon(index);
         if(mWeaponL == nullptr)
         {
-            OD_LOG_ERR("Unknown weapon name=" + tempString);
+            OD_LOG_ERR("Unknown weapon index=" + Helper::toString(index));
         }
     }
 
-    OD_ASSERT_TRUE(is >> tempString);
-    if(tempString != "none")
+    OD_ASSERT_TRUE(is >> index);
+    if(index >= 0)
     {
-        mWeaponR = getGameMap()->getWeapon(tempString);
+        mWeaponR = getGameMap()->getWeapon(index);
         if(mWeaponR == nullptr)
         {
-            OD_LOG_ERR("Unknown weapon name=" + tempString);
+            OD_LOG_ERR("Unknown weapon index=" + Helper::toString(index));
         }
     }
 
@@ -991,21 +1005,21 @@ void Creature::doUpkeep()
         }
         else
         {
-            CreatureAction* act = mActions.back().get();
-            // We save the action type here because the action may be removed after calling
-            // the action function
+            CreatureAction* act = mActions.back();
+            // We save the action type here because the action may be removed while running
             CreatureActionType actType = act->getType();
-            std::function<bool()> func = act->action();
-            loopBack = func();
+            loopBack = act->action();
             OD_LOG_DBG("creature=" + getName() + " trying action=" + CreatureAction::toString(actType) + ", result=" + std::string(loopBack?"1":"0"));
         }
     } while (loopBack && loops < 20);
 
     if(!mActions.empty())
-        mActions.back().get()->increaseNbTurnActive();
+        mActions.back()->increaseNbTurnActive();
 
-    for(std::unique_ptr<CreatureAction>& creatureAction : mActions)
-        creatureAction.get()->increaseNbTurn();
+    for(CreatureAction* creatureAction : mActions)
+        creatureAction->increaseNbTurn();
+
+    getGameMap()->increaseNumCreatureActionSteps(loops);
 
     if(loops >= 20)
     {
@@ -1039,16 +1053,16 @@ bool Creature::handleIdleAction()
             switch(actionType)
             {
                 case CreatureActionType::searchEntityToCarry:
-                    pushAction(Utils::make_unique<CreatureActionSearchEntityToCarry>(*this, false));
+                    pushAction<CreatureActionSearchEntityToCarry>(*this, false);
                     return true;
                 case CreatureActionType::searchGroundTileToClaim:
-                    pushAction(Utils::make_unique<CreatureActionSearchGroundTileToClaim>(*this, false));
+                    pushAction<CreatureActionSearchGroundTileToClaim>(*this, false);
                     return true;
                 case CreatureActionType::searchTileToDig:
-                    pushAction(Utils::make_unique<CreatureActionSearchTileToDig>(*this, false));
+                    pushAction<CreatureActionSearchTileToDig>(*this, false);
                     return true;
                 case CreatureActionType::searchWallTileToClaim:
-                    pushAction(Utils::make_unique<CreatureActionSearchWallTileToClaim>(*this, false));
+                    pushAction<CreatureActionSearchWallTileToClaim>(*this, false);
                     return true;
                 default:
                     OD_LOG_ERR("name=" + getName() + ", unexpected worker action=" + CreatureAction::toString(actionType));
@@ -1062,7 +1076,7 @@ bool Creature::handleIdleAction()
        !hasActionBeenTried(CreatureActionType::getFee) &&
        (mGoldFee > 0))
     {
-        pushAction(Utils::make_unique<CreatureActionGetFee>(*this));
+        pushAction<CreatureActionGetFee>(*this);
         return true;
     }
 
@@ -1099,7 +1113,7 @@ bool Creature::handleIdleAction()
                 std::vector<Ogre::Vector3> path;
                 tileToVector3(tempPath, path, true, 0.0);
                 setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-                pushAction(Utils::make_unique<CreatureActionGoCallToWar>(*this));
+                pushAction<CreatureActionGoCallToWar>(*this);
                 return false;
             }
         }
@@ -1112,7 +1126,7 @@ bool Creature::handleIdleAction()
         (mHomeTile == nullptr) &&
         (Random::Double(0.0, 1.0) < 0.5))
     {
-        pushAction(Utils::make_unique<CreatureActionFindHome>(*this, false));
+        pushAction<CreatureActionFindHome>(*this, false);
         return true;
     }
 
@@ -1122,7 +1136,7 @@ bool Creature::handleIdleAction()
         (mHomeTile != nullptr) &&
         (Random::Double(20.0, 30.0) > mWakefulness))
     {
-        pushAction(Utils::make_unique<CreatureActionSleep>(*this));
+        pushAction<CreatureActionSleep>(*this);
         return true;
     }
 
@@ -1131,7 +1145,7 @@ bool Creature::handleIdleAction()
         !hasActionBeenTried(CreatureActionType::searchFood) &&
         (Random::Double(70.0, 80.0) < mHunger))
     {
-        pushAction(Utils::make_unique<CreatureActionSearchFood>(*this, false));
+        pushAction<CreatureActionSearchFood>(*this, false);
         return true;
     }
 
@@ -1142,7 +1156,7 @@ bool Creature::handleIdleAction()
         !hasActionBeenTried(CreatureActionType::stealFreeGold) &&
         (Random::Uint(0, 10) > 8))
     {
-        pushAction(Utils::make_unique<CreatureActionStealFreeGold>(*this));
+        pushAction<CreatureActionStealFreeGold>(*this);
         return true;
     }
 
@@ -1151,7 +1165,7 @@ bool Creature::handleIdleAction()
         !hasActionBeenTried(CreatureActionType::searchJob) &&
         (Random::Double(0.0, 1.0) < 0.4))
     {
-        pushAction(Utils::make_unique<CreatureActionSearchJob>(*this, false));
+        pushAction<CreatureActionSearchJob>(*this, false);
         return true;
     }
 
@@ -1718,7 +1732,7 @@ void Creature::computeVisualDebugEntities()
 
     updateTilesInSight();
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::refreshCreatureVisDebug, nullptr);
 
     const std::string& name = getName();
@@ -1782,7 +1796,7 @@ void Creature::stopComputeVisualDebugEntities()
 
     mHasVisualDebuggingEntities = false;
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::refreshCreatureVisDebug, nullptr);
     const std::string& name = getName();
     serverNotification->mPacket << name;
@@ -1943,9 +1957,9 @@ std::string Creature::getStatsText()
     tempSS << "Seat and team IDs: " << getSeat()->getId() << " / " << getSeat()->getTeamId() << std::endl;
     tempSS << "Position: " << Helper::toString(getPosition()) << std::endl;
     tempSS << "Actions:";
-    for(const std::unique_ptr<CreatureAction>& ca : mActions)
+    for(const CreatureAction* ca : mActions)
     {
-        tempSS << " " << CreatureAction::toString(ca.get()->getType());
+        tempSS << " " << CreatureAction::toString(ca->getType());
     }
     tempSS << std::endl;
     tempSS << "Destinations:";
@@ -1985,7 +1999,10 @@ double Creature::takeDamage(GameEntity* attacker, double absoluteDamage, double
     computeCreatureOverlayMoodValue();
 
     if(!isAlive())
+    {
+        getGameMap()->notifyGoalStateChanged(GoalDependency::creatures);
         fireEntityDead();
+    }
 
     if(!getIsOnServerMap())
         return damageDone;
@@ -2056,9 +2073,9 @@ void Creature::useAttack(CreatureSkillData& skillData, GameEntity& entityAttack,
 
 bool Creature::isActionInList(CreatureActionType action) const
 {
-    for (const std::unique_ptr<CreatureAction>& ca : mActions)
+    for (const CreatureAction* ca : mActions)
     {
-        if (ca.get()->getType() == action)
+        if (ca->getType() == action)
             return true;
     }
     return false;
@@ -2077,15 +2094,12 @@ bool Creature::hasActionBeenTried(CreatureActionType actionType) const
     return true;
 }
 
-void Creature::pushAction(std::unique_ptr<CreatureAction>&& action)
+void Creature::addActionTry(CreatureActionType actionType)
 {
-    CreatureActionType actionType = action.get()->getType();
     if(std::find(mActionTry.begin(), mActionTry.end(), actionType) == mActionTry.end())
     {
         mActionTry.push_back(actionType);
     }
-
-    mActions.emplace_back(std::move(action));
 }
 
 void Creature::popAction()
@@ -2096,7 +2110,7 @@ void Creature::popAction()
         return;
     }
 
-    mActions.pop_back();
+    mActions.pop();
 }
 
 bool Creature::tryPickup(Seat* seat)
@@ -2274,8 +2288,8 @@ void Creature::drop(const Ogre::Vector3& v)
         // Now, we can decide
         if((tileMarkedDig != nullptr) && (tileMarkedDigPos != nullptr) && (mDigRate > 0.0))
         {
-            pushAction(Utils::make_unique<CreatureActionSearchTileToDig>(*this, true));
-            pushAction(Utils::make_unique<CreatureActionDigTile>(*this, *tileMarkedDig, *tileMarkedDigPos));
+            pushAction<CreatureActionSearchTileToDig>(*this, true);
+            pushAction<CreatureActionDigTile>(*this, *tileMarkedDig, *tileMarkedDigPos);
             return;
         }
 
@@ -2291,21 +2305,21 @@ void Creature::drop(const Ogre::Vector3& v)
                 entityToCarry = entity;
             }
 
-            pushAction(Utils::make_unique<CreatureActionGrabEntity>(*this, *entityToCarry));
+            pushAction<CreatureActionGrabEntity>(*this, *entityToCarry);
             return;
         }
 
         if((tileToClaim != nullptr) && (mClaimRate > 0.0))
         {
-            pushAction(Utils::make_unique<CreatureActionSearchGroundTileToClaim>(*this, true));
-            pushAction(Utils::make_unique<CreatureActionClaimGroundTile>(*this, *tileToClaim));
+            pushAction<CreatureActionSearchGroundTileToClaim>(*this, true);
+            pushAction<CreatureActionClaimGroundTile>(*this, *tileToClaim);
             return;
         }
 
         if((tileWallNotClaimed != nullptr) && (mClaimRate > 0.0))
         {
-            pushAction(Utils::make_unique<CreatureActionSearchWallTileToClaim>(*this, true));
-            pushAction(Utils::make_unique<CreatureActionClaimWallTile>(*this, *tileWallNotClaimed));
+            pushAction<CreatureActionSearchWallTileToClaim>(*this, true);
+            pushAction<CreatureActionClaimWallTile>(*this, *tileWallNotClaimed);
             return;
         }
 
@@ -2346,7 +2360,7 @@ bool Creature::setDestination(Tile* tile)
     std::vector<Ogre::Vector3> path;
     tileToVector3(result, path, true, 0.0);
     setWalkPath(EntityAnimation::walk_anim, EntityAnimation::idle_anim, true, true, path);
-    pushAction(Utils::make_unique<CreatureActionWalkToTile>(*this));
+    pushAction<CreatureActionWalkToTile>(*this);
     return true;
 }
 
@@ -2459,7 +2473,7 @@ void Creature::releaseCarriedEntity()
         if(!seat->getPlayer()->getIsHuman())
             continue;
 
-        ServerNotification* serverNotification = new ServerNotification(
+        ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::releaseCarriedEntity, seat->getPlayer());
         serverNotification->mPacket << getName() << carriedEntity->getObjectType();
         serverNotification->mPacket << carriedEntity->getName();
@@ -2536,7 +2550,7 @@ void Creature::fireAddEntity(Seat* seat, bool async)
         return;
     }
 
-    ServerNotification* serverNotification = new ServerNotification(
+    ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::addEntity, seat->getPlayer());
     exportHeadersToPacket(serverNotification->mPacket);
     exportToPacket(serverNotification->mPacket, seat);
@@ -2546,7 +2560,7 @@ void Creature::fireAddEntity(Seat* seat, bool async)
     {
         mCarriedEntity->addSeatWithVision(seat, false);
 
-        serverNotification = new ServerNotification(
+        serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::carryEntity, seat->getPlayer());
         serverNotification->mPacket << getName() << mCarriedEntity->getObjectType();
         serverNotification->mPacket << mCarriedEntity->getName();
@@ -2559,7 +2573,7 @@ void Creature::fireRemoveEntity(Seat* seat)
     // If we are carrying an entity, we release it first, then we can remove it and us
     if(mCarriedEntity != nullptr)
     {
-        ServerNotification* serverNotification = new ServerNotification(
+        ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::releaseCarriedEntity, seat->getPlayer());
         serverNotification->mPacket << getName() << mCarriedEntity->getObjectType();
         serverNotification->mPacket << mCarriedEntity->getName();
@@ -2570,7 +2584,7 @@ void Creature::fireRemoveEntity(Seat* seat)
     }
 
     const std::string& name = getName();
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::removeEntity, seat->getPlayer());
     GameEntityType type = getObjectType();
     serverNotification->mPacket << type;
@@ -2592,7 +2606,7 @@ void Creature::fireCreatureRefreshIfNeeded()
             continue;
 
         const std::string& name = getName();
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::entitiesRefresh, seat->getPlayer());
         uint32_t nbCreature = 1;
         serverNotification->mPacket << nbCreature;
@@ -2612,7 +2626,7 @@ void Creature::fireChatMsgTookFee(int goldTaken)
     if(getSeat()->getPlayer()->getHasLost())
         return;
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::chatServer, getSeat()->getPlayer());
     std::string msg;
     // We don't display the same message if we have taken all our fee or only a part of it
@@ -2634,7 +2648,7 @@ void Creature::fireChatMsgLeftDungeon()
     if(getSeat()->getPlayer()->getHasLost())
         return;
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::chatServer, getSeat()->getPlayer());
     std::string msg = getName() + " left your dungeon";
     serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
@@ -2650,7 +2664,7 @@ void Creature::fireChatMsgLeavingDungeon()
     if(getSeat()->getPlayer()->getHasLost())
         return;
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::chatServer, getSeat()->getPlayer());
     std::string msg = getName() + " is leaving your dungeon";
     serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
@@ -2666,7 +2680,7 @@ void Creature::fireChatMsgBecameRogue()
     if(getSeat()->getPlayer()->getHasLost())
         return;
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::chatServer, getSeat()->getPlayer());
     std::string msg = getName() + " is not under your control anymore !";
     serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
@@ -2682,7 +2696,7 @@ void Creature::fireChatMsgUnhappy()
     if(getSeat()->getPlayer()->getHasLost())
         return;
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::chatServer, getSeat()->getPlayer());
     std::string msg = getName() + " is unhappy !";
     serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
@@ -2698,7 +2712,7 @@ void Creature::fireChatMsgFurious()
     if(getSeat()->getPlayer()->getHasLost())
         return;
 
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::chatServer, getSeat()->getPlayer());
     std::string msg = getName() + " is furious !";
     serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
@@ -2808,7 +2822,7 @@ void Creature::fireCreatureSound(CreatureSound sound)
         if(!seat->getPlayer()->getIsHuman())
             continue;
 
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::playSpatialSound, seat->getPlayer());
         serverNotification->mPacket << soundComplete << posTile->getX() << posTile->getY();
         ODServer::getSingleton().queueServerNotification(serverNotification);
@@ -2842,6 +2856,7 @@ void Creature::decreaseWakefulness(double value)
 
 void Creature::computeMood()
 {
+    countVisibleAlliedCreatures();
     mMoodPoints = CreatureMoodManager::computeCreatureMoodModifiers(*this);
 
     CreatureMoodLevel oldMoodValue = mMoodValue;
@@ -2863,6 +2878,26 @@ void Creature::computeMood()
     }
 }
 
+void Creature::countVisibleAlliedCreatures()
+{
+    std::fill(mNbVisibleAlliedCreaturesByClass.begin(), mNbVisibleAlliedCreaturesByClass.end(), 0);
+    for(GameEntity* entity : mVisibleAlliedObjects)
+    {
+        if(entity->getObjectType() != GameEntityType::creature)
+            continue;
+
+        if(entity == this)
+            continue;
+
+        Creature* alliedCreature = static_cast<Creature*>(entity);
+        uint32_t classId = alliedCreature->getDefinition()->getClassId();
+        if(classId >= mNbVisibleAlliedCreaturesByClass.size())
+            mNbVisibleAlliedCreaturesByClass.resize(classId + 1, 0);
+
+        ++mNbVisibleAlliedCreaturesByClass[classId];
+    }
+}
+
 void Creature::computeCreatureOverlayHealthValue()
 {
     if(!getIsOnServerMap())
@@ -2893,9 +2928,39 @@ void Creature::computeCreatureOverlayHealthValue()
     {
         mOverlayHealthValue = value;
         mNeedFireRefresh = true;
+
+        // The creature may have died or come back to life
+        updateAliveCounters();
     }
 }
 
+void Creature::setIsInCreaturesList(bool isInCreaturesList)
+{
+    mIsInCreaturesList = isInCreaturesList;
+    updateAliveCounters();
+}
+
+void Creature::updateAliveCounters()
+{
+    if(!getIsOnServerMap())
+        return;
+
+    Seat* seat = nullptr;
+    if(mIsInCreaturesList && isAlive())
+        seat = getSeat();
+
+    if(seat == mAliveCountersSeat)
+        return;
+
+    if(mAliveCountersSeat != nullptr)
+        mAliveCountersSeat->removeAliveCreature(mDefinition);
+
+    if(seat != nullptr)
+        seat->addAliveCreature(mDefinition);
+
+    mAliveCountersSeat = seat;
+}
+
 void Creature::computeCreatureOverlayMoodValue()
 {
     if(!getIsOnServerMap())
@@ -2918,8 +2983,8 @@ void Creature::computeCreatureOverlayMoodValue()
         }
 
         // We update the mood bit array according to actions in the list
-        for (const std::unique_ptr<CreatureAction>& ca : mActions)
-            value |= ca.get()->updateMoodModifier();
+        for (const CreatureAction* ca : mActions)
+            value |= ca->updateMoodModifier();
 
         if(mKoTurnCounter < 0)
             value |= CreatureMoodValues::KoDeath;
@@ -3184,35 +3249,35 @@ void Creature::fight()
     clearDestinations(EntityAnimation::idle_anim, true, true);
     clearActionQueue();
     bool ko = getSeat()->getKoCreatures();
-    pushAction(Utils::make_unique<CreatureActionFight>(*this, nullptr, ko, true));
+    pushAction<CreatureActionFight>(*this, nullptr, ko, true);
 }
 
 void Creature::fightCreature(Creature& creature, bool ko, bool notifyPlayerIfHit)
 {
     clearDestinations(EntityAnimation::idle_anim, true, true);
     clearActionQueue();
-    pushAction(Utils::make_unique<CreatureActionFight>(*this, &creature, ko, notifyPlayerIfHit));
+    pushAction<CreatureActionFight>(*this, &creature, ko, notifyPlayerIfHit);
 }
 
 void Creature::flee()
 {
     clearDestinations(EntityAnimation::idle_anim, true, true);
     clearActionQueue();
-    pushAction(Utils::make_unique<CreatureActionFlee>(*this));
+    pushAction<CreatureActionFlee>(*this);
 }
 
 void Creature::sleep()
 {
     clearDestinations(EntityAnimation::idle_anim, true, true);
     clearActionQueue();
-    pushAction(Utils::make_unique<CreatureActionSleep>(*this));
+    pushAction<CreatureActionSleep>(*this);
 }
 
 void Creature::leaveDungeon()
 {
     clearDestinations(EntityAnimation::idle_anim, true, true);
     clearActionQueue();
-    pushAction(Utils::make_unique<CreatureActionLeaveDungeon>(*this));
+    pushAction<CreatureActionLeaveDungeon>(*this);
 }
 
 void Creature::changeSeat(Seat* newSeat)
@@ -3220,6 +3285,8 @@ void Creature::changeSeat(Seat* newSeat)
     OD_LOG_INF("creature=" + getName() + " changes side from seatId=" + Helper::toString(getSeat()->getId()) + " to seatId=" + Helper::toString(newSeat->getId()));
     OD_ASSERT_TRUE_MSG(getSeat() != newSeat, "creature=" + getName() + ", seatId=" + Helper::toString(newSeat->getId()));
     setSeat(newSeat);
+    updateAliveCounters();
+    getGameMap()->notifyGoalStateChanged(GoalDependency::creatures);
     mMoodValue = CreatureMoodLevel::Neutral;
     mMoodPoints = 0;
     mWakefulness = 100;
@@ -21,6 +21,7 @@
 #ifndef CREATURE_H
 #define CREATURE_H
 
+#include "creatureaction/CreatureActionStack.h"
 #include "entities/MovableGameEntity.h"
 
 #include <OgreVector2.h>
@@ -32,7 +33,6 @@
 
 class Building;
 class Creature;
-class CreatureAction;
 class CreatureEffect;
 class CreatureDefinition;
 class CreatureOverlayStatus;
@@ -42,7 +42,6 @@ class ODPacket;
 class Room;
 class Weapon;
 
-enum class CreatureActionType;
 enum class CreatureMoodLevel;
 enum class SkillType;
 
@@ -410,7 +409,12 @@ public:
     inline const std::vector<GameEntity*>& getReachableAlliedObjects() const
     { return mReachableAlliedObjects; }
 
-    inline const std::vector<std::unique_ptr<CreatureAction>>& getActions() const
+    //! \brief Returns the number of visible allied creatures (not counting this one) of the given
+    //! class. The counts are computed once per mood update from the visible allied objects.
+    inline uint32_t getNbVisibleAlliedCreatures(uint32_t classId) const
+    { return classId < mNbVisibleAlliedCreaturesByClass.size() ? mNbVisibleAlliedCreaturesByClass[classId] : 0; }
+
+    inline const CreatureActionStack& getActions() const
     { return mActions; }
 
     inline double getWakefulness() const
@@ -468,7 +472,11 @@ public:
 
     bool hasActionBeenTried(CreatureActionType actionType) const;
 
-    void pushAction(std::unique_ptr<CreatureAction>&& action);
+    //! \brief Constructs an action of the given type on top of the action stack. The
+    //! parameters are forwarded to the action constructor.
+    template<typename T, typename... Args>
+    void pushAction(Args&&... args)
+    { addActionTry(mActions.emplace<T>(std::forward<Args>(args)...).getType()); }
     void popAction();
 
     void fireCreatureRefreshIfNeeded();
@@ -571,6 +579,9 @@ public:
 
     bool isWarmup() const;
 
+    //! \brief Updates the health value displayed on client side. On server side, it also updates the seat
+    //! alive creatures counters if the creature died or came back to life. It must be called after each
+    //! change of mHp
     void computeCreatureOverlayHealthValue();
 
     //! \brief Search within listObjects the closest attackable one.
@@ -588,6 +599,10 @@ public:
     //! \brief Called when the creature changes seat (for example when it becomes rogue or after torture)
     void changeSeat(Seat* newSeat);
 
+    //! \brief Called by the GameMap when the creature is added to or removed from its creatures list.
+    //! Used on server side to keep the seat alive creatures counters up to date
+    void setIsInCreaturesList(bool isInCreaturesList);
+
 protected:
     virtual void exportToPacket(ODPacket& os, const Seat* seat) const override;
     virtual void importFromPacket(ODPacket& is) override;
@@ -648,6 +663,8 @@ private:
 
     //! \brief The creature stats
     std::string     mHpString;
+    //! \brief Every change must be followed by a call to computeCreatureOverlayHealthValue. Otherwise, the
+    //! seat alive creatures counters will not know that the creature died
     double          mHp;
     double          mMaxHP;
     double          mExp;
@@ -687,7 +704,10 @@ private:
     std::vector<GameEntity*>        mVisibleEnemyObjects;
     std::vector<GameEntity*>        mVisibleAlliedObjects;
     std::vector<GameEntity*>        mReachableAlliedObjects;
-    std::vector<std::unique_ptr<CreatureAction>>    mActions;
+
+    //! \brief Number of visible allied creatures indexed by creature class id
+    std::vector<uint32_t>           mNbVisibleAlliedCreaturesByClass;
+    CreatureActionStack             mActions;
     std::vector<Tile*>              mVisualDebugEntityTiles;
 
     //! \brief Contains the actions that have already been tested to avoid trying several times same action
@@ -758,6 +778,16 @@ private:
     //! \brief Counts the number of active slaps affecting the creature
     uint32_t                        mActiveSlapsCount;
 
+    //! \brief true if the creature is in the GameMap creatures list
+    bool                            mIsInCreaturesList;
+
+    //! \brief Seat whose alive creatures counters include this creature. nullptr if it is not counted
+    Seat*                           mAliveCountersSeat;
+
+    //! \brief Adds or removes the creature from the alive creatures counters of its seat if it entered or
+    //! left the creatures list, died or changed seat. Used on server side only
+    void updateAliveCounters();
+
     //! \brief Skills the creature can use
     std::vector<CreatureSkillData> mSkillData;
 
@@ -778,7 +808,13 @@ private:
 
     void computeMood();
 
+    //! \brief Fills mNbVisibleAlliedCreaturesByClass from mVisibleAlliedObjects
+    void countVisibleAlliedCreatures();
+
     void computeCreatureOverlayMoodValue();
+
+    //! \brief Remembers that an action of the given type has been tried during this turn
+    void addActionTry(CreatureActionType actionType);
 };
 
 #endif // CREATURE_H
@@ -29,6 +29,8 @@
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+#include <mutex>
+
 static CreatureRoomAffinity EMPTY_AFFINITY(RoomType::nullRoomType, 0, 0);
 
 CreatureDefinition::CreatureDefinition(
@@ -72,6 +74,7 @@ CreatureDefinition::CreatureDefinition(
             int32_t                 turnsStunDropped) :
         mCreatureJob (job),
         mClassName   (className),
+        mClassId     (getClassIdFromName(className)),
         mMeshName    (meshName),
         mBedMeshName (bedMeshName),
         mBedDim1     (bedDim1),
@@ -122,6 +125,7 @@ CreatureDefinition::CreatureDefinition(
 CreatureDefinition::CreatureDefinition(const CreatureDefinition& def) :
         mCreatureJob(def.mCreatureJob),
         mClassName(def.mClassName),
+        mClassId(def.mClassId),
         mMeshName(def.mMeshName),
         mBedMeshName(def.mBedMeshName),
         mBedDim1(def.mBedDim1),
@@ -261,6 +265,22 @@ std::string CreatureDefinition::creatureJobToString(CreatureJob c)
     }
 }
 
+uint32_t CreatureDefinition::getClassIdFromName(const std::string& className)
+{
+    // Definitions can be loaded by the server and the client threads
+    static std::mutex classIdsMutex;
+    static std::map<std::string, uint32_t> classIds;
+
+    std::lock_guard<std::mutex> lock(classIdsMutex);
+    auto it = classIds.find(className);
+    if(it != classIds.end())
+        return it->second;
+
+    uint32_t classId = classIds.size();
+    classIds.emplace(className, classId);
+    return classId;
+}
+
 int32_t CreatureDefinition::getFee(unsigned int level) const
 {
     return mFeeBase + (mFeePerLevel * level);
@@ -311,6 +331,7 @@ ODPacket& operator>>(ODPacket& is, CreatureDefinition* c)
 {
     std::string tempString;
     is >> c->mClassName >> tempString;
+    c->mClassId = CreatureDefinition::getClassIdFromName(c->mClassName);
     c->mCreatureJob = CreatureDefinition::creatureJobFromString(tempString);
     is >> c->mMeshName;
     is >> c->mBedMeshName >> c->mBedDim1 >> c->mBedDim2 >>c->mBedPosX >> c->mBedPosY >> c->mBedOrientX >> c->mBedOrientY;
@@ -715,6 +736,7 @@ bool CreatureDefinition::update(CreatureDefinition* creatureDef, std::stringstre
         return false;
     }
     creatureDef->mClassName = name;
+    creatureDef->mClassId = getClassIdFromName(name);
     creatureDef->mBaseDefinition = baseDefinition;
 
     return true;
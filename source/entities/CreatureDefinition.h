@@ -142,8 +142,14 @@ public:
     static CreatureDefinition* load(std::stringstream& defFile, const std::map<std::string, CreatureDefinition*>& defMap);
     static bool update(CreatureDefinition* creatureDef, std::stringstream& defFile, const std::map<std::string, CreatureDefinition*>& defMap);
 
+    //! \brief Returns the small integer id associated with the given creature class name. Ids
+    //! are given in the order class names are first seen and never change afterwards. That
+    //! allows to compare creature classes or index tables by class without comparing strings.
+    static uint32_t getClassIdFromName(const std::string& className);
+
     inline CreatureJob          getCreatureJob  () const    { return mCreatureJob; }
     inline const std::string&   getClassName    () const    { return mClassName; }
+    inline uint32_t             getClassId      () const    { return mClassId; }
 
     inline const std::string&   getMeshName     () const    { return mMeshName; }
 
@@ -235,6 +241,9 @@ private:
     //! \brief The name of the creatures class
     std::string mClassName;
 
+    //! \brief Interned id of mClassName (see getClassIdFromName)
+    uint32_t mClassId;
+
     //! \brief The name of the creature definition this one is based on (can be empty if no base class)
     std::string mBaseDefinition;
 
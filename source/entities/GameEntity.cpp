@@ -200,7 +200,7 @@ void GameEntity::firePickupEntity(Player* playerPicking)
         }
         else
         {
-            ServerNotification* serverNotification = new ServerNotification(
+            ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::entityPickedUp, seat->getPlayer());
             serverNotification->mPacket << seatId << entityType << entityName;
             ODServer::getSingleton().queueServerNotification(serverNotification);
@@ -256,7 +256,7 @@ void GameEntity::fireDropEntity(Player* playerPicking, Tile* tile)
         }
         else
         {
-            ServerNotification* serverNotification = new ServerNotification(
+            ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::entityDropped, seat->getPlayer());
             serverNotification->mPacket << seatId;
             getGameMap()->tileToPacket(serverNotification->mPacket, tile);
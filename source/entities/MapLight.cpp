@@ -164,7 +164,7 @@ void MapLight::fireAddEntity(Seat* seat, bool async)
     }
     else
     {
-        ServerNotification* serverNotification = new ServerNotification(
+        ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::addEntity, seat->getPlayer());
         exportHeadersToPacket(serverNotification->mPacket);
         exportToPacket(serverNotification->mPacket, seat);
@@ -175,7 +175,7 @@ void MapLight::fireAddEntity(Seat* seat, bool async)
 void MapLight::fireRemoveEntity(Seat* seat)
 {
     const std::string& name = getName();
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::removeEntity, seat->getPlayer());
     GameEntityType type = getObjectType();
     serverNotification->mPacket << type;
@@ -96,15 +96,15 @@ void MissileObject::doUpkeep()
     Ogre::Vector3 position = getPosition();
     double moveDist = getMoveSpeed();
     Ogre::Vector3 destination;
-    std::list<Tile*> tiles;
-    mIsMissileAlive = computeDestination(position, moveDist, mDirection, destination, tiles);
+    mIsMissileAlive = computeDestination(position, moveDist, mDirection, destination, mPathTiles);
 
-    std::vector<Ogre::Vector3> path;
+    mWalkPath.clear();
     Tile* lastTile = nullptr;
-    while(!tiles.empty() && mIsMissileAlive)
+    uint32_t indexTile = 0;
+    while((indexTile < mPathTiles.size()) && mIsMissileAlive)
     {
-        Tile* tmpTile = tiles.front();
-        tiles.pop_front();
+        Tile* tmpTile = mPathTiles[indexTile];
+        ++indexTile;
 
         if(tmpTile == nullptr)
         {
@@ -115,7 +115,7 @@ void MissileObject::doUpkeep()
         if(tmpTile->getFullness() > 0.0)
         {
             Ogre::Vector3 nextDirection;
-            OD_LOG_INF("missile name=" + getName() + ", hit wall on tile=" + Tile::displayAsString(tmpTile));
+            OD_LOG_DBG("missile name=" + getName() + ", hit wall on tile=" + Tile::displayAsString(tmpTile));
             mIsMissileAlive = wallHitNextDirection(mDirection, lastTile, nextDirection);
             if(!mIsMissileAlive)
             {
@@ -127,10 +127,11 @@ void MissileObject::doUpkeep()
             {
                 position.x = static_cast<Ogre::Real>(lastTile->getX());
                 position.y = static_cast<Ogre::Real>(lastTile->getY());
-                path.push_back(position);
+                mWalkPath.push_back(position);
                 // We compute next position
                 mDirection = nextDirection;
-                mIsMissileAlive = computeDestination(position, moveDist, mDirection, destination, tiles);
+                mIsMissileAlive = computeDestination(position, moveDist, mDirection, destination, mPathTiles);
+                indexTile = 0;
                 continue;
             }
         }
@@ -165,13 +166,13 @@ void MissileObject::doUpkeep()
             }
         }
 
-        std::vector<Tile*> tileVector;
-        tileVector.push_back(tmpTile);
-        std::vector<GameEntity*> enemyCreatures = getGameMap()->getVisibleCreatures(tileVector, getSeat(), true);
-        for(std::vector<GameEntity*>::iterator it = enemyCreatures.begin(); it != enemyCreatures.end(); ++it)
+        // Hitting a creature might kill it and remove it from the tile so we copy the
+        // creatures before hitting them
+        mHitCreatures.clear();
+        tmpTile->fillWithEntities(mHitCreatures, SelectionEntityWanted::creatureAliveEnemyAttackable, getSeat()->getPlayer());
+        for(GameEntity* creature : mHitCreatures)
         {
-            GameEntity* creature = *it;
-            OD_LOG_INF("missile=" + getName() + " hit creature=" + creature->getName() + ", on tile=" + Tile::displayAsString(tmpTile));
+            OD_LOG_DBG("missile=" + getName() + " hit creature=" + creature->getName() + ", on tile=" + Tile::displayAsString(tmpTile));
             if(!hitCreature(tmpTile, creature))
             {
                 destination -= moveDist * mDirection;
@@ -183,11 +184,11 @@ void MissileObject::doUpkeep()
         if(!mDamageAllies || !mIsMissileAlive)
             continue;
 
-        std::vector<GameEntity*> alliedCreatures = getGameMap()->getVisibleCreatures(tileVector, getSeat(), false);
-        for(std::vector<GameEntity*>::iterator it = alliedCreatures.begin(); it != alliedCreatures.end(); ++it)
+        mHitCreatures.clear();
+        tmpTile->fillWithEntities(mHitCreatures, SelectionEntityWanted::creatureAliveAllied, getSeat()->getPlayer());
+        for(GameEntity* creature : mHitCreatures)
         {
-            GameEntity* creature = *it;
-            OD_LOG_INF("missile=" + getName() + " hit creature=" + creature->getName() + ", on tile=" + Tile::displayAsString(tmpTile));
+            OD_LOG_DBG("missile=" + getName() + " hit creature=" + creature->getName() + ", on tile=" + Tile::displayAsString(tmpTile));
             if(!hitCreature(tmpTile, creature))
             {
                 destination -= moveDist * mDirection;
@@ -197,16 +198,16 @@ void MissileObject::doUpkeep()
         }
     }
 
-    path.push_back(destination);
-    setWalkPath(EntityAnimation::idle_anim, EntityAnimation::idle_anim, true, true, path);
+    mWalkPath.push_back(destination);
+    setWalkPath(EntityAnimation::idle_anim, EntityAnimation::idle_anim, true, true, mWalkPath);
 }
 
 bool MissileObject::computeDestination(const Ogre::Vector3& position, double moveDist, const Ogre::Vector3& direction,
-        Ogre::Vector3& destination, std::list<Tile*>& tiles)
+        Ogre::Vector3& destination, std::vector<Tile*>& tiles)
 {
     destination = position + (moveDist * direction);
-    tiles = getGameMap()->tilesBetween(Helper::round(position.x),
-        Helper::round(position.y), Helper::round(destination.x), Helper::round(destination.y));
+    getGameMap()->tilesBetween(Helper::round(position.x), Helper::round(position.y),
+        Helper::round(destination.x), Helper::round(destination.y), tiles);
     if(tiles.empty())
     {
         OD_LOG_ERR("missile=" + getName() + " has unexpected empty tiles destination");
@@ -22,6 +22,7 @@
 
 #include <string>
 #include <iosfwd>
+#include <vector>
 
 class Building;
 class Creature;
@@ -104,13 +105,19 @@ protected:
 
 private:
     bool computeDestination(const Ogre::Vector3& position, double moveDist, const Ogre::Vector3& direction,
-        Ogre::Vector3& destination, std::list<Tile*>& tiles);
+        Ogre::Vector3& destination, std::vector<Tile*>& tiles);
     Ogre::Vector3 mDirection;
     bool mIsMissileAlive;
     GameEntity* mEntityTarget;
     bool mDamageAllies;
     bool mKoEnemyCreature;
     double mSpeed;
+
+    //! \brief Buffers used while moving the missile. They are kept between turns so that
+    //! upkeeping a missile does not allocate memory once they have grown
+    std::vector<Tile*> mPathTiles;
+    std::vector<GameEntity*> mHitCreatures;
+    std::vector<Ogre::Vector3> mWalkPath;
 };
 
 #endif // MISSILEOBJECT_H
@@ -100,7 +100,7 @@ void MovableGameEntity::setWalkPath(const std::string& walkAnim, const std::stri
 
         const std::string& name = getName();
         uint32_t nbDest = mWalkQueue.size();
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::animatedObjectSetWalkPath, seat->getPlayer());
         serverNotification->mPacket << name << walkAnim << endAnim << loopEndAnim << playIdleWhenAnimationEnds << nbDest;
         for(const Ogre::Vector3& v : mWalkQueue)
@@ -125,7 +125,7 @@ void MovableGameEntity::clearDestinations(const std::string& animation, bool loo
         const std::string& name = getName();
         const std::string emptyString;
         uint32_t nbDest = 0;
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::animatedObjectSetWalkPath, seat->getPlayer());
         serverNotification->mPacket << name << emptyString << animation
             << loopAnim << playIdleWhenAnimationEnds << nbDest;
@@ -307,7 +307,7 @@ void MovableGameEntity::fireObjectAnimationState(const std::string& state, bool
         if(!seat->getPlayer()->getIsHuman())
             continue;
 
-        ServerNotification* serverNotification = new ServerNotification(
+        ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::setObjectAnimationState, seat->getPlayer());
         const std::string& name = getName();
         serverNotification->mPacket << name << state << loop << playIdleWhenAnimationEnds;
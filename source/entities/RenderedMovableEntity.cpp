@@ -127,7 +127,7 @@ void RenderedMovableEntity::setMeshOpacity(float opacity)
             if(!seat->getPlayer()->getIsHuman())
                 continue;
 
-            ServerNotification* serverNotification = new ServerNotification(
+            ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::setEntityOpacity, seat->getPlayer());
             const std::string& name = getName();
             serverNotification->mPacket << name << opacity;
@@ -162,7 +162,7 @@ void RenderedMovableEntity::fireAddEntity(Seat* seat, bool async)
     }
     else
     {
-        ServerNotification* serverNotification = new ServerNotification(
+        ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::addEntity, seat->getPlayer());
         exportHeadersToPacket(serverNotification->mPacket);
         exportToPacket(serverNotification->mPacket, seat);
@@ -172,7 +172,7 @@ void RenderedMovableEntity::fireAddEntity(Seat* seat, bool async)
 
 void RenderedMovableEntity::fireRemoveEntity(Seat* seat)
 {
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::removeEntity, seat->getPlayer());
     const std::string& name = getName();
     GameEntityType type = getObjectType();
@@ -25,6 +25,7 @@
 #include "game/Player.h"
 #include "game/Seat.h"
 #include "gamemap/GameMap.h"
+#include "goals/Goal.h"
 #include "network/ODPacket.h"
 #include "render/RenderManager.h"
 #include "rooms/Room.h"
@@ -52,14 +53,16 @@ Tile::Tile(GameMap* gameMap, int x, int y, TileType type, double fullness) :
     GameEntity(gameMap, "", "", nullptr),
     mX                  (x),
     mY                  (y),
-    mType               (type),
+    mType               (nullptr),
     mTileVisual         (TileVisual::nullTileVisual),
     mSelected           (false),
-    mFullness           (fullness),
+    mFullness           (nullptr),
     mRefundPriceRoom    (0),
     mRefundPriceTrap    (0),
     mCoveringBuilding   (nullptr),
-    mClaimedPercentage  (0.0),
+    mFloodFillColor     (nullptr),
+    mNbTeams            (0),
+    mClaimedPercentage  (nullptr),
     mIsRoom             (false),
     mIsTrap             (false),
     mDisplayTileMesh    (true),
@@ -69,6 +72,10 @@ Tile::Tile(GameMap* gameMap, int x, int y, TileType type, double fullness) :
     mTileCulling        (CullingType::HIDE),
     mNbWorkersClaiming(0)
 {
+    gameMap->setTileValuesStorage(*this);
+    *mType = type;
+    *mFullness = fullness;
+    *mClaimedPercentage = 0.0;
     computeTileVisual();
 }
 
@@ -131,7 +138,7 @@ bool Tile::isWallClaimable(Seat* seat)
     if (getFullness() <= 0.0)
         return false;
 
-    if (mType == TileType::lava || mType == TileType::water || mType == TileType::rock || mType == TileType::gold)
+    if (*mType == TileType::lava || *mType == TileType::water || *mType == TileType::rock || *mType == TileType::gold)
         return false;
 
     // Check whether at least one neighbor is a claimed ground tile of the given seat
@@ -190,7 +197,7 @@ bool Tile::isWallClaimedForSeat(Seat* seat)
     if (getFullness() == 0.0)
         return false;
 
-    if (mClaimedPercentage < 1.0)
+    if (*mClaimedPercentage < 1.0)
         return false;
 
     Seat* tileSeat = getSeat();
@@ -417,6 +424,13 @@ bool Tile::isMarkedForDiggingByAnySeat()
 void Tile::addPlayerMarkingTile(const Player *p)
 {
     mPlayersMarkingTile.push_back(p);
+
+    if(getIsOnServerMap() && (p->getSeat() != nullptr))
+    {
+        Seat* seat = getGameMap()->getSeatById(p->getSeat()->getId());
+        if(seat != nullptr)
+            seat->getWorkerJobBoard().addTile(WorkerJobType::dig, *this);
+    }
 }
 
 void Tile::removePlayerMarkingTile(const Player *p)
@@ -426,6 +440,13 @@ void Tile::removePlayerMarkingTile(const Player *p)
         return;
 
     mPlayersMarkingTile.erase(it);
+
+    if(getIsOnServerMap() && (p->getSeat() != nullptr))
+    {
+        Seat* seat = getGameMap()->getSeatById(p->getSeat()->getId());
+        if(seat != nullptr)
+            seat->getWorkerJobBoard().removeTile(WorkerJobType::dig, *this);
+    }
 }
 
 void Tile::addNeighbor(Tile *n)
@@ -553,18 +574,14 @@ bool Tile::isSameFloodFill(Seat* seat, FloodFillType type, Tile* tile) const
 
 void Tile::resetFloodFill()
 {
-    for(std::vector<uint32_t>& values : mFloodFillColor)
-    {
-        for(uint32_t& floodFillValue : values)
-        {
-            floodFillValue = NO_FLOODFILL;
-        }
-    }
+    uint32_t nbValues = mNbTeams * static_cast<uint32_t>(FloodFillType::nbValues);
+    for(uint32_t i = 0; i < nbValues; ++i)
+        mFloodFillColor[i] = NO_FLOODFILL;
 }
 
 bool Tile::updateFloodFillFromTile(Seat* seat, FloodFillType type, Tile* tile)
 {
-    if(seat->getTeamIndex() >= mFloodFillColor.size())
+    if(seat->getTeamIndex() >= mNbTeams)
     {
         static bool logMsg = false;
         if(!logMsg)
@@ -572,15 +589,15 @@ bool Tile::updateFloodFillFromTile(Seat* seat, FloodFillType type, Tile* tile)
             logMsg = true;
             OD_LOG_ERR("Wrong floodfill seat index seatId=" + Helper::toString(seat->getId())
                 + ", tile=" + Tile::displayAsString(this)
-                + ", seatIndex=" + Helper::toString(seat->getTeamIndex()) + ", floodfillsize=" + Helper::toString(static_cast<uint32_t>(mFloodFillColor.size()))
+                + ", seatIndex=" + Helper::toString(seat->getTeamIndex()) + ", floodfillsize=" + Helper::toString(mNbTeams)
                 + ", fullness=" + Helper::toString(getFullness()));
         }
         return false;
     }
 
-    std::vector<uint32_t>& values = mFloodFillColor[seat->getTeamIndex()];
+    uint32_t* values = getFloodFillColors(seat->getTeamIndex());
     uint32_t intType = static_cast<uint32_t>(type);
-    if(intType >= values.size())
+    if(intType >= static_cast<uint32_t>(FloodFillType::nbValues))
     {
         static bool logMsg = false;
         if(!logMsg)
@@ -588,7 +605,7 @@ bool Tile::updateFloodFillFromTile(Seat* seat, FloodFillType type, Tile* tile)
             logMsg = true;
             OD_LOG_ERR("Wrong floodfill seat index seatId=" + Helper::toString(seat->getId())
                 + ", tile=" + Tile::displayAsString(this)
-                + ", intType=" + Helper::toString(intType) + ", floodfillsize=" + Helper::toString(static_cast<uint32_t>(values.size())));
+                + ", intType=" + Helper::toString(intType));
         }
         return false;
     }
@@ -605,7 +622,7 @@ bool Tile::updateFloodFillFromTile(Seat* seat, FloodFillType type, Tile* tile)
 
 void Tile::replaceFloodFill(Seat* seat, FloodFillType type, uint32_t newValue)
 {
-    if(seat->getTeamIndex() >= mFloodFillColor.size())
+    if(seat->getTeamIndex() >= mNbTeams)
     {
         static bool logMsg = false;
         if(!logMsg)
@@ -613,14 +630,14 @@ void Tile::replaceFloodFill(Seat* seat, FloodFillType type, uint32_t newValue)
             logMsg = true;
             OD_LOG_ERR("Wrong floodfill seat index seatId=" + Helper::toString(seat->getId())
                 + ", tile=" + Tile::displayAsString(this)
-                + ", seatIndex=" + Helper::toString(seat->getTeamIndex()) + ", floodfillsize=" + Helper::toString(static_cast<uint32_t>(mFloodFillColor.size())));
+                + ", seatIndex=" + Helper::toString(seat->getTeamIndex()) + ", floodfillsize=" + Helper::toString(mNbTeams));
         }
         return;
     }
 
-    std::vector<uint32_t>& values = mFloodFillColor[seat->getTeamIndex()];
+    uint32_t* values = getFloodFillColors(seat->getTeamIndex());
     uint32_t intType = static_cast<uint32_t>(type);
-    if(intType >= values.size())
+    if(intType >= static_cast<uint32_t>(FloodFillType::nbValues))
     {
         static bool logMsg = false;
         if(!logMsg)
@@ -628,7 +645,7 @@ void Tile::replaceFloodFill(Seat* seat, FloodFillType type, uint32_t newValue)
             logMsg = true;
             OD_LOG_ERR("Wrong floodfill seat index seatId=" + Helper::toString(seat->getId())
                 + ", tile=" + Tile::displayAsString(this)
-                + ", intType=" + Helper::toString(intType) + ", floodfillsize=" + Helper::toString(static_cast<uint32_t>(values.size())));
+                + ", intType=" + Helper::toString(intType));
         }
         return;
     }
@@ -638,7 +655,7 @@ void Tile::replaceFloodFill(Seat* seat, FloodFillType type, uint32_t newValue)
 
 void Tile::copyFloodFillToOtherSeats(Seat* seatToCopy)
 {
-    if(seatToCopy->getTeamIndex() >= mFloodFillColor.size())
+    if(seatToCopy->getTeamIndex() >= mNbTeams)
     {
         static bool logMsg = false;
         if(!logMsg)
@@ -646,18 +663,18 @@ void Tile::copyFloodFillToOtherSeats(Seat* seatToCopy)
             logMsg = true;
             OD_LOG_ERR("Wrong floodfill seat index seatId=" + Helper::toString(seatToCopy->getId())
                 + ", tile=" + Tile::displayAsString(this)
-                + ", seatIndex=" + Helper::toString(seatToCopy->getTeamIndex()) + ", floodfillsize=" + Helper::toString(static_cast<uint32_t>(mFloodFillColor.size())));
+                + ", seatIndex=" + Helper::toString(seatToCopy->getTeamIndex()) + ", floodfillsize=" + Helper::toString(mNbTeams));
         }
         return;
     }
 
-    std::vector<uint32_t>& valuesToCopy = mFloodFillColor[seatToCopy->getTeamIndex()];
-    for(uint32_t indexFloodFill = 0; indexFloodFill < mFloodFillColor.size(); ++indexFloodFill)
+    const uint32_t* valuesToCopy = getFloodFillColors(seatToCopy->getTeamIndex());
+    for(uint32_t indexFloodFill = 0; indexFloodFill < mNbTeams; ++indexFloodFill)
     {
         if(seatToCopy->getTeamIndex() == indexFloodFill)
             continue;
 
-        std::vector<uint32_t>& values = mFloodFillColor[indexFloodFill];
+        uint32_t* values = getFloodFillColors(indexFloodFill);
         for(uint32_t intType = 0; intType < static_cast<uint32_t>(FloodFillType::nbValues); ++intType)
             values[intType] = valuesToCopy[intType];
 
@@ -670,13 +687,12 @@ void Tile::logFloodFill() const
         + " - type=" + Tile::tileVisualToString(getTileVisual())
         + " - fullness=" + Helper::toString(getFullness())
         + " - seatId=" + std::string(getSeat() == nullptr ? "-1" : Helper::toString(getSeat()->getId()));
-    for(const std::vector<uint32_t>& values : mFloodFillColor)
+    for(uint32_t indexFloodFill = 0; indexFloodFill < mNbTeams; ++indexFloodFill)
     {
-        int cpt = 0;
-        for(const uint32_t& floodFill : values)
+        const uint32_t* values = getFloodFillColors(indexFloodFill);
+        for(uint32_t cpt = 0; cpt < static_cast<uint32_t>(FloodFillType::nbValues); ++cpt)
         {
-            str += ", [" + Helper::toString(cpt) + "]=" + Helper::toString(floodFill);
-            ++cpt;
+            str += ", [" + Helper::toString(cpt) + "]=" + Helper::toString(values[cpt]);
         }
     }
     OD_LOG_INF(str);
@@ -713,12 +729,38 @@ bool Tile::isClaimed() const
     if(getSeat() == nullptr)
         return false;
 
-    if(mClaimedPercentage < 1.0)
+    if(*mClaimedPercentage < 1.0)
         return false;
 
     return true;
 }
 
+Seat* Tile::getClaimedSeat() const
+{
+    if(!isClaimed())
+        return nullptr;
+
+    return getSeat();
+}
+
+void Tile::updateClaimedSeat(Seat* oldClaimedSeat)
+{
+    if(!getIsOnServerMap())
+        return;
+
+    Seat* claimedSeat = getClaimedSeat();
+    if(claimedSeat == oldClaimedSeat)
+        return;
+
+    if(oldClaimedSeat != nullptr)
+        oldClaimedSeat->decrementNumClaimedTiles();
+
+    if(claimedSeat != nullptr)
+        claimedSeat->incrementNumClaimedTiles();
+
+    getGameMap()->notifyGoalStateChanged(GoalDependency::claimedTiles);
+}
+
 void Tile::clearVision()
 {
     mSeatsWithVision.clear();
@@ -778,7 +820,7 @@ void Tile::computeTileVisual()
     switch(getType())
     {
         case TileType::dirt:
-            if(mFullness > 0.0)
+            if(*mFullness > 0.0)
             {
                 if(isClaimed())
                     mTileVisual = TileVisual::claimedFull;
@@ -795,14 +837,14 @@ void Tile::computeTileVisual()
             return;
 
         case TileType::rock:
-            if(mFullness > 0.0)
+            if(*mFullness > 0.0)
                 mTileVisual = TileVisual::rockFull;
             else
                 mTileVisual = TileVisual::rockGround;
             return;
 
         case TileType::gold:
-            if(mFullness > 0.0)
+            if(*mFullness > 0.0)
             {
                 if(isClaimed())
                     mTileVisual = TileVisual::claimedFull;
@@ -827,7 +869,7 @@ void Tile::computeTileVisual()
             return;
 
         case TileType::gem:
-            if(mFullness > 0.0)
+            if(*mFullness > 0.0)
                 mTileVisual = TileVisual::gemFull;
             else
                 mTileVisual = TileVisual::gemGround;
@@ -842,7 +884,7 @@ void Tile::computeTileVisual()
 
 uint32_t Tile::getFloodFillValue(Seat* seat, FloodFillType type) const
 {
-    if(seat->getTeamIndex() >= mFloodFillColor.size())
+    if(seat->getTeamIndex() >= mNbTeams)
     {
         static bool logMsg = false;
         if(!logMsg)
@@ -850,15 +892,15 @@ uint32_t Tile::getFloodFillValue(Seat* seat, FloodFillType type) const
             logMsg = true;
             OD_LOG_ERR("Wrong floodfill seat index seatId=" + Helper::toString(seat->getId())
                 + ", tile=" + Tile::displayAsString(this)
-                + ", seatIndex=" + Helper::toString(seat->getTeamIndex()) + ", floodfillsize=" + Helper::toString(static_cast<uint32_t>(mFloodFillColor.size()))
+                + ", seatIndex=" + Helper::toString(seat->getTeamIndex()) + ", floodfillsize=" + Helper::toString(mNbTeams)
                 + ", fullness=" + Helper::toString(getFullness()));
         }
         return NO_FLOODFILL;
     }
 
-    const std::vector<uint32_t>& values = mFloodFillColor[seat->getTeamIndex()];
+    const uint32_t* values = getFloodFillColors(seat->getTeamIndex());
     uint32_t intType = static_cast<uint32_t>(type);
-    if(intType >= values.size())
+    if(intType >= static_cast<uint32_t>(FloodFillType::nbValues))
     {
         static bool logMsg = false;
         if(!logMsg)
@@ -866,17 +908,37 @@ uint32_t Tile::getFloodFillValue(Seat* seat, FloodFillType type) const
             logMsg = true;
             OD_LOG_ERR("Wrong floodfill seat index seatId=" + Helper::toString(seat->getId())
                 + ", tile=" + Tile::displayAsString(this)
-                + ", intType=" + Helper::toString(intType) + ", floodfillsize=" + Helper::toString(static_cast<uint32_t>(values.size())));
+                + ", intType=" + Helper::toString(intType));
         }
         return NO_FLOODFILL;
     }
 
-    return values.at(intType);
+    return values[intType];
 }
 
-void Tile::setTeamsNumber(uint32_t nbTeams)
+void Tile::setFloodFillColors(uint32_t* floodFillColors, uint32_t nbTeams)
 {
-    mFloodFillColor = std::vector<std::vector<uint32_t>>(nbTeams, std::vector<uint32_t>(static_cast<uint32_t>(FloodFillType::nbValues), NO_FLOODFILL));
+    mFloodFillColor = floodFillColors;
+    mNbTeams = nbTeams;
+}
+
+void Tile::setValuesStorage(TileType* type, double* fullness, double* claimedPercentage)
+{
+    mType = type;
+    mFullness = fullness;
+    mClaimedPercentage = claimedPercentage;
+}
+
+size_t Tile::getHeapMemoryFootprint() const
+{
+    return mNeighbors.capacity() * sizeof(Tile*)
+        + mPlayersMarkingTile.capacity() * sizeof(const Player*)
+        + mTileChangedForSeats.capacity() * sizeof(std::pair<Seat*, bool>)
+        + mSeatsWithVision.capacity() * sizeof(Seat*)
+        + mEntitiesInTile.capacity() * sizeof(GameEntity*)
+        + mNbWorkersDigging.capacity() * sizeof(uint32_t)
+        + mStateListeners.capacity() * sizeof(TileStateListener*)
+        + getName().capacity() + getMeshName().capacity();
 }
 
 bool Tile::shouldColorTileMesh() const
@@ -901,15 +963,21 @@ void Tile::setFullness(double f)
 {
     double oldFullness = getFullness();
 
-    mFullness = f;
+    *mFullness = f;
+
+    if(oldFullness != *mFullness)
+        fireClaimableStateChanged();
+
+    if((oldFullness > 0.0) != (*mFullness > 0.0))
+        getGameMap()->notifyVisionChanged(*this);
 
     // If the tile was marked for digging and has been dug out, unmark it and set its fullness to 0.
-    if (mFullness == 0.0 && isMarkedForDiggingByAnySeat())
+    if (*mFullness == 0.0 && isMarkedForDiggingByAnySeat())
     {
         setMarkedForDiggingForAllPlayersExcept(false, nullptr);
     }
 
-    if ((oldFullness > 0.0) && (mFullness == 0.0))
+    if ((oldFullness > 0.0) && (*mFullness == 0.0))
     {
         fireTileSound(TileSound::Digged);
 
@@ -972,6 +1040,7 @@ void Tile::setCoveringBuilding(Building *building)
         }
     }
     mCoveringBuilding = building;
+    getGameMap()->notifyVisionChanged(*this);
     mIsRoom = false;
     if(getCoveringRoom() != nullptr)
     {
@@ -997,9 +1066,13 @@ void Tile::setCoveringBuilding(Building *building)
         }
 
         // Set the tile as claimed and of the team color of the building
+        Seat* oldClaimedSeat = getClaimedSeat();
         setSeat(mCoveringBuilding->getSeat());
-        mClaimedPercentage = 1.0;
+        *mClaimedPercentage = 1.0;
+        updateClaimedSeat(oldClaimedSeat);
     }
+
+    fireClaimableStateChanged();
 }
 
 bool Tile::isGroundClaimable(Seat* seat) const
@@ -1010,7 +1083,7 @@ bool Tile::isGroundClaimable(Seat* seat) const
     if(getCoveringBuilding() != nullptr)
         return getCoveringBuilding()->isClaimable(seat);
 
-    if(mType != TileType::dirt && mType != TileType::gold)
+    if(*mType != TileType::dirt && *mType != TileType::gold)
         return false;
 
     if(isClaimedForSeat(seat))
@@ -1096,23 +1169,24 @@ void Tile::loadFromLine(const std::string& line, Tile *t)
 
     int xLocation = Helper::toInt(elems[0]);
     int yLocation = Helper::toInt(elems[1]);
+    TileType tileType = static_cast<TileType>(Helper::toInt(elems[2]));
+    double fullness = (elems.size() >= 4) ? Helper::toDouble(elems[3]) : 0.0;
+    bool hasSeatId = (elems.size() >= 5);
+    int seatId = hasSeatId ? Helper::toInt(elems[4]) : 0;
+    loadFromValues(t, xLocation, yLocation, tileType, fullness, hasSeatId, seatId);
+}
 
-    std::stringstream tileName("");
-    tileName << TILE_PREFIX;
-    tileName << xLocation;
-    tileName << "_";
-    tileName << yLocation;
-
-    t->setName(tileName.str());
-    t->mX = xLocation;
-    t->mY = yLocation;
+void Tile::loadFromValues(Tile* t, int x, int y, TileType tileType, double fullness, bool hasSeatId, int seatId)
+{
+    t->setName(buildName(x, y));
+    t->mX = x;
+    t->mY = y;
     t->mPosition = Ogre::Vector3(static_cast<Ogre::Real>(t->mX), static_cast<Ogre::Real>(t->mY), 0.0f);
+    t->getGameMap()->setTileValuesStorage(*t);
 
-    TileType tileType = static_cast<TileType>(Helper::toInt(elems[2]));
     t->setType(tileType);
 
     // If the tile type is lava or water, we ignore fullness
-    double fullness;
     switch(tileType)
     {
         case TileType::water:
@@ -1121,14 +1195,14 @@ void Tile::loadFromLine(const std::string& line, Tile *t)
             break;
 
         default:
-            fullness = Helper::toDouble(elems[3]);
             break;
     }
     t->setFullnessValue(fullness);
 
+    Seat* oldClaimedSeat = t->getClaimedSeat();
     bool shouldSetSeat = false;
     // We allow to set seat if the tile is dirt (full or not) or if it is gold (ground only)
-    if(elems.size() >= 5)
+    if(hasSeatId)
     {
         if(tileType == TileType::dirt)
         {
@@ -1144,15 +1218,16 @@ void Tile::loadFromLine(const std::string& line, Tile *t)
     if(!shouldSetSeat)
     {
         t->setSeat(nullptr);
+        t->updateClaimedSeat(oldClaimedSeat);
         return;
     }
 
-    int seatId = Helper::toInt(elems[4]);
     Seat* seat = t->getGameMap()->getSeatById(seatId);
     if(seat == nullptr)
         return;
     t->setSeat(seat);
-    t->mClaimedPercentage = 1.0;
+    *t->mClaimedPercentage = 1.0;
+    t->updateClaimedSeat(oldClaimedSeat);
 }
 
 void Tile::refreshMesh()
@@ -1195,6 +1270,12 @@ bool Tile::addEntity(GameEntity *entity)
     }
 
     mEntitiesInTile.push_back(entity);
+    if(getGameMap()->isServerGameMap() && (mEntitiesInTile.size() == 1))
+    {
+        for(Seat* seat : getGameMap()->getSeats())
+            seat->getWorkerJobBoard().addTile(WorkerJobType::carry, *this);
+    }
+
     if(!getGameMap()->isServerGameMap())
     {
         // On client side, we cull any movable entity that walks over a
@@ -1217,6 +1298,12 @@ void Tile::removeEntity(GameEntity *entity)
     }
 
     mEntitiesInTile.erase(it);
+    if(getGameMap()->isServerGameMap() && mEntitiesInTile.empty())
+    {
+        for(Seat* seat : getGameMap()->getSeats())
+            seat->getWorkerJobBoard().removeTile(WorkerJobType::carry, *this);
+    }
+
     fireTileStateChanged();
 }
 
@@ -1236,28 +1323,32 @@ void Tile::claimForSeat(Seat* seat, double nDanceRate)
         nDanceRate *= ConfigManager::getSingleton().getClaimingWallPenalty();
 
     // If the seat is allied, we add to it. If it is an enemy seat, we subtract from it.
+    Seat* oldClaimedSeat = getClaimedSeat();
     if (getSeat() != nullptr && getSeat()->isAlliedSeat(seat))
     {
-        mClaimedPercentage += nDanceRate;
+        *mClaimedPercentage += nDanceRate;
     }
     else
     {
-        mClaimedPercentage -= nDanceRate;
-        if (mClaimedPercentage <= 0.0)
+        *mClaimedPercentage -= nDanceRate;
+        if (*mClaimedPercentage <= 0.0)
         {
             // We notify the old seat that the tile is lost
             if(getSeat() != nullptr)
                 getSeat()->notifyTileClaimedByEnemy(this);
 
             // The tile is not yet claimed, but it is now an allied seat.
-            mClaimedPercentage *= -1.0;
+            *mClaimedPercentage *= -1.0;
             setSeat(seat);
             computeTileVisual();
             setDirtyForAllSeats();
+            fireClaimableStateChanged();
         }
     }
 
-    if ((getSeat() != nullptr) && (mClaimedPercentage >= 1.0) &&
+    updateClaimedSeat(oldClaimedSeat);
+
+    if ((getSeat() != nullptr) && (*mClaimedPercentage >= 1.0) &&
         (getSeat()->isAlliedSeat(seat)))
     {
         claimTile(seat);
@@ -1271,8 +1362,10 @@ void Tile::claimTile(Seat* seat)
         + " claimed by seat=" + Seat::displayAsString(seat));
 
     // We need this because if we are a client, the tile may be from a non allied seat
+    Seat* oldClaimedSeat = getClaimedSeat();
     setSeat(seat);
-    mClaimedPercentage = 1.0;
+    *mClaimedPercentage = 1.0;
+    updateClaimedSeat(oldClaimedSeat);
 
     if(isFullTile())
         fireTileSound(TileSound::ClaimWall);
@@ -1284,6 +1377,7 @@ void Tile::claimTile(Seat* seat)
 
     computeTileVisual();
     setDirtyForAllSeats();
+    fireClaimableStateChanged();
 
     // Force all the neighbors to recheck their meshes as we have updated this tile.
     for (Tile* tile : mNeighbors)
@@ -1306,11 +1400,14 @@ void Tile::unclaimTile()
     OD_LOG_INF(getGameMap()->serverStr() + "Tile=" + displayAsString(this)
         + " unclaimed. Previous seat=" + Seat::displayAsString(getSeat()));
 
+    Seat* oldClaimedSeat = getClaimedSeat();
     setSeat(nullptr);
-    mClaimedPercentage = 0.0;
+    *mClaimedPercentage = 0.0;
+    updateClaimedSeat(oldClaimedSeat);
 
     computeTileVisual();
     setDirtyForAllSeats();
+    fireClaimableStateChanged();
 
     // Force all the neighbors to recheck their meshes as we have updated this tile.
     for (Tile* tile : mNeighbors)
@@ -1360,15 +1457,15 @@ double Tile::digOut(double digRate)
     if(fullnessLost <= 0.0)
         return digRateScaled;
 
-    if(mFullness <= 0.0)
+    if(*mFullness <= 0.0)
     {
-        OD_LOG_ERR("tile=" + Tile::displayAsString(this) + ", mFullness=" + Helper::toString(mFullness));
+        OD_LOG_ERR("tile=" + Tile::displayAsString(this) + ", mFullness=" + Helper::toString(*mFullness));
         return 0.0;
     }
 
-    if(fullnessLost >= mFullness)
+    if(fullnessLost >= *mFullness)
     {
-        digRateScaled = mFullness;
+        digRateScaled = *mFullness;
         setFullness(0.0);
 
         computeTileVisual();
@@ -1388,7 +1485,7 @@ double Tile::digOut(double digRate)
     }
 
     digRateScaled = fullnessLost;
-    setFullness(mFullness - fullnessLost);
+    setFullness(*mFullness - fullnessLost);
     return digRateScaled;
 }
 
@@ -2001,6 +2098,19 @@ void Tile::fireTileStateChanged()
         stateListener->tileStateChanged(*this);
 }
 
+void Tile::fireClaimableStateChanged()
+{
+    if(!getIsOnServerMap())
+        return;
+
+    for(Seat* seat : getGameMap()->getSeats())
+    {
+        seat->getWorkerJobBoard().notifyClaimableTileChanged(*this);
+        seat->getRoomPlacementMap().notifyTileChanged(*this);
+        seat->getGoldVeinIndex().notifyTileChanged(*this);
+    }
+}
+
 std::string Tile::displayAsString(const Tile* tile)
 {
     if(tile == nullptr)
@@ -173,11 +173,11 @@ public:
      * for the tile.
      */
     inline void setType(TileType t)
-    { mType = t; }
+    { *mType = t; }
 
     //! \brief Returns the tile type (rock, claimed, etc.).
     inline TileType getType() const
-    { return mType; }
+    { return *mType; }
 
     //! \brief Returns the tile type (rock, claimed, etc.).
     inline TileVisual getTileVisual() const
@@ -193,7 +193,7 @@ public:
 
     //! \brief An accessor which returns the tile's fullness which should range from 0 to 100.
     inline double getFullness() const
-    { return mFullness; }
+    { return *mFullness; }
 
     //! \brief Tells whether a creature can see through a tile
     bool permitsVision();
@@ -318,6 +318,14 @@ public:
     //! \brief Tells whether the tile is claimed for the given seat.
     bool isClaimed() const;
 
+    //! \brief Returns the seat the tile is claimed for or nullptr if it is not claimed
+    Seat* getClaimedSeat() const;
+
+    //! \brief Should be called after the seat or the claimed percentage of the tile may have changed.
+    //! If the seat claiming the tile changed from oldClaimedSeat, the claimed tiles counters of
+    //! both seats are updated. Only used on the server map
+    void updateClaimedSeat(Seat* oldClaimedSeat);
+
     //! \brief Tells whether the given tile is a claimed wall for the given seat team.
     //! Used to discover active spots for rooms.
     bool isWallClaimedForSeat(Seat* seat);
@@ -330,6 +338,9 @@ public:
     //! \brief Loads the tile data from a level line.
     static void loadFromLine(const std::string& line, Tile *t);
 
+    //! \brief Loads the tile data from already parsed level values. seatId is only used if hasSeatId is true.
+    static void loadFromValues(Tile* t, int x, int y, TileType tileType, double fullness, bool hasSeatId, int seatId);
+
     /*! \brief This is a helper function which just converts the tile type enum into a string.
      *
      * This function is used primarily in forming the mesh names to load from disk
@@ -349,7 +360,7 @@ public:
     { return mY; }
 
     inline double getClaimedPercentage() const
-    { return mClaimedPercentage; }
+    { return *mClaimedPercentage; }
 
     static std::string buildName(int x, int y);
     static bool checkTileName(const std::string& tileName, int& x, int& y);
@@ -413,8 +424,22 @@ public:
     //! server and client
     bool isFullTile() const;
 
-    //! Sets the number of teams in this gamemap (after seat configuration). This number includes the rogue team.
-    void setTeamsNumber(uint32_t nbTeams);
+    //! Sets the floodfill values used by this tile. They are owned by the TileContainer (see TileContainer::setTeamsNumber)
+    //! and contain FloodFillType::nbValues values for each team
+    void setFloodFillColors(uint32_t* floodFillColors, uint32_t nbTeams);
+
+    //! Sets where the type, fullness and claimed percentage of this tile are stored. They are owned by
+    //! the TileContainer (see TileContainer::setTileValuesStorage)
+    void setValuesStorage(TileType* type, double* fullness, double* claimedPercentage);
+
+    //! \brief Notifies the seats worker job boards, room placement maps and gold vein indexes that this
+    //! tile (and its neighbors) may have become claimable (or buildable, diggable) or not anymore.
+    //! Should be called when something that changes it does not go through the tile (like the seat of
+    //! the covering building)
+    void fireClaimableStateChanged();
+
+    //! \brief Returns the memory allocated by the tile containers (in bytes). sizeof(Tile) is not counted
+    size_t getHeapMemoryFootprint() const;
 
     //! \brief returns true if the mesh from the tileset should be displayed and false otherwise
     inline bool shouldDisplayTileMesh() const
@@ -484,8 +509,8 @@ private:
     //! \brief The tile position
     int mX, mY;
 
-    //! \brief The tile type: Dirt, Gold, ...
-    TileType mType;
+    //! \brief The tile type: Dirt, Gold, ... Stored in the TileContainer
+    TileType* mType;
 
     //! \brief The tile visual: Claimed, Dirt, Gold, ...
     //! On client side, we should rely on mTileVisual to know the tile type as claimed percentage
@@ -497,8 +522,8 @@ private:
 
     //! \brief The tile fullness (0.0 - 100.0).
     //! At 0.0, it is a ground tile. Over it is a wall.
-    //! Used on server side only
-    double mFullness;
+    //! Used on server side only. Stored in the TileContainer
+    double* mFullness;
 
     //! Used on client side to know how much gold can be retrieved if the room/trap
     //! is sold. Note that it is needed because client are not aware of rooms/traps
@@ -514,11 +539,19 @@ private:
     std::vector<GameEntity*> mEntitiesInTile;
 
     Building* mCoveringBuilding;
-    //! Floodfill values per seat and per floodfill type
-    std::vector<std::vector<uint32_t>> mFloodFillColor;
+    //! Floodfill values per team and per floodfill type. They are stored in the TileContainer
+    uint32_t* mFloodFillColor;
+    uint32_t mNbTeams;
+
+    //! \brief Returns the floodfill values of the given team. teamIndex must be lower than mNbTeams
+    inline uint32_t* getFloodFillColors(uint32_t teamIndex)
+    { return mFloodFillColor + teamIndex * static_cast<uint32_t>(FloodFillType::nbValues); }
+
+    inline const uint32_t* getFloodFillColors(uint32_t teamIndex) const
+    { return mFloodFillColor + teamIndex * static_cast<uint32_t>(FloodFillType::nbValues); }
 
-    //! \brief The tile claiming. Used on server side only
-    double mClaimedPercentage;
+    //! \brief The tile claiming. Used on server side only. Stored in the TileContainer
+    double* mClaimedPercentage;
 
     //! \brief True if a building is on this tile. False otherwise. It is used on client side because the clients do not know about
     //! buildings. However, it needs to know the tiles where a building is to display the room/trap costs.
@@ -541,7 +574,7 @@ private:
      *  before a map object has been set. setFullness is called once a map is assigned.
      */
     inline void setFullnessValue(double f)
-    { mFullness = f; }
+    { *mFullness = f; }
 
     void setDirtyForAllSeats();
 
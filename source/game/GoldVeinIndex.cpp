@@ -0,0 +1,212 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "game/GoldVeinIndex.h"
+
+#include "entities/Creature.h"
+#include "entities/Tile.h"
+#include "gamemap/GameMap.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+GoldVeinIndex::GoldVeinIndex(GameMap* gameMap, Seat* seat) :
+    mGameMap(gameMap),
+    mSeat(seat),
+    mIsInitialized(false),
+    mMapSizeX(0),
+    mMapSizeY(0),
+    mAreColorsDirty(true)
+{
+}
+
+bool GoldVeinIndex::isGoldVein(const Tile& tile)
+{
+    return (tile.getType() == TileType::gold) && (tile.getFullness() > 0.0);
+}
+
+void GoldVeinIndex::notifyTileChanged(Tile& tile)
+{
+    if(!mIsInitialized)
+        return;
+
+    int index = tile.getY() * mMapSizeX + tile.getX();
+    if((index < 0) || (index >= static_cast<int>(mIsTileDirty.size())))
+        return;
+
+    if(mIsTileDirty[index])
+        return;
+
+    mIsTileDirty[index] = true;
+    mDirtyTiles.push_back(&tile);
+}
+
+bool GoldVeinIndex::getClosestReachableGoldTiles(Tile& start, const Creature& worker, std::vector<Tile*>& tiles)
+{
+    if(!mIsInitialized ||
+       (mMapSizeX != mGameMap->getMapSizeX()) ||
+       (mMapSizeY != mGameMap->getMapSizeY()))
+    {
+        rebuild(worker);
+    }
+
+    for(Tile* tile : mDirtyTiles)
+    {
+        int index = tile->getY() * mMapSizeX + tile->getX();
+        mIsTileDirty[index] = false;
+        refreshGoldTile(*tile);
+        uint8_t digPassable = isDigPassable(*tile, worker) ? 1 : 0;
+        if(mIsDigPassable[index] == digPassable)
+            continue;
+
+        mIsDigPassable[index] = digPassable;
+        mAreColorsDirty = true;
+    }
+    mDirtyTiles.clear();
+
+    if(mAreColorsDirty)
+        computeColors();
+
+    uint32_t startColor = mColors[start.getY() * mMapSizeX + start.getX()];
+    if(startColor == 0)
+        return false;
+
+    int bestDistance = std::numeric_limits<int>::max();
+    size_t firstTile = tiles.size();
+    for(Tile* tile : mGoldTiles)
+    {
+        if(mColors[tile->getY() * mMapSizeX + tile->getX()] != startColor)
+            continue;
+
+        int distX = std::abs(tile->getX() - start.getX());
+        int distY = std::abs(tile->getY() - start.getY());
+        int distance = std::max(distX, distY);
+        if(distance > bestDistance)
+            continue;
+
+        if(distance < bestDistance)
+        {
+            bestDistance = distance;
+            tiles.resize(firstTile);
+        }
+        tiles.push_back(tile);
+    }
+
+    return tiles.size() > firstTile;
+}
+
+void GoldVeinIndex::clear()
+{
+    mIsInitialized = false;
+    mGoldTiles.clear();
+    mGoldIndex.clear();
+    mIsDigPassable.clear();
+    mColors.clear();
+    mDirtyTiles.clear();
+    mIsTileDirty.clear();
+}
+
+void GoldVeinIndex::rebuild(const Creature& worker)
+{
+    mIsInitialized = true;
+    mMapSizeX = mGameMap->getMapSizeX();
+    mMapSizeY = mGameMap->getMapSizeY();
+    mGoldTiles.clear();
+    mGoldIndex.assign(mMapSizeX * mMapSizeY, -1);
+    mIsDigPassable.assign(mMapSizeX * mMapSizeY, 0);
+    mIsTileDirty.assign(mMapSizeX * mMapSizeY, false);
+    mDirtyTiles.clear();
+    for(int yy = 0; yy < mMapSizeY; ++yy)
+    {
+        for(int xx = 0; xx < mMapSizeX; ++xx)
+        {
+            Tile* tile = mGameMap->getTile(xx, yy);
+            if(tile == nullptr)
+                continue;
+
+            refreshGoldTile(*tile);
+            if(isDigPassable(*tile, worker))
+                mIsDigPassable[yy * mMapSizeX + xx] = 1;
+        }
+    }
+    mAreColorsDirty = true;
+}
+
+void GoldVeinIndex::refreshGoldTile(Tile& tile)
+{
+    int index = tile.getY() * mMapSizeX + tile.getX();
+    int32_t goldIndex = mGoldIndex[index];
+    bool isGold = isGoldVein(tile);
+    if(isGold && (goldIndex < 0))
+    {
+        mGoldIndex[index] = static_cast<int32_t>(mGoldTiles.size());
+        mGoldTiles.push_back(&tile);
+    }
+    else if(!isGold && (goldIndex >= 0))
+    {
+        Tile* lastTile = mGoldTiles.back();
+        mGoldTiles[goldIndex] = lastTile;
+        mGoldIndex[lastTile->getY() * mMapSizeX + lastTile->getX()] = goldIndex;
+        mGoldTiles.pop_back();
+        mGoldIndex[index] = -1;
+    }
+}
+
+bool GoldVeinIndex::isDigPassable(Tile& tile, const Creature& worker) const
+{
+    return worker.canGoThroughTile(&tile) || tile.isDiggable(mSeat);
+}
+
+void GoldVeinIndex::computeColors()
+{
+    mAreColorsDirty = false;
+    mColors.assign(mMapSizeX * mMapSizeY, 0);
+    uint32_t color = 0;
+    std::vector<int> toProcess;
+    for(int index = 0, size = mMapSizeX * mMapSizeY; index < size; ++index)
+    {
+        if((mIsDigPassable[index] == 0) || (mColors[index] != 0))
+            continue;
+
+        ++color;
+        mColors[index] = color;
+        toProcess.push_back(index);
+        while(!toProcess.empty())
+        {
+            int current = toProcess.back();
+            toProcess.pop_back();
+            int xx = current % mMapSizeX;
+            int yy = current / mMapSizeX;
+            int neighbors[4] = { current - 1, current + 1, current - mMapSizeX, current + mMapSizeX };
+            bool isValid[4] = { xx > 0, xx < mMapSizeX - 1, yy > 0, yy < mMapSizeY - 1 };
+            for(int i = 0; i < 4; ++i)
+            {
+                if(!isValid[i])
+                    continue;
+
+                int neigh = neighbors[i];
+                if((mIsDigPassable[neigh] == 0) || (mColors[neigh] != 0))
+                    continue;
+
+                mColors[neigh] = color;
+                toProcess.push_back(neigh);
+            }
+        }
+    }
+}
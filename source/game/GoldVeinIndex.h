@@ -0,0 +1,89 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef GOLDVEININDEX_H
+#define GOLDVEININDEX_H
+
+#include <cstdint>
+#include <vector>
+
+class Creature;
+class GameMap;
+class Seat;
+class Tile;
+
+//! \brief Index of the gold tiles that can still be dug and of the tiles a seat could reach by digging.
+//! It is used by the AI to find the closest gold vein without scanning the whole map.
+//! The reachability is computed by colouring the connected areas of tiles that are either passable for
+//! a worker or diggable by the seat. Tiles in the same area can be reached from each other by digging.
+//! The tiles notify the index when they change (see Tile::fireClaimableStateChanged). Gold tiles that
+//! have been dug out are removed and the areas are computed again only if a tile became passable/diggable
+//! or not. Note that digging a tile does not change the areas since it was diggable before.
+//! The index is built the first time it is used.
+class GoldVeinIndex
+{
+public:
+    GoldVeinIndex(GameMap* gameMap, Seat* seat);
+
+    //! \brief Called when the given tile changes in a way that may change its fullness, its owner or its passability
+    void notifyTileChanged(Tile& tile);
+
+    //! \brief Fills tiles with the gold tiles that can be reached by worker by digging from start and that
+    //! are the closest to start (using the greatest distance on x or y). Note that tiles is not cleared.
+    //! Returns false if no reachable gold tile is found.
+    bool getClosestReachableGoldTiles(Tile& start, const Creature& worker, std::vector<Tile*>& tiles);
+
+    //! \brief Empties the index. It will be rebuilt on next use
+    void clear();
+
+private:
+    static bool isGoldVein(const Tile& tile);
+
+    void rebuild(const Creature& worker);
+
+    //! \brief Adds or removes the given tile from the gold tiles depending on its state
+    void refreshGoldTile(Tile& tile);
+
+    bool isDigPassable(Tile& tile, const Creature& worker) const;
+
+    //! \brief Colours the connected areas of dig passable tiles
+    void computeColors();
+
+    GameMap* mGameMap;
+    Seat* mSeat;
+    bool mIsInitialized;
+    int mMapSizeX;
+    int mMapSizeY;
+
+    //! \brief Gold tiles with fullness > 0
+    std::vector<Tile*> mGoldTiles;
+    //! \brief Position of each tile in mGoldTiles (-1 if not a gold vein). Allows constant time removal
+    std::vector<int32_t> mGoldIndex;
+
+    //! \brief 1 if the tile is passable for a worker or diggable by the seat, 0 otherwise
+    std::vector<uint8_t> mIsDigPassable;
+    //! \brief Colour of the area each tile belongs to (0 if not dig passable)
+    std::vector<uint32_t> mColors;
+    bool mAreColorsDirty;
+
+    //! \brief Tiles changed since last query. mIsTileDirty avoids adding the same tile twice
+    std::vector<Tile*> mDirtyTiles;
+    std::vector<bool> mIsTileDirty;
+};
+
+#endif // GOLDVEININDEX_H
@@ -0,0 +1,150 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "game/RoomAvailabilityIndex.h"
+
+#include "rooms/Room.h"
+#include "rooms/RoomDormitory.h"
+
+static inline uint32_t toFlag(RoomAvailability availability)
+{
+    return 1u << static_cast<uint32_t>(availability);
+}
+
+RoomAvailabilityIndex::RoomAvailabilityIndex() :
+    mNbChanges(0)
+{
+}
+
+void RoomAvailabilityIndex::addRoom(Room& room)
+{
+    ++mNbChanges;
+    std::vector<RoomEntry>& entries = mRooms[static_cast<uint32_t>(room.getType())];
+    for(RoomEntry& entry : entries)
+    {
+        if(entry.mRoom != &room)
+            continue;
+
+        entry.mIsDirty = true;
+        return;
+    }
+
+    entries.emplace_back(&room);
+}
+
+void RoomAvailabilityIndex::removeRoom(Room& room)
+{
+    ++mNbChanges;
+    std::vector<RoomEntry>& entries = mRooms[static_cast<uint32_t>(room.getType())];
+    for(auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        if(it->mRoom != &room)
+            continue;
+
+        entries.erase(it);
+        return;
+    }
+}
+
+void RoomAvailabilityIndex::notifyRoomChanged(Room& room)
+{
+    ++mNbChanges;
+    for(RoomEntry& entry : mRooms[static_cast<uint32_t>(room.getType())])
+    {
+        if(entry.mRoom != &room)
+            continue;
+
+        entry.mIsDirty = true;
+        return;
+    }
+}
+
+void RoomAvailabilityIndex::getRooms(RoomType type, std::vector<Room*>& rooms) const
+{
+    for(const RoomEntry& entry : mRooms[static_cast<uint32_t>(type)])
+    {
+        if(entry.mRoom->numCoveredTiles() <= 0)
+            continue;
+
+        rooms.push_back(entry.mRoom);
+    }
+}
+
+void RoomAvailabilityIndex::getAvailableRooms(RoomType type, RoomAvailability availability, std::vector<Room*>& rooms)
+{
+    uint32_t flag = toFlag(availability);
+    for(RoomEntry& entry : mRooms[static_cast<uint32_t>(type)])
+    {
+        refreshEntry(entry);
+        if((entry.mAvailability & flag) == 0)
+            continue;
+
+        rooms.push_back(entry.mRoom);
+    }
+}
+
+void RoomAvailabilityIndex::getAvailableRooms(RoomAvailability availability, std::vector<Room*>& rooms)
+{
+    for(uint32_t i = 0; i < static_cast<uint32_t>(RoomType::nbRooms); ++i)
+        getAvailableRooms(static_cast<RoomType>(i), availability, rooms);
+}
+
+int32_t RoomAvailabilityIndex::getNbActiveSpots(RoomType type) const
+{
+    int32_t nbActiveSpots = 0;
+    for(const RoomEntry& entry : mRooms[static_cast<uint32_t>(type)])
+        nbActiveSpots += entry.mRoom->getNumActiveSpots();
+
+    return nbActiveSpots;
+}
+
+void RoomAvailabilityIndex::clear()
+{
+    ++mNbChanges;
+    for(std::vector<RoomEntry>& entries : mRooms)
+        entries.clear();
+}
+
+void RoomAvailabilityIndex::refreshEntry(RoomEntry& entry)
+{
+    if(!entry.mIsDirty)
+        return;
+
+    entry.mIsDirty = false;
+    entry.mAvailability = 0;
+    Room& room = *entry.mRoom;
+    // A room without any tile cannot be used
+    if(room.numCoveredTiles() <= 0)
+        return;
+
+    if(room.mayHaveOpenCreatureSpot())
+        entry.mAvailability |= toFlag(RoomAvailability::creatureSpot);
+
+    if(room.getType() == RoomType::dormitory)
+    {
+        if(static_cast<RoomDormitory&>(room).hasOpenTile())
+            entry.mAvailability |= toFlag(RoomAvailability::bed);
+    }
+
+    int goldStored = room.getTotalGoldStored();
+    if(goldStored > 0)
+        entry.mAvailability |= toFlag(RoomAvailability::goldStored);
+
+    if(goldStored < room.getTotalGoldStorage())
+        entry.mAvailability |= toFlag(RoomAvailability::goldStorage);
+}
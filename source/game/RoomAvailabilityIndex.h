@@ -0,0 +1,102 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ROOMAVAILABILITYINDEX_H
+#define ROOMAVAILABILITYINDEX_H
+
+#include "rooms/RoomType.h"
+
+#include <cstdint>
+#include <vector>
+
+class Room;
+
+enum class RoomAvailability
+{
+    creatureSpot,
+    bed,
+    goldStorage,
+    goldStored,
+    nb
+};
+
+//! \brief Index of the rooms of a seat sorted by type. For each room, it keeps track of whether it
+//! may be used by a creature (free creature spot, free bed, free gold storage or gold to take). That
+//! allows the creatures searching for a room to only check the rooms they may use instead of every room
+//! on the map.
+//! The rooms notify the index when something that may change their availability happens (see
+//! Room::fireRoomAvailabilityChanged). The availability is then computed again the next time the
+//! room is queried.
+//! The availability only depends on the room. It may be true even if a given creature cannot use the
+//! room (for example, a training hall with free dummies for a creature with a too high level). The
+//! callers should still check if the creature can use the returned rooms.
+class RoomAvailabilityIndex
+{
+public:
+    RoomAvailabilityIndex();
+
+    void addRoom(Room& room);
+    void removeRoom(Room& room);
+
+    //! \brief Called when something changed in the given room that may change its availability
+    void notifyRoomChanged(Room& room);
+
+    //! \brief Fills rooms with the rooms of the given type (with at least one covered tile). Note that rooms is not cleared.
+    void getRooms(RoomType type, std::vector<Room*>& rooms) const;
+
+    //! \brief Fills rooms with the rooms of the given type that may have the given availability.
+    //! Note that rooms is not cleared.
+    void getAvailableRooms(RoomType type, RoomAvailability availability, std::vector<Room*>& rooms);
+
+    //! \brief Same as getAvailableRooms but for all the room types
+    void getAvailableRooms(RoomAvailability availability, std::vector<Room*>& rooms);
+
+    //! \brief Returns the sum of the active spots of the rooms of the given type
+    int32_t getNbActiveSpots(RoomType type) const;
+
+    //! \brief Returns a counter increased each time a room is added, removed or notified as changed. It
+    //! allows to know whether something computed from the rooms of the seat should be computed again.
+    inline uint32_t getNbChanges() const
+    { return mNbChanges; }
+
+    void clear();
+
+private:
+    struct RoomEntry
+    {
+        RoomEntry(Room* room) :
+            mRoom(room),
+            mIsDirty(true),
+            mAvailability(0)
+        {}
+
+        Room* mRoom;
+        bool mIsDirty;
+        //! \brief Bit field of RoomAvailability
+        uint32_t mAvailability;
+    };
+
+    //! \brief Computes the availability of the given entry if needed
+    static void refreshEntry(RoomEntry& entry);
+
+    std::vector<RoomEntry> mRooms[static_cast<uint32_t>(RoomType::nbRooms)];
+
+    uint32_t mNbChanges;
+};
+
+#endif // ROOMAVAILABILITYINDEX_H
@@ -0,0 +1,209 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "game/RoomPlacementMap.h"
+
+#include "entities/Tile.h"
+#include "gamemap/GameMap.h"
+
+RoomPlacementMap::RoomPlacementMap(GameMap* gameMap, Seat* seat) :
+    mGameMap(gameMap),
+    mSeat(seat),
+    mIsInitialized(false),
+    mMapSizeX(0),
+    mMapSizeY(0),
+    mIsGroundSumsDirty(true)
+{
+}
+
+bool RoomPlacementMap::isGroundTileBuildable(Tile& tile, Seat* seat)
+{
+    switch(tile.getType())
+    {
+        case TileType::dirt:
+        case TileType::gold:
+        {
+            // Dirt and gold can always be built (even if digging may be needed depending on fullness)
+            if(!tile.isClaimed())
+                return true;
+
+            // We check if we can build on that tile and if there is no building currently
+            if(!tile.isClaimedForSeat(seat))
+                return false;
+            if(tile.getCoveringBuilding() != nullptr)
+                return false;
+
+            // We don't want to break a wall where there are activespots from another one
+            for(Tile* t : tile.getAllNeighbors())
+            {
+                if(t->isClaimedForSeat(seat) &&
+                    (t->getCoveringRoom() != nullptr))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+
+    return false;
+}
+
+bool RoomPlacementMap::isWallTileUsable(Tile& tile, Seat* seat)
+{
+    // We only consider wall claimed for the correct seat or dirt (that can be claimed)
+    if(tile.getFullness() <= 0.0)
+        return false;
+
+    if(tile.getType() == TileType::dirt)
+        return true;
+
+    if(tile.isWallClaimedForSeat(seat))
+        return true;
+
+    return false;
+}
+
+void RoomPlacementMap::notifyTileChanged(Tile& tile)
+{
+    if(!mIsInitialized)
+        return;
+
+    // Buildable ground depends on the neighbors
+    markTileDirty(tile);
+    for(Tile* neigh : tile.getAllNeighbors())
+        markTileDirty(*neigh);
+}
+
+bool RoomPlacementMap::isGroundBuildable(int x1, int y1, int x2, int y2)
+{
+    refresh();
+    if((x1 < 0) || (y1 < 0) || (x2 >= mMapSizeX) || (y2 >= mMapSizeY))
+        return false;
+    if((x1 > x2) || (y1 > y2))
+        return false;
+
+    int stride = mMapSizeX + 1;
+    uint32_t nbTiles = mGroundSums[(y2 + 1) * stride + x2 + 1]
+        - mGroundSums[y1 * stride + x2 + 1]
+        - mGroundSums[(y2 + 1) * stride + x1]
+        + mGroundSums[y1 * stride + x1];
+
+    return nbTiles == static_cast<uint32_t>((x2 - x1 + 1) * (y2 - y1 + 1));
+}
+
+bool RoomPlacementMap::isWallUsable(int x, int y)
+{
+    refresh();
+    if((x < 0) || (y < 0) || (x >= mMapSizeX) || (y >= mMapSizeY))
+        return false;
+
+    return (mTileFlags[y * mMapSizeX + x] & wallUsable) != 0;
+}
+
+void RoomPlacementMap::clear()
+{
+    mIsInitialized = false;
+    mTileFlags.clear();
+    mGroundSums.clear();
+    mDirtyTiles.clear();
+    mIsTileDirty.clear();
+}
+
+void RoomPlacementMap::refresh()
+{
+    if(!mIsInitialized ||
+       (mMapSizeX != mGameMap->getMapSizeX()) ||
+       (mMapSizeY != mGameMap->getMapSizeY()))
+    {
+        mIsInitialized = true;
+        mMapSizeX = mGameMap->getMapSizeX();
+        mMapSizeY = mGameMap->getMapSizeY();
+        mTileFlags.assign(mMapSizeX * mMapSizeY, 0);
+        mIsTileDirty.assign(mMapSizeX * mMapSizeY, false);
+        mDirtyTiles.clear();
+        for(int yy = 0; yy < mMapSizeY; ++yy)
+        {
+            for(int xx = 0; xx < mMapSizeX; ++xx)
+            {
+                Tile* tile = mGameMap->getTile(xx, yy);
+                if(tile == nullptr)
+                    continue;
+
+                refreshTile(*tile);
+            }
+        }
+        mIsGroundSumsDirty = true;
+    }
+
+    for(Tile* tile : mDirtyTiles)
+    {
+        int index = tile->getY() * mMapSizeX + tile->getX();
+        mIsTileDirty[index] = false;
+        bool wasBuildable = (mTileFlags[index] & groundBuildable) != 0;
+        refreshTile(*tile);
+        bool isBuildable = (mTileFlags[index] & groundBuildable) != 0;
+        if(wasBuildable != isBuildable)
+            mIsGroundSumsDirty = true;
+    }
+    mDirtyTiles.clear();
+
+    if(!mIsGroundSumsDirty)
+        return;
+
+    mIsGroundSumsDirty = false;
+    int stride = mMapSizeX + 1;
+    mGroundSums.assign(stride * (mMapSizeY + 1), 0);
+    for(int yy = 0; yy < mMapSizeY; ++yy)
+    {
+        uint32_t rowSum = 0;
+        for(int xx = 0; xx < mMapSizeX; ++xx)
+        {
+            if((mTileFlags[yy * mMapSizeX + xx] & groundBuildable) != 0)
+                ++rowSum;
+
+            mGroundSums[(yy + 1) * stride + xx + 1] = mGroundSums[yy * stride + xx + 1] + rowSum;
+        }
+    }
+}
+
+void RoomPlacementMap::markTileDirty(Tile& tile)
+{
+    int index = tile.getY() * mMapSizeX + tile.getX();
+    if((index < 0) || (index >= static_cast<int>(mIsTileDirty.size())))
+        return;
+
+    if(mIsTileDirty[index])
+        return;
+
+    mIsTileDirty[index] = true;
+    mDirtyTiles.push_back(&tile);
+}
+
+void RoomPlacementMap::refreshTile(Tile& tile)
+{
+    uint8_t flags = 0;
+    if(isGroundTileBuildable(tile, mSeat))
+        flags |= groundBuildable;
+    if(isWallTileUsable(tile, mSeat))
+        flags |= wallUsable;
+
+    mTileFlags[tile.getY() * mMapSizeX + tile.getX()] = flags;
+}
@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ROOMPLACEMENTMAP_H
+#define ROOMPLACEMENTMAP_H
+
+#include <cstdint>
+#include <vector>
+
+class GameMap;
+class Seat;
+class Tile;
+
+//! \brief Keeps track of the tiles where a seat may build a room. It is used by the AI to find
+//! the best place for a new room without checking every tile of every candidate square.
+//! For each tile, we store if it is ground where a room could be built (claimed by the seat and free
+//! or claimable dirt/gold) and if it is a wall that could hold a wall active spot. An integral image
+//! (summed-area table) of the buildable ground allows to know if a rectangle is fully buildable in
+//! constant time.
+//! The tiles notify the map when their state changes (see Tile::fireClaimableStateChanged). The
+//! changed tiles are computed again on next query and the integral image is rebuilt if needed.
+//! The map is built the first time it is used.
+class RoomPlacementMap
+{
+public:
+    RoomPlacementMap(GameMap* gameMap, Seat* seat);
+
+    //! \brief Called when the given tile changes in a way that may change if it or its neighbors are buildable
+    void notifyTileChanged(Tile& tile);
+
+    //! \brief Returns true if all the tiles from (x1, y1) to (x2, y2) included are on the map and
+    //! are ground where a room could be built
+    bool isGroundBuildable(int x1, int y1, int x2, int y2);
+
+    //! \brief Returns true if the given tile is a wall that could hold a wall active spot
+    bool isWallUsable(int x, int y);
+
+    //! \brief Empties the map. It will be rebuilt on next use
+    void clear();
+
+    static bool isGroundTileBuildable(Tile& tile, Seat* seat);
+    static bool isWallTileUsable(Tile& tile, Seat* seat);
+
+private:
+    enum TileFlags : uint8_t
+    {
+        groundBuildable = 0x01,
+        wallUsable = 0x02
+    };
+
+    //! \brief Builds the map if needed and computes the changed tiles again
+    void refresh();
+    void refreshTile(Tile& tile);
+    void markTileDirty(Tile& tile);
+
+    GameMap* mGameMap;
+    Seat* mSeat;
+    bool mIsInitialized;
+    int mMapSizeX;
+    int mMapSizeY;
+
+    //! \brief TileFlags of each tile
+    std::vector<uint8_t> mTileFlags;
+
+    //! \brief Integral image of the buildable ground. mGroundSums[(y + 1) * (mMapSizeX + 1) + x + 1]
+    //! is the number of buildable tiles from (0, 0) to (x, y) included
+    std::vector<uint32_t> mGroundSums;
+    bool mIsGroundSumsDirty;
+
+    //! \brief Tiles changed since last refresh. mIsTileDirty avoids adding the same tile twice
+    std::vector<Tile*> mDirtyTiles;
+    std::vector<bool> mIsTileDirty;
+};
+
+#endif // ROOMPLACEMENTMAP_H
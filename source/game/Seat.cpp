@@ -19,6 +19,7 @@
 
 #include "ai/KeeperAIType.h"
 #include "entities/Building.h"
+#include "entities/Creature.h"
 #include "entities/CreatureDefinition.h"
 #include "entities/GameEntityType.h"
 #include "entities/Tile.h"
@@ -72,6 +73,8 @@ Seat::Seat(GameMap* gameMap) :
     mPlayer(nullptr),
     mGoldMined(0),
     mDefaultWorkerClass(nullptr),
+    mTilesStatesSizeX(0),
+    mTilesStatesSizeY(0),
     mTeamIndex(0),
     mIsDebuggingVision(false),
     mSkillPoints(0),
@@ -80,7 +83,13 @@ Seat::Seat(GameMap* gameMap) :
     mConfigPlayerId(-1),
     mConfigTeamId(-1),
     mConfigFactionIndex(-1),
-    mKoCreatures(false)
+    mKoCreatures(false),
+    mWorkerJobBoard(gameMap, this),
+    mRoomPlacementMap(gameMap, this),
+    mGoldVeinIndex(gameMap, this),
+    mIsSpawnTableDirty(true),
+    mSpawnTableRoomChanges(0),
+    mSpawnTableGold(0)
 {
 }
 
@@ -106,14 +115,35 @@ Goal* Seat::getUncompleteGoal(unsigned int index)
 
 void Seat::clearUncompleteGoals()
 {
+    for(Goal* goal : mUncompleteGoals)
+        mGoalsStateVersion.erase(goal);
+
     mUncompleteGoals.clear();
 }
 
 void Seat::clearCompletedGoals()
 {
+    for(Goal* goal : mCompletedGoals)
+        mGoalsStateVersion.erase(goal);
+
     mCompletedGoals.clear();
 }
 
+bool Seat::isGoalStateChanged(const Goal& goal)
+{
+    uint32_t dependencies = goal.getDependencies();
+    if(dependencies == 0)
+        return true;
+
+    uint32_t version = mGameMap->getGoalStateVersion(dependencies);
+    auto it = mGoalsStateVersion.find(&goal);
+    if((it != mGoalsStateVersion.end()) && (it->second == version))
+        return false;
+
+    mGoalsStateVersion[&goal] = version;
+    return true;
+}
+
 unsigned int Seat::numCompletedGoals()
 {
     return mCompletedGoals.size();
@@ -146,9 +176,17 @@ unsigned int Seat::checkAllCompletedGoals()
     std::vector<Goal*>::iterator currentGoal = mCompletedGoals.begin();
     while (currentGoal != mCompletedGoals.end())
     {
+        // Nothing the goal depends on has changed since it was last checked
+        if (!isGoalStateChanged(**currentGoal))
+        {
+            ++currentGoal;
+            continue;
+        }
+
         // Start by checking if this previously met goal has now been unmet.
         if ((*currentGoal)->isUnmet(*this, *mGameMap))
         {
+            mGoalsStateVersion.erase(*currentGoal);
             mUncompleteGoals.push_back(*currentGoal);
 
             currentGoal = mCompletedGoals.erase(currentGoal);
@@ -161,6 +199,7 @@ unsigned int Seat::checkAllCompletedGoals()
             // Next check to see if this previously met goal has now been failed.
             if ((*currentGoal)->isFailed(*this, *mGameMap))
             {
+                mGoalsStateVersion.erase(*currentGoal);
                 mFailedGoals.push_back(*currentGoal);
 
                 std::vector<Seat*> seats;
@@ -232,13 +271,10 @@ void Seat::clearTilesWithVision()
     if(!mPlayer->getIsHuman())
         return;
 
-    for(std::vector<TileStateNotified>& vec : mTilesStates)
+    for(TileStateNotified& p : mTilesStates)
     {
-        for(TileStateNotified& p : vec)
-        {
-            p.mVisionTurnLast = p.mVisionTurnCurrent;
-            p.mVisionTurnCurrent = false;
-        }
+        p.mVisionTurnLast = p.mVisionTurnCurrent;
+        p.mVisionTurnCurrent = false;
     }
 }
 
@@ -249,19 +285,10 @@ void Seat::notifyVisionOnTile(Tile* tile)
     if(!mPlayer->getIsHuman())
         return;
 
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return;
-    }
-
-    TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
-    tileState.mVisionTurnCurrent = true;
+    tileState->mVisionTurnCurrent = true;
 }
 
 void Seat::notifyTileClaimedByEnemy(Tile* tile)
@@ -271,23 +298,14 @@ void Seat::notifyTileClaimedByEnemy(Tile* tile)
     if(!mPlayer->getIsHuman())
         return;
 
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return;
-    }
-
-    TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
 
     // By default, we set the tile like if it was not claimed anymore
-    tileState.mSeatIdOwner = -1;
-    tileState.mTileVisual = TileVisual::dirtGround;
-    tileState.mVisionTurnCurrent = true;
+    tileState->mSeatIdOwner = -1;
+    tileState->mTileVisual = TileVisual::dirtGround;
+    tileState->mVisionTurnCurrent = true;
 }
 
 const std::string Seat::getFactionFromLine(const std::string& line)
@@ -301,6 +319,15 @@ const std::string Seat::getFactionFromLine(const std::string& line)
     return std::string();
 }
 
+void Seat::addGoldMined(int quantity)
+{
+    if(quantity == 0)
+        return;
+
+    mGoldMined += quantity;
+    mGameMap->notifyGoalStateChanged(GoalDependency::goldMined);
+}
+
 bool Seat::takeMana(double mana)
 {
     if(mana > mMana)
@@ -344,20 +371,11 @@ bool Seat::hasVisionOnTile(Tile* tile)
     if(!mPlayer->getIsHuman())
         return true;
 
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    TileStateNotified* stateTile = getTileState(tile);
+    if(stateTile == nullptr)
         return false;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return false;
-    }
 
-    TileStateNotified& stateTile = mTilesStates[tile->getX()][tile->getY()];
-
-    return stateTile.mVisionTurnCurrent;
+    return stateTile->mVisionTurnCurrent;
 }
 
 void Seat::initSeat()
@@ -388,6 +406,7 @@ void Seat::initSeat()
         }
 
         mSpawnPool.push_back(std::pair<const CreatureDefinition*, bool>(def, false));
+        mIsSpawnTableDirty = true;
     }
 
     // Get the default worker class
@@ -439,7 +458,7 @@ void Seat::initSeat()
 
         if(!tilesRefresh.empty())
         {
-            ServerNotification *serverNotification = new ServerNotification(
+            ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::refreshTiles, getPlayer());
             uint32_t nbTiles = tilesRefresh.size();
             serverNotification->mPacket << nbTiles;
@@ -450,17 +469,10 @@ void Seat::initSeat()
 
                 // We set the tile visual to make sure the tile state is exported if
                 // game is saved again
-                if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-                {
-                    OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+                TileStateNotified* tileStateSeat = getTileState(tile);
+                if(tileStateSeat == nullptr)
                     continue;
-                }
-                if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-                {
-                    OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-                    continue;
-                }
-                mTilesStates[tile->getX()][tile->getY()] = tileState;
+                *tileStateSeat = tileState;
 
                 // Then, we export tile state to the client
                 mGameMap->tileToPacket(serverNotification->mPacket, tile);
@@ -473,6 +485,33 @@ void Seat::initSeat()
     }
 }
 
+TileStateNotified* Seat::getTileState(const Tile* tile)
+{
+    if((tile->getX() >= mTilesStatesSizeX) || (tile->getY() >= mTilesStatesSizeY))
+    {
+        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+        return nullptr;
+    }
+
+    return &mTilesStates[getTileStateIndex(tile->getX(), tile->getY())];
+}
+
+const TileStateNotified* Seat::getTileState(const Tile* tile) const
+{
+    if((tile->getX() >= mTilesStatesSizeX) || (tile->getY() >= mTilesStatesSizeY))
+    {
+        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+        return nullptr;
+    }
+
+    return &mTilesStates[getTileStateIndex(tile->getX(), tile->getY())];
+}
+
+size_t Seat::getTilesStatesMemoryFootprint() const
+{
+    return mTilesStates.capacity() * sizeof(TileStateNotified);
+}
+
 void Seat::setMapSize(int x, int y)
 {
     if(mPlayer == nullptr)
@@ -480,7 +519,9 @@ void Seat::setMapSize(int x, int y)
     if(!mPlayer->getIsHuman())
         return;
 
-    mTilesStates = std::vector<std::vector<TileStateNotified>>(x, std::vector<TileStateNotified>(y));
+    mTilesStatesSizeX = x;
+    mTilesStatesSizeY = y;
+    mTilesStates.assign(x * y, TileStateNotified());
     // By default, we know that rock (ground & full) will be set as rock full tiles,
     // gold (ground & full) will be set as gold full tiles,
     // other tiles will be set as dirt full tiles
@@ -494,17 +535,17 @@ void Seat::setMapSize(int x, int y)
 
             if(tile->getType() == TileType::gold)
             {
-                mTilesStates[xxx][yyy].mTileVisual = TileVisual::goldFull;
+                mTilesStates[getTileStateIndex(xxx, yyy)].mTileVisual = TileVisual::goldFull;
                 continue;
             }
 
             if(tile->getType() == TileType::rock)
             {
-                mTilesStates[xxx][yyy].mTileVisual = TileVisual::rockFull;
+                mTilesStates[getTileStateIndex(xxx, yyy)].mTileVisual = TileVisual::rockFull;
                 continue;
             }
 
-            mTilesStates[xxx][yyy].mTileVisual = TileVisual::dirtFull;
+            mTilesStates[getTileStateIndex(xxx, yyy)].mTileVisual = TileVisual::dirtFull;
         }
     }
 }
@@ -517,9 +558,17 @@ unsigned int Seat::checkAllGoals()
     while (currentGoal != mUncompleteGoals.end())
     {
         Goal* goal = *currentGoal;
+        // Nothing the goal depends on has changed since it was last checked
+        if (!isGoalStateChanged(*goal))
+        {
+            ++currentGoal;
+            continue;
+        }
+
         // Start by checking if the goal has been met by this seat.
         if (goal->isMet(*this, *mGameMap))
         {
+            mGoalsStateVersion.erase(goal);
             mCompletedGoals.push_back(goal);
 
             // Add any subgoals upon completion to the list of outstanding goals.
@@ -536,7 +585,7 @@ unsigned int Seat::checkAllGoals()
                getPlayer()->getIsHuman() &&
                !getPlayer()->getHasLost())
             {
-                ServerNotification *serverNotification = new ServerNotification(
+                ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                     ServerNotificationType::chatServer, getPlayer());
 
                 serverNotification->mPacket << "You have met an objective." << EventShortNoticeType::aboutObjectives;
@@ -552,6 +601,7 @@ unsigned int Seat::checkAllGoals()
             // If the goal has not been met, check to see if it cannot be met in the future.
             if (goal->isFailed(*this, *mGameMap))
             {
+                mGoalsStateVersion.erase(goal);
                 mFailedGoals.push_back(goal);
 
                 // Add any subgoals upon completion to the list of outstanding goals.
@@ -567,7 +617,7 @@ unsigned int Seat::checkAllGoals()
                    getPlayer()->getIsHuman() &&
                    !getPlayer()->getHasLost())
                 {
-                    ServerNotification *serverNotification = new ServerNotification(
+                    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                         ServerNotificationType::chatServer, getPlayer());
 
                     serverNotification->mPacket << "You have FAILED an objective!" << EventShortNoticeType::majorGameEvent;
@@ -603,13 +653,11 @@ void Seat::notifyChangedVisibleTiles()
         return;
 
     std::vector<Tile*> tilesToNotify;
-    int xMax = static_cast<int>(mTilesStates.size());
-    for(int xxx = 0; xxx < xMax; ++xxx)
+    for(int xxx = 0; xxx < mTilesStatesSizeX; ++xxx)
     {
-        int yMax = static_cast<int>(mTilesStates[xxx].size());
-        for(int yyy = 0; yyy < yMax; ++yyy)
+        for(int yyy = 0; yyy < mTilesStatesSizeY; ++yyy)
         {
-            if(!mTilesStates[xxx][yyy].mVisionTurnCurrent)
+            if(!mTilesStates[getTileStateIndex(xxx, yyy)].mVisionTurnCurrent)
                 continue;
 
             Tile* tile = mGameMap->getTile(xxx, yyy);
@@ -625,7 +673,7 @@ void Seat::notifyChangedVisibleTiles()
         return;
 
     uint32_t nbTiles = tilesToNotify.size();
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::refreshTiles, getPlayer());
     serverNotification->mPacket << nbTiles;
     for(Tile* tile : tilesToNotify)
@@ -709,13 +757,11 @@ void Seat::refreshSeatVisualDebug()
     if(mIsDebuggingVision)
     {
         std::vector<Tile*> tiles;
-        int xMax = static_cast<int>(mTilesStates.size());
-        for(int xxx = 0; xxx < xMax; ++xxx)
+        for(int xxx = 0; xxx < mTilesStatesSizeX; ++xxx)
         {
-            int yMax = static_cast<int>(mTilesStates[xxx].size());
-            for(int yyy = 0; yyy < yMax; ++yyy)
+            for(int yyy = 0; yyy < mTilesStatesSizeY; ++yyy)
             {
-                if(!mTilesStates[xxx][yyy].mVisionTurnCurrent)
+                if(!mTilesStates[getTileStateIndex(xxx, yyy)].mVisionTurnCurrent)
                     continue;
 
                 Tile* tile = mGameMap->getTile(xxx, yyy);
@@ -723,7 +769,7 @@ void Seat::refreshSeatVisualDebug()
             }
         }
         uint32_t nbTiles = tiles.size();
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::refreshSeatVisDebug, nullptr);
         serverNotification->mPacket << seatId;
         serverNotification->mPacket << true;
@@ -736,7 +782,7 @@ void Seat::refreshSeatVisualDebug()
     }
     else
     {
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::refreshSeatVisDebug, nullptr);
         serverNotification->mPacket << seatId;
         serverNotification->mPacket << false;
@@ -756,22 +802,21 @@ void Seat::sendVisibleTiles()
         return;
 
     uint32_t nbTiles;
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::refreshVisibleTiles, getPlayer());
     std::vector<Tile*> tilesVisionGained;
     std::vector<Tile*> tilesVisionLost;
     // Tiles we gained vision
-    int xMax = static_cast<int>(mTilesStates.size());
-    for(int xxx = 0; xxx < xMax; ++xxx)
+    for(int xxx = 0; xxx < mTilesStatesSizeX; ++xxx)
     {
-        int yMax = static_cast<int>(mTilesStates[xxx].size());
-        for(int yyy = 0; yyy < yMax; ++yyy)
+        for(int yyy = 0; yyy < mTilesStatesSizeY; ++yyy)
         {
-            if(mTilesStates[xxx][yyy].mVisionTurnCurrent == mTilesStates[xxx][yyy].mVisionTurnLast)
+            const TileStateNotified& tileState = mTilesStates[getTileStateIndex(xxx, yyy)];
+            if(tileState.mVisionTurnCurrent == tileState.mVisionTurnLast)
                 continue;
 
             Tile* tile = mGameMap->getTile(xxx, yyy);
-            if(mTilesStates[xxx][yyy].mVisionTurnCurrent)
+            if(tileState.mVisionTurnCurrent)
             {
                 // Vision gained
                 tilesVisionGained.push_back(tile);
@@ -1246,11 +1291,11 @@ bool Seat::exportSeatToStream(std::ostream& os) const
     }
 
     os << "[markedTiles]" << std::endl;
-    for(uint32_t xxx = 0; xxx < mTilesStates.size(); ++xxx)
+    for(int xxx = 0; xxx < mTilesStatesSizeX; ++xxx)
     {
-        for(uint32_t yyy = 0; yyy < mTilesStates[xxx].size(); ++yyy)
+        for(int yyy = 0; yyy < mTilesStatesSizeY; ++yyy)
         {
-            const TileStateNotified& tileState = mTilesStates[xxx][yyy];
+            const TileStateNotified& tileState = mTilesStates[getTileStateIndex(xxx, yyy)];
             if(!tileState.mMarkedForDigging)
                 continue;
 
@@ -1266,11 +1311,11 @@ void Seat::exportTilesVisualInitialStates(TileVisual tileVisual, std::ostream& o
 {
     os << "[" + Tile::tileVisualToString(tileVisual) + "]" << std::endl;
 
-    for(uint32_t xxx = 0; xxx < mTilesStates.size(); ++xxx)
+    for(int xxx = 0; xxx < mTilesStatesSizeX; ++xxx)
     {
-        for(uint32_t yyy = 0; yyy < mTilesStates[xxx].size(); ++yyy)
+        for(int yyy = 0; yyy < mTilesStatesSizeY; ++yyy)
         {
-            const TileStateNotified& tileState = mTilesStates[xxx][yyy];
+            const TileStateNotified& tileState = mTilesStates[getTileStateIndex(xxx, yyy)];
             if(tileState.mTileVisual != tileVisual)
                 continue;
 
@@ -1295,7 +1340,7 @@ bool Seat::addSkill(SkillType type)
        getPlayer()->getIsHuman() &&
        !getPlayer()->getHasLost())
     {
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::chatServer, getPlayer());
 
         std::string msg = Skills::skillTypeToPlayerVisibleString(type) + " is now available.";
@@ -1452,7 +1497,7 @@ void Seat::setSkillsDone(const std::vector<SkillType>& skills)
         if((getPlayer() != nullptr) && getPlayer()->getIsHuman())
         {
             // We notify the client
-            ServerNotification *serverNotification = new ServerNotification(
+            ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::skillsDone, getPlayer());
 
             uint32_t nbItems = mSkillDone.size();
@@ -1511,7 +1556,7 @@ void Seat::setSkillTree(const std::vector<SkillType>& skills)
         if((getPlayer() != nullptr) && getPlayer()->getIsHuman())
         {
             // We notify the client
-            ServerNotification *serverNotification = new ServerNotification(
+            ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::skillTree, getPlayer());
 
             uint32_t nbItems = mSkillPending.size();
@@ -1537,20 +1582,11 @@ void Seat::setSkillTree(const std::vector<SkillType>& skills)
 
 void Seat::updateTileStateForSeat(Tile* tile, bool hideSeatId)
 {
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return;
-    }
-
-    TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
-    tileState.mTileVisual = tile->getTileVisual();
-    switch(tileState.mTileVisual)
+    tileState->mTileVisual = tile->getTileVisual();
+    switch(tileState->mTileVisual)
     {
         case TileVisual::claimedFull:
         case TileVisual::claimedGround:
@@ -1560,7 +1596,7 @@ void Seat::updateTileStateForSeat(Tile* tile, bool hideSeatId)
             }
             else
             {
-                tileState.mSeatIdOwner = tile->getSeat()->getId();
+                tileState->mSeatIdOwner = tile->getSeat()->getId();
             }
             break;
         case TileVisual::waterGround:
@@ -1573,33 +1609,33 @@ void Seat::updateTileStateForSeat(Tile* tile, bool hideSeatId)
                 }
                 else
                 {
-                    tileState.mSeatIdOwner = tile->getSeat()->getId();
+                    tileState->mSeatIdOwner = tile->getSeat()->getId();
                 }
             }
             break;
         default:
-            tileState.mSeatIdOwner = -1;
+            tileState->mSeatIdOwner = -1;
             break;
     }
 
-    if(tile->getCoveringBuilding() == tileState.mBuilding)
+    if(tile->getCoveringBuilding() == tileState->mBuilding)
         return;
 
     // If we are hiding seat id, we do not notify the building about vision
     // so that it doesn't send the building seat id
-    if((tileState.mBuilding != nullptr) && !hideSeatId)
-        tileState.mBuilding->notifySeatVision(tile, this);
+    if((tileState->mBuilding != nullptr) && !hideSeatId)
+        tileState->mBuilding->notifySeatVision(tile, this);
 
     if((tile->getCoveringBuilding() != nullptr) &&
         (tile->getCoveringBuilding()->isTileVisibleForSeat(tile, this)))
     {
-        tileState.mBuilding = tile->getCoveringBuilding();
+        tileState->mBuilding = tile->getCoveringBuilding();
         if(!hideSeatId)
-            tileState.mBuilding->notifySeatVision(tile, this);
+            tileState->mBuilding->notifySeatVision(tile, this);
     }
     else
     {
-        tileState.mBuilding = nullptr;
+        tileState->mBuilding = nullptr;
     }
 }
 
@@ -1610,24 +1646,15 @@ void Seat::setVisibleBuildingOnTile(Building* building, Tile* tile)
     if(!getPlayer()->getIsHuman())
         return;
 
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return;
-    }
 
-    TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
-
-    if(building == tileState.mBuilding)
+    if(building == tileState->mBuilding)
         return;
 
-    tileState.mBuilding = building;
-    tileState.mSeatIdOwner = building->getSeat()->getId();
+    tileState->mBuilding = building;
+    tileState->mSeatIdOwner = building->getSeat()->getId();
 }
 
 void Seat::exportTileToPacket(ODPacket& os, const Tile* tile,
@@ -1644,33 +1671,24 @@ void Seat::exportTileToPacket(ODPacket& os, const Tile* tile,
         return;
     }
 
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    const TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return;
-    }
-
-    const TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
 
     int tileSeatId = -1;
     // We only pass the tile seat to the client if the tile is fully claimed
     if(!hideSeatId)
     {
-        switch(tileState.mTileVisual)
+        switch(tileState->mTileVisual)
         {
             case TileVisual::claimedGround:
             case TileVisual::claimedFull:
-                tileSeatId = tileState.mSeatIdOwner;
+                tileSeatId = tileState->mSeatIdOwner;
                 break;
             case TileVisual::waterGround:
             case TileVisual::lavaGround:
-                if(tileState.mBuilding != nullptr)
-                    tileSeatId = tileState.mSeatIdOwner;
+                if(tileState->mBuilding != nullptr)
+                    tileSeatId = tileState->mSeatIdOwner;
                 break;
             default:
                 break;
@@ -1679,10 +1697,10 @@ void Seat::exportTileToPacket(ODPacket& os, const Tile* tile,
 
     std::string meshName;
 
-    if((tileState.mBuilding != nullptr) &&
-       !tileState.mBuilding->getMeshName().empty())
+    if((tileState->mBuilding != nullptr) &&
+       !tileState->mBuilding->getMeshName().empty())
     {
-        meshName = tileState.mBuilding->getMeshName() + ".mesh";
+        meshName = tileState->mBuilding->getMeshName() + ".mesh";
     }
     else
     {
@@ -1697,24 +1715,24 @@ void Seat::exportTileToPacket(ODPacket& os, const Tile* tile,
 
     uint32_t refundPriceRoom = 0;
     uint32_t refundPriceTrap = 0;
-    if(tileState.mBuilding != nullptr)
+    if(tileState->mBuilding != nullptr)
     {
-        displayTileMesh = tileState.mBuilding->displayTileMesh();
-        colorCustomMesh = tileState.mBuilding->colorCustomMesh();
+        displayTileMesh = tileState->mBuilding->displayTileMesh();
+        colorCustomMesh = tileState->mBuilding->colorCustomMesh();
 
-        if(tileState.mBuilding->getObjectType() == GameEntityType::room)
+        if(tileState->mBuilding->getObjectType() == GameEntityType::room)
         {
             isRoom = true;
-            Room* room = static_cast<Room*>(tileState.mBuilding);
+            Room* room = static_cast<Room*>(tileState->mBuilding);
             if(room->getSeat() == this)
                 refundPriceRoom = (RoomManager::costPerTile(room->getType()) / 2);
 
             hasBridge = room->isBridge();
         }
-        else if(tileState.mBuilding->getObjectType() == GameEntityType::trap)
+        else if(tileState->mBuilding->getObjectType() == GameEntityType::trap)
         {
             isTrap = true;
-            Trap* trap = static_cast<Trap*>(tileState.mBuilding);
+            Trap* trap = static_cast<Trap*>(tileState->mBuilding);
             if(trap->getSeat() == this)
                 refundPriceTrap = (TrapManager::costPerTile(trap->getType()) / 2);
         }
@@ -1728,7 +1746,7 @@ void Seat::exportTileToPacket(ODPacket& os, const Tile* tile,
     os << hasBridge;
     os << tileSeatId;
     os << meshName;
-    os << tileState.mTileVisual;
+    os << tileState->mTileVisual;
 }
 
 void Seat::notifyBuildingRemovedFromGameMap(Building* building, Tile* tile)
@@ -1738,20 +1756,11 @@ void Seat::notifyBuildingRemovedFromGameMap(Building* building, Tile* tile)
     if(!getPlayer()->getIsHuman())
         return;
 
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return;
-    }
-
-    TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
-    if(tileState.mBuilding == building)
-        tileState.mBuilding = nullptr;
+    if(tileState->mBuilding == building)
+        tileState->mBuilding = nullptr;
 }
 
 void Seat::tileMarkedDiggingNotifiedToPlayer(Tile* tile, bool isDigSet)
@@ -1761,39 +1770,21 @@ void Seat::tileMarkedDiggingNotifiedToPlayer(Tile* tile, bool isDigSet)
     if(!getPlayer()->getIsHuman())
         return;
 
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return;
-    }
-
-    TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
-    tileState.mMarkedForDigging = isDigSet;
+    tileState->mMarkedForDigging = isDigSet;
 }
 
 bool Seat::isTileDiggableForClient(Tile* tile) const
 {
     if(!getPlayer()->getIsHuman())
         return false;
-    if(tile->getX() >= static_cast<int>(mTilesStates.size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
+    const TileStateNotified* tileState = getTileState(tile);
+    if(tileState == nullptr)
         return false;
-    }
-    if(tile->getY() >= static_cast<int>(mTilesStates[tile->getX()].size()))
-    {
-        OD_LOG_ERR("Tile=" + Tile::displayAsString(tile));
-        return false;
-    }
-
-    const TileStateNotified& tileState = mTilesStates[tile->getX()][tile->getY()];
     // Handle non claimed
-    switch(tileState.mTileVisual)
+    switch(tileState->mTileVisual)
     {
         case TileVisual::claimedGround:
         case TileVisual::dirtGround:
@@ -1813,14 +1804,14 @@ bool Seat::isTileDiggableForClient(Tile* tile) const
     }
 
     // Should be claimed tile
-    if(tileState.mTileVisual != TileVisual::claimedFull)
+    if(tileState->mTileVisual != TileVisual::claimedFull)
     {
-        OD_LOG_ERR("mTileVisual=" + Tile::tileVisualToString(tileState.mTileVisual));
+        OD_LOG_ERR("mTileVisual=" + Tile::tileVisualToString(tileState->mTileVisual));
         return false;
     }
 
     // It is claimed. If it is by the given seat team, it can be dug
-    Seat* seat = mGameMap->getSeatById(tileState.mSeatIdOwner);
+    Seat* seat = mGameMap->getSeatById(tileState->mSeatIdOwner);
     if(!canOwnedTileBeClaimedBy(seat))
         return true;
 
@@ -1829,15 +1820,62 @@ bool Seat::isTileDiggableForClient(Tile* tile) const
 
 const CreatureDefinition* Seat::getNextFighterClassToSpawn(const GameMap& gameMap, const ConfigManager& configManager)
 {
-    std::vector<std::pair<const CreatureDefinition*, int32_t> > defSpawnable;
+    if(mIsSpawnTableDirty ||
+       (mSpawnTableRoomChanges != mRoomAvailabilityIndex.getNbChanges()) ||
+       (mSpawnTableGold != getGold()))
+    {
+        buildSpawnTable(gameMap, configManager);
+    }
+
+    if(mSpawnTable.empty())
+        return nullptr;
+
+    // Check if it is the first time the conditions of a creature have been fulfilled. If yes, we force this creature to spawn
+    for(const std::pair<uint32_t, int32_t>& spawnable : mSpawnTable)
+    {
+        std::pair<const CreatureDefinition*, bool>& def = mSpawnPool[spawnable.first];
+        if(def.second)
+            continue;
+
+        if(configManager.getCreatureSpawnConditions(def.first).empty())
+            continue;
+
+        def.second = true;
+        std::vector<Seat*> seats;
+        seats.push_back(this);
+        mGameMap->fireRelativeSound(seats, SoundRelativeKeeperStatements::CreatureNew);
+        return def.first;
+    }
+
+    // We choose randomly a creature to spawn according to their points
+    int32_t nbPointsTotal = mSpawnTable.back().second;
+    int32_t cpt = Random::Int(0, nbPointsTotal - 1);
+    for(const std::pair<uint32_t, int32_t>& spawnable : mSpawnTable)
+    {
+        if(cpt < spawnable.second)
+            return mSpawnPool[spawnable.first].first;
+    }
+
+    // It is not normal to come here
+    OD_LOG_ERR("seatId=" + Helper::toString(getId()));
+    return nullptr;
+}
+
+void Seat::buildSpawnTable(const GameMap& gameMap, const ConfigManager& configManager)
+{
+    mIsSpawnTableDirty = false;
+    mSpawnTableRoomChanges = mRoomAvailabilityIndex.getNbChanges();
+    mSpawnTableGold = getGold();
+    mSpawnTable.clear();
     int32_t nbPointsTotal = 0;
-    for(std::pair<const CreatureDefinition*, bool>& def : mSpawnPool)
+    for(uint32_t index = 0; index < mSpawnPool.size(); ++index)
     {
+        const CreatureDefinition* def = mSpawnPool[index].first;
         // Only check for fighter creatures.
-        if (!def.first || def.first->isWorker())
+        if (!def || def->isWorker())
             continue;
 
-        const std::vector<const SpawnCondition*>& conditions = configManager.getCreatureSpawnConditions(def.first);
+        const std::vector<const SpawnCondition*>& conditions = configManager.getCreatureSpawnConditions(def);
         int32_t nbPointsConditions = 0;
         for(const SpawnCondition* condition : conditions)
         {
@@ -1855,36 +1893,56 @@ const CreatureDefinition* Seat::getNextFighterClassToSpawn(const GameMap& gameMa
         if(nbPointsConditions < 0)
             continue;
 
-        // Check if it is the first time this conditions have been fulfilled. If yes, we force this creature to spawn
-        if(!def.second && !conditions.empty())
-        {
-            def.second = true;
-            std::vector<Seat*> seats;
-            seats.push_back(this);
-            mGameMap->fireRelativeSound(seats, SoundRelativeKeeperStatements::CreatureNew);
-            return def.first;
-        }
         nbPointsConditions += configManager.getBaseSpawnPoint();
-        defSpawnable.push_back(std::pair<const CreatureDefinition*, int32_t>(def.first, nbPointsConditions));
         nbPointsTotal += nbPointsConditions;
+        mSpawnTable.push_back(std::pair<uint32_t, int32_t>(index, nbPointsTotal));
     }
+}
 
-    if(defSpawnable.empty())
-        return nullptr;
+void Seat::notifyAliveCreaturesChanged()
+{
+    mIsSpawnTableDirty = true;
+}
 
-    // We choose randomly a creature to spawn according to their points
-    int32_t cpt = Random::Int(0, nbPointsTotal - 1);
-    for(std::pair<const CreatureDefinition*, int32_t>& def : defSpawnable)
-    {
-        if(cpt < def.second)
-            return def.first;
+void Seat::addAliveCreature(const CreatureDefinition* definition)
+{
+    ++mNbAliveCreatures[definition];
+    if(definition->isWorker())
+        ++mNumCreaturesWorkers;
+    else
+        ++mNumCreaturesFighters;
 
-        cpt -= def.second;
+    notifyAliveCreaturesChanged();
+}
+
+void Seat::removeAliveCreature(const CreatureDefinition* definition)
+{
+    auto it = mNbAliveCreatures.find(definition);
+    if(it == mNbAliveCreatures.end())
+    {
+        OD_LOG_ERR("seatId=" + Helper::toString(getId()) + ", class=" + definition->getClassName());
+        return;
     }
 
-    // It is not normal to come here
-    OD_LOG_ERR("seatId=" + Helper::toString(getId()));
-    return nullptr;
+    --it->second;
+    if(it->second <= 0)
+        mNbAliveCreatures.erase(it);
+
+    if(definition->isWorker())
+        --mNumCreaturesWorkers;
+    else
+        --mNumCreaturesFighters;
+
+    notifyAliveCreaturesChanged();
+}
+
+int32_t Seat::getNbAliveCreatures(const CreatureDefinition* definition) const
+{
+    auto it = mNbAliveCreatures.find(definition);
+    if(it == mNbAliveCreatures.end())
+        return 0;
+
+    return it->second;
 }
 
 int Seat::readTilesVisualInitialStates(TileVisual tileVisual, std::istream& is)
@@ -1935,7 +1993,7 @@ void Seat::setPlayerSettings(bool koCreatures)
         return;
 
     // We send a message to the client to update his settings
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::setPlayerSettings, getPlayer());
 
     serverNotification->mPacket << mKoCreatures;
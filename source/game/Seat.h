@@ -19,9 +19,14 @@
 #define SEAT_H
 
 #include "game/SeatData.h"
+#include "game/GoldVeinIndex.h"
+#include "game/RoomAvailabilityIndex.h"
+#include "game/RoomPlacementMap.h"
+#include "game/WorkerJobBoard.h"
 
 #include <OgreVector3.h>
 #include <OgreColourValue.h>
+#include <map>
 #include <string>
 #include <vector>
 #include <iosfwd>
@@ -70,6 +75,25 @@ public:
     inline Player* getPlayer() const
     { return mPlayer; }
 
+    //! \brief Tiles where the workers of this seat can find something to do (server side only)
+    inline WorkerJobBoard& getWorkerJobBoard()
+    { return mWorkerJobBoard; }
+
+    //! \brief Rooms of this seat that may be used by its creatures (server side only)
+    inline RoomAvailabilityIndex& getRoomAvailabilityIndex()
+    { return mRoomAvailabilityIndex; }
+
+    inline const RoomAvailabilityIndex& getRoomAvailabilityIndex() const
+    { return mRoomAvailabilityIndex; }
+
+    //! \brief Tiles where this seat could build rooms (server side only)
+    inline RoomPlacementMap& getRoomPlacementMap()
+    { return mRoomPlacementMap; }
+
+    //! \brief Gold tiles this seat could reach by digging (server side only)
+    inline GoldVeinIndex& getGoldVeinIndex()
+    { return mGoldVeinIndex; }
+
     //! \brief Adds a goal to the vector of goals which must be completed by this seat before it can be declared a winner.
     void addGoal(Goal* g);
 
@@ -164,8 +188,7 @@ public:
     inline Ogre::Vector3 getStartingPosition() const
     { return Ogre::Vector3(static_cast<Ogre::Real>(mStartingX), static_cast<Ogre::Real>(mStartingY), 0); }
 
-    inline void addGoldMined(int quantity)
-    { mGoldMined += quantity; }
+    void addGoldMined(int quantity);
 
     inline bool getIsDebuggingVision()
     { return mIsDebuggingVision; }
@@ -184,9 +207,24 @@ public:
 
     void setMapSize(int x, int y);
 
+    //! \brief Returns the memory used by the tiles states of this seat (in bytes)
+    size_t getTilesStatesMemoryFootprint() const;
+
     //! \brief Returns the next fighter creature class to spawn.
     const CreatureDefinition* getNextFighterClassToSpawn(const GameMap& gameMap, const ConfigManager& configManager );
 
+    //! \brief Should be called when a creature of this seat is added, removed, dies or changes seat.
+    //! The spawn table will then be built again the next time it is needed.
+    void notifyAliveCreaturesChanged();
+
+    //! \brief Updates the alive creatures counters of this seat (by definition and workers/fighters). They are
+    //! called by the creatures when they enter or leave the counters (see Creature::updateAliveCounters)
+    void addAliveCreature(const CreatureDefinition* definition);
+    void removeAliveCreature(const CreatureDefinition* definition);
+
+    //! \brief Returns the number of alive creatures of this seat with the given definition.
+    int32_t getNbAliveCreatures(const CreatureDefinition* definition) const;
+
     //! \brief Returns the first (default) worker class definition.
     inline const CreatureDefinition* getWorkerClassToSpawn()
     { return mDefaultWorkerClass; }
@@ -345,6 +383,14 @@ private:
     //! \brief Currently failed goals which cannot possibly be met in the future.
     std::vector<Goal*> mFailedGoals;
 
+    //! \brief Game state version (see GameMap::getGoalStateVersion) when the uncomplete and
+    //! completed goals were last evaluated. Goals are removed when they change list.
+    std::map<const Goal*, uint32_t> mGoalsStateVersion;
+
+    //! \brief Returns true if the given goal has to be evaluated because the game state it
+    //! depends on has changed since it was last evaluated
+    bool isGoalStateChanged(const Goal& goal);
+
     //! \brief Contains all the seats allied with the current one, not including it. Used on server side only.
     std::vector<Seat*> mAlliedSeats;
 
@@ -356,10 +402,12 @@ private:
     //! \brief The default workers spawned in temples.
     const CreatureDefinition* mDefaultWorkerClass;
 
-    //! \brief List of all the tiles in the gamemap (used for human players seats only). The first vector stores the X position.
-    //! The second vector stores the Y position. TileStateNotified contains information about the tile
+    //! \brief States of all the tiles in the gamemap (used for human players seats only) stored
+    //! in a single array indexed by getTileStateIndex. TileStateNotified contains information about the tile
     //! state (last tile state notified, vision last turn for this seat, vision for current turn, ...
-    std::vector<std::vector<TileStateNotified>> mTilesStates;
+    std::vector<TileStateNotified> mTilesStates;
+    int mTilesStatesSizeX;
+    int mTilesStatesSizeY;
 
     std::map<std::pair<int, int>, TileStateNotified> mTilesStateLoaded;
 
@@ -395,6 +443,28 @@ private:
     //! \brief Should the creatures fight to death or ko enemy creatures
     bool mKoCreatures;
 
+    WorkerJobBoard mWorkerJobBoard;
+
+    RoomAvailabilityIndex mRoomAvailabilityIndex;
+
+    RoomPlacementMap mRoomPlacementMap;
+
+    GoldVeinIndex mGoldVeinIndex;
+
+    //! \brief Number of alive creatures by definition. Updated by addAliveCreature and removeAliveCreature
+    std::map<const CreatureDefinition*, int32_t> mNbAliveCreatures;
+
+    //! \brief Creatures from mSpawnPool whose spawn conditions are met. For each of them, we store its index
+    //! in mSpawnPool and the sum of its spawn points with the ones of the previous creatures in the table.
+    //! The table is built again when the creatures, the rooms or the gold of the seat have changed.
+    std::vector<std::pair<uint32_t, int32_t>> mSpawnTable;
+    bool mIsSpawnTableDirty;
+    uint32_t mSpawnTableRoomChanges;
+    int mSpawnTableGold;
+
+    //! \brief Fills mSpawnTable according to the spawn conditions of the creatures in mSpawnPool
+    void buildSpawnTable(const GameMap& gameMap, const ConfigManager& configManager);
+
     //! \brief Server side function. Sets mCurrentSkill to the first entry in mSkillPending. If the pending
     //! list in empty, mCurrentSkill will be set to null
     //! researchedType is the currently researched type if any (nullSkillType if none)
@@ -406,6 +476,13 @@ private:
 
     //! exports the tiles of the corresponding TileVisual this seat have seen
     void exportTilesVisualInitialStates(TileVisual tileVisual, std::ostream& os) const;
+
+    inline uint32_t getTileStateIndex(int x, int y) const
+    { return static_cast<uint32_t>(x * mTilesStatesSizeY + y); }
+
+    //! \brief Returns the state of the given tile or nullptr (and logs an error) if it is out of the map
+    TileStateNotified* getTileState(const Tile* tile);
+    const TileStateNotified* getTileState(const Tile* tile) const;
 };
 
 #endif // SEAT_H
@@ -0,0 +1,278 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "game/WorkerJobBoard.h"
+
+#include "entities/Tile.h"
+#include "game/Player.h"
+#include "game/Seat.h"
+#include "gamemap/GameMap.h"
+
+#include <algorithm>
+
+//! \brief Size (in tiles) of the side of a bucket
+static const int BUCKET_SIZE = 8;
+
+static bool isGroundClaimJob(Tile& tile, Seat* seat)
+{
+    if(tile.isFullTile())
+        return false;
+    if(!tile.isGroundClaimable(seat))
+        return false;
+
+    // A ground tile can be claimed only next to a tile fully claimed by the seat
+    for(Tile* neigh : tile.getAllNeighbors())
+    {
+        if(neigh->isFullTile())
+            continue;
+        if(!neigh->isClaimedForSeat(seat))
+            continue;
+        if(neigh->getClaimedPercentage() < 1.0)
+            continue;
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool isWallClaimJob(Tile& tile, Seat* seat)
+{
+    return tile.isWallClaimable(seat);
+}
+
+void WorkerJobBoard::TileBuckets::init(int mapSizeX, int mapSizeY)
+{
+    mMapSizeX = mapSizeX;
+    mNbBucketsX = (mapSizeX + BUCKET_SIZE - 1) / BUCKET_SIZE;
+    mNbBucketsY = (mapSizeY + BUCKET_SIZE - 1) / BUCKET_SIZE;
+    mBuckets.assign(mNbBucketsX * mNbBucketsY, std::vector<Tile*>());
+    mIndexInBucket.assign(mapSizeX * mapSizeY, -1);
+    mSize = 0;
+}
+
+void WorkerJobBoard::TileBuckets::clear()
+{
+    mBuckets.clear();
+    mIndexInBucket.clear();
+    mNbBucketsX = 0;
+    mNbBucketsY = 0;
+    mMapSizeX = 0;
+    mSize = 0;
+}
+
+void WorkerJobBoard::TileBuckets::add(Tile& tile)
+{
+    uint32_t tileIndex = static_cast<uint32_t>(tile.getX() + tile.getY() * mMapSizeX);
+    if(tileIndex >= mIndexInBucket.size())
+        return;
+
+    if(mIndexInBucket[tileIndex] != -1)
+        return;
+
+    std::vector<Tile*>& bucket = mBuckets[(tile.getX() / BUCKET_SIZE) + (tile.getY() / BUCKET_SIZE) * mNbBucketsX];
+    mIndexInBucket[tileIndex] = static_cast<int32_t>(bucket.size());
+    bucket.push_back(&tile);
+    ++mSize;
+}
+
+void WorkerJobBoard::TileBuckets::remove(Tile& tile)
+{
+    uint32_t tileIndex = static_cast<uint32_t>(tile.getX() + tile.getY() * mMapSizeX);
+    if(tileIndex >= mIndexInBucket.size())
+        return;
+
+    int32_t index = mIndexInBucket[tileIndex];
+    if(index == -1)
+        return;
+
+    // We move the last tile of the bucket in place of the removed one
+    std::vector<Tile*>& bucket = mBuckets[(tile.getX() / BUCKET_SIZE) + (tile.getY() / BUCKET_SIZE) * mNbBucketsX];
+    Tile* lastTile = bucket.back();
+    bucket[index] = lastTile;
+    mIndexInBucket[lastTile->getX() + lastTile->getY() * mMapSizeX] = index;
+    bucket.pop_back();
+    mIndexInBucket[tileIndex] = -1;
+    --mSize;
+}
+
+void WorkerJobBoard::TileBuckets::getTilesInRadius(int x, int y, int radius, std::vector<Tile*>& tiles) const
+{
+    if(mSize == 0)
+        return;
+
+    int bucketXMin = std::max(0, (x - radius) / BUCKET_SIZE);
+    int bucketXMax = std::min(mNbBucketsX - 1, (x + radius) / BUCKET_SIZE);
+    int bucketYMin = std::max(0, (y - radius) / BUCKET_SIZE);
+    int bucketYMax = std::min(mNbBucketsY - 1, (y + radius) / BUCKET_SIZE);
+    int radiusSquared = radius * radius;
+    for(int bucketY = bucketYMin; bucketY <= bucketYMax; ++bucketY)
+    {
+        for(int bucketX = bucketXMin; bucketX <= bucketXMax; ++bucketX)
+        {
+            for(Tile* tile : mBuckets[bucketX + bucketY * mNbBucketsX])
+            {
+                int diffX = tile->getX() - x;
+                int diffY = tile->getY() - y;
+                if(diffX * diffX + diffY * diffY > radiusSquared)
+                    continue;
+
+                tiles.push_back(tile);
+            }
+        }
+    }
+}
+
+WorkerJobBoard::WorkerJobBoard(GameMap* gameMap, Seat* seat) :
+    mGameMap(gameMap),
+    mSeat(seat),
+    mIsInitialized(false),
+    mMapSizeX(0),
+    mMapSizeY(0)
+{
+}
+
+void WorkerJobBoard::addTile(WorkerJobType type, Tile& tile)
+{
+    if(!mIsInitialized)
+        return;
+
+    mJobs[static_cast<uint32_t>(type)].add(tile);
+}
+
+void WorkerJobBoard::removeTile(WorkerJobType type, Tile& tile)
+{
+    if(!mIsInitialized)
+        return;
+
+    mJobs[static_cast<uint32_t>(type)].remove(tile);
+}
+
+void WorkerJobBoard::notifyClaimableTileChanged(Tile& tile)
+{
+    if(!mIsInitialized)
+        return;
+
+    // Claimable tiles depend on their neighbors
+    TileBuckets& groundJobs = mJobs[static_cast<uint32_t>(WorkerJobType::claimGround)];
+    TileBuckets& wallJobs = mJobs[static_cast<uint32_t>(WorkerJobType::claimWall)];
+    if(isGroundClaimJob(tile, mSeat))
+        groundJobs.add(tile);
+    if(isWallClaimJob(tile, mSeat))
+        wallJobs.add(tile);
+
+    for(Tile* neigh : tile.getAllNeighbors())
+    {
+        if(isGroundClaimJob(*neigh, mSeat))
+            groundJobs.add(*neigh);
+        if(isWallClaimJob(*neigh, mSeat))
+            wallJobs.add(*neigh);
+    }
+}
+
+void WorkerJobBoard::getCandidates(WorkerJobType type, const Tile& center, int radius, std::vector<Tile*>& tiles)
+{
+    if(!mIsInitialized ||
+       (mMapSizeX != mGameMap->getMapSizeX()) ||
+       (mMapSizeY != mGameMap->getMapSizeY()))
+    {
+        rebuild();
+    }
+
+    bool isClaimJob = (type == WorkerJobType::claimGround) || (type == WorkerJobType::claimWall);
+
+    TileBuckets& jobs = mJobs[static_cast<uint32_t>(type)];
+    uint32_t firstIndex = tiles.size();
+    jobs.getTilesInRadius(center.getX(), center.getY(), radius, tiles);
+    if(!isClaimJob)
+        return;
+
+    // The claimable tiles are added when they may have become claimable. We remove the ones
+    // that are not claimable anymore
+    uint32_t nbTiles = firstIndex;
+    for(uint32_t index = firstIndex; index < tiles.size(); ++index)
+    {
+        Tile* tile = tiles[index];
+        bool isValid = (type == WorkerJobType::claimGround) ? isGroundClaimJob(*tile, mSeat) : isWallClaimJob(*tile, mSeat);
+        if(!isValid)
+        {
+            jobs.remove(*tile);
+            continue;
+        }
+
+        tiles[nbTiles] = tile;
+        ++nbTiles;
+    }
+    tiles.resize(nbTiles);
+}
+
+void WorkerJobBoard::clear()
+{
+    mIsInitialized = false;
+    for(TileBuckets& jobs : mJobs)
+        jobs.clear();
+}
+
+void WorkerJobBoard::rebuild()
+{
+    mIsInitialized = true;
+    mMapSizeX = mGameMap->getMapSizeX();
+    mMapSizeY = mGameMap->getMapSizeY();
+    for(TileBuckets& jobs : mJobs)
+        jobs.init(mMapSizeX, mMapSizeY);
+
+    Player* player = mSeat->getPlayer();
+    TileBuckets& digJobs = mJobs[static_cast<uint32_t>(WorkerJobType::dig)];
+    TileBuckets& carryJobs = mJobs[static_cast<uint32_t>(WorkerJobType::carry)];
+    for(int yy = 0; yy < mMapSizeY; ++yy)
+    {
+        for(int xx = 0; xx < mMapSizeX; ++xx)
+        {
+            Tile* tile = mGameMap->getTile(xx, yy);
+            if(tile == nullptr)
+                continue;
+
+            if((player != nullptr) && tile->getMarkedForDigging(player))
+                digJobs.add(*tile);
+
+            if(tile->numEntitiesInTile() > 0)
+                carryJobs.add(*tile);
+        }
+    }
+
+    rebuildClaimableTiles();
+}
+
+void WorkerJobBoard::rebuildClaimableTiles()
+{
+    TileBuckets& groundJobs = mJobs[static_cast<uint32_t>(WorkerJobType::claimGround)];
+    TileBuckets& wallJobs = mJobs[static_cast<uint32_t>(WorkerJobType::claimWall)];
+    for(int yy = 0; yy < mMapSizeY; ++yy)
+    {
+        for(int xx = 0; xx < mMapSizeX; ++xx)
+        {
+            Tile* tile = mGameMap->getTile(xx, yy);
+            if(tile == nullptr)
+                continue;
+
+            if(isGroundClaimJob(*tile, mSeat))
+                groundJobs.add(*tile);
+            if(isWallClaimJob(*tile, mSeat))
+                wallJobs.add(*tile);
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WORKERJOBBOARD_H
+#define WORKERJOBBOARD_H
+
+#include <cstdint>
+#include <vector>
+
+class GameMap;
+class Seat;
+class Tile;
+
+enum class WorkerJobType
+{
+    dig,
+    claimGround,
+    claimWall,
+    carry,
+    nb
+};
+
+//! \brief Index of the tiles where the workers of a seat may find a job. Without it, each idle worker
+//! would scan every tile in its sight radius looking for work. The tiles are stored in buckets of
+//! BUCKET_SIZE x BUCKET_SIZE tiles so that the candidates around a worker can be retrieved without
+//! going through the whole map.
+//! The board is updated by the tiles when their state changes:
+//! - dig: the tiles marked for digging by the seat player (exact).
+//! - claimGround/claimWall: the tiles that may be claimable by the seat. A tile is added each time it
+//!   or one of its neighbors changes, so the entries that are not claimable anymore can be removed by
+//!   the workers when they check them (see removeTile).
+//! - carry: the tiles containing entities (exact). The workers check if they are carryable.
+//! Tiles are not reserved by the board itself: the workers still lock the tile they work on (see
+//! Tile::addWorkerDigging, Tile::addWorkerClaiming and GameEntity::getCarryLock) and skip locked tiles.
+//! The board is built the first time it is used.
+class WorkerJobBoard
+{
+public:
+    WorkerJobBoard(GameMap* gameMap, Seat* seat);
+
+    inline bool isInitialized() const
+    { return mIsInitialized; }
+
+    void addTile(WorkerJobType type, Tile& tile);
+    void removeTile(WorkerJobType type, Tile& tile);
+
+    //! \brief Called when the given tile changes in a way that may change if it or its neighbors are claimable
+    void notifyClaimableTileChanged(Tile& tile);
+
+    //! \brief Fills tiles with the candidate tiles of the given type within radius around the given tile.
+    //! Note that tiles is not cleared.
+    void getCandidates(WorkerJobType type, const Tile& center, int radius, std::vector<Tile*>& tiles);
+
+    //! \brief Empties the board. It will be rebuilt on next use
+    void clear();
+
+private:
+    //! \brief Set of tiles stored by buckets
+    class TileBuckets
+    {
+    public:
+        TileBuckets() :
+            mNbBucketsX(0),
+            mNbBucketsY(0),
+            mMapSizeX(0),
+            mSize(0)
+        {}
+
+        void init(int mapSizeX, int mapSizeY);
+        void clear();
+        void add(Tile& tile);
+        void remove(Tile& tile);
+
+        inline uint32_t size() const
+        { return mSize; }
+
+        void getTilesInRadius(int x, int y, int radius, std::vector<Tile*>& tiles) const;
+
+    private:
+        int mNbBucketsX;
+        int mNbBucketsY;
+        int mMapSizeX;
+        uint32_t mSize;
+        std::vector<std::vector<Tile*>> mBuckets;
+        //! \brief Position of each tile in its bucket (-1 if not in the set). Allows constant time removal
+        std::vector<int32_t> mIndexInBucket;
+    };
+
+    //! \brief Builds the board from the current gamemap state
+    void rebuild();
+
+    //! \brief Adds the claimable tiles from the whole map
+    void rebuildClaimableTiles();
+
+    GameMap* mGameMap;
+    Seat* mSeat;
+    bool mIsInitialized;
+    int mMapSizeX;
+    int mMapSizeY;
+
+    TileBuckets mJobs[static_cast<uint32_t>(WorkerJobType::nb)];
+};
+
+#endif // WORKERJOBBOARD_H
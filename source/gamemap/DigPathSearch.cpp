@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "gamemap/DigPathSearch.h"
+
+#include "entities/Creature.h"
+#include "entities/Tile.h"
+#include "game/Seat.h"
+#include "gamemap/GameMap.h"
+#include "utils/ConfigManager.h"
+#include "ODApplication.h"
+
+bool DigPathSearch::findDigPath(GameMap& gameMap, Tile& tileStart, Tile& tileDest, const Creature& digger,
+    std::vector<Tile*>& tilesToDig)
+{
+    const Seat* seat = digger.getSeat();
+
+    // Costs are in turns. Digging is done every turn while walking depends on the creature speed
+    double walkCost = 1.0;
+    if(digger.getMoveSpeedGround() > 0.0)
+        walkCost = ODApplication::turnsPerSecond / digger.getMoveSpeedGround();
+
+    // If the creature cannot dig, we consider the dig rate of a standard worker
+    double digRate = digger.getDigRate();
+    if(digRate <= 0.0)
+        digRate = 1.0;
+
+    static double digCoefClaimedWall = ConfigManager::getSingleton().getDigCoefClaimedWall();
+    auto tileCost = [&](int32_t x, int32_t y) -> double
+    {
+        Tile* tile = gameMap.getTile(x, y);
+        if(digger.canGoThroughTile(tile))
+            return walkCost;
+
+        if(!tile->isDiggable(seat))
+            return -1.0;
+
+        double rate = digRate;
+        if(tile->getTileVisual() == TileVisual::claimedFull)
+            rate *= digCoefClaimedWall;
+
+        if(rate <= 0.0)
+            return -1.0;
+
+        return walkCost + tile->getFullness() / rate;
+    };
+
+    bool isDestReached = search(gameMap.getMapSizeX(), gameMap.getMapSizeY(), tileStart.getX(), tileStart.getY(),
+        tileDest.getX(), tileDest.getY(), walkCost, tileCost, mPath);
+
+    for(uint32_t index : mPath)
+    {
+        Tile* tile = gameMap.getTile(static_cast<int>(index) % gameMap.getMapSizeX(),
+            static_cast<int>(index) / gameMap.getMapSizeX());
+        if(!digger.canGoThroughTile(tile))
+            tilesToDig.push_back(tile);
+    }
+
+    return isDestReached;
+}
@@ -0,0 +1,227 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef DIGPATHSEARCH_H
+#define DIGPATHSEARCH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+class Creature;
+class GameMap;
+class Tile;
+
+//! \brief Searches the path that takes the least time to walk and dig from a tile to another. Contrary to
+//! GameMap::path with throughDiggableTiles, diggable tiles are not free: their cost is the time needed to dig
+//! them. The search buffers are allocated once for the map size and reused by the next searches. The number
+//! of tiles expanded by a search is bounded so that a search on a big map cannot stall a turn.
+//! A DigPathSearch should not be used by several threads at the same time.
+class DigPathSearch
+{
+public:
+    static const uint32_t DEFAULT_MAX_EXPANDED_TILES = 40000;
+
+    explicit DigPathSearch(uint32_t maxExpandedTiles = DEFAULT_MAX_EXPANDED_TILES) :
+        mMaxExpandedTiles(maxExpandedTiles),
+        mNbExpandedTiles(0),
+        mSearchId(0)
+    {}
+
+    //! \brief Searches the cheapest path from tileStart to tileDest for the given digger. The tiles the
+    //! digger cannot go through but can dig are added to tilesToDig (in path order). If tileDest cannot
+    //! be reached, the path to the closest tile from tileDest that could be reached is used.
+    //! Returns true if tileDest can be reached and false otherwise.
+    bool findDigPath(GameMap& gameMap, Tile& tileStart, Tile& tileDest, const Creature& digger,
+        std::vector<Tile*>& tilesToDig);
+
+    //! \brief Generic weighted search on a sizeX * sizeY grid (4-connected). tileCost(x, y) should return
+    //! the cost of entering the tile or a negative value if the tile cannot be crossed. minCost is the lowest
+    //! cost a tile can have (used to estimate the remaining cost). The path (tile indexes x + y * sizeX, from
+    //! start to destination) is set in path. If the destination cannot be reached, path leads to the
+    //! reached tile closest to the destination.
+    //! Returns true if the destination has been reached and false otherwise.
+    template<typename TileCostFunction>
+    bool search(int32_t sizeX, int32_t sizeY, int32_t startX, int32_t startY, int32_t destX, int32_t destY,
+        double minCost, const TileCostFunction& tileCost, std::vector<uint32_t>& path);
+
+    //! \brief Number of tiles expanded by the last search
+    inline uint32_t getNbExpandedTiles() const
+    { return mNbExpandedTiles; }
+
+private:
+    struct OpenTile
+    {
+        double mEstimatedCost;
+        uint32_t mIndex;
+
+        //! \brief For the heap to return the lowest cost first. The index makes the order
+        //! deterministic between tiles with the same cost
+        bool operator<(const OpenTile& other) const
+        {
+            if(mEstimatedCost != other.mEstimatedCost)
+                return mEstimatedCost > other.mEstimatedCost;
+
+            return mIndex > other.mIndex;
+        }
+    };
+
+    //! \brief Resizes the buffers if the map size changed and starts a new search
+    void startSearch(uint32_t nbTiles)
+    {
+        mOpenTiles.clear();
+        if(mSearchIds.size() != nbTiles)
+        {
+            mSearchIds.assign(nbTiles, 0);
+            mCosts.resize(nbTiles);
+            mParents.resize(nbTiles);
+            mIsClosed.resize(nbTiles);
+            mSearchId = 0;
+        }
+
+        ++mSearchId;
+        // If the id wraps, old values could be taken for valid ones
+        if(mSearchId == 0)
+        {
+            std::fill(mSearchIds.begin(), mSearchIds.end(), 0);
+            mSearchId = 1;
+        }
+    }
+
+    uint32_t mMaxExpandedTiles;
+    uint32_t mNbExpandedTiles;
+
+    //! \brief The buffers are only valid for the tiles where mSearchIds equals mSearchId. That avoids
+    //! clearing them before each search
+    uint32_t mSearchId;
+    std::vector<uint32_t> mSearchIds;
+    std::vector<double> mCosts;
+    std::vector<uint32_t> mParents;
+    std::vector<bool> mIsClosed;
+    //! \brief Heap of the tiles to expand
+    std::vector<OpenTile> mOpenTiles;
+    //! \brief Path found by findDigPath
+    std::vector<uint32_t> mPath;
+};
+
+template<typename TileCostFunction>
+bool DigPathSearch::search(int32_t sizeX, int32_t sizeY, int32_t startX, int32_t startY, int32_t destX, int32_t destY,
+    double minCost, const TileCostFunction& tileCost, std::vector<uint32_t>& path)
+{
+    path.clear();
+    mNbExpandedTiles = 0;
+    if((sizeX <= 0) || (sizeY <= 0) ||
+       (startX < 0) || (startX >= sizeX) || (startY < 0) || (startY >= sizeY) ||
+       (destX < 0) || (destX >= sizeX) || (destY < 0) || (destY >= sizeY))
+    {
+        return false;
+    }
+
+    double startCost = tileCost(startX, startY);
+    if(startCost < 0.0)
+        return false;
+
+    startSearch(static_cast<uint32_t>(sizeX * sizeY));
+
+    uint32_t startIndex = static_cast<uint32_t>(startX + startY * sizeX);
+    uint32_t destIndex = static_cast<uint32_t>(destX + destY * sizeX);
+    mSearchIds[startIndex] = mSearchId;
+    mCosts[startIndex] = startCost;
+    mParents[startIndex] = startIndex;
+    mIsClosed[startIndex] = false;
+    mOpenTiles.push_back(OpenTile{startCost, startIndex});
+
+    // Closest tile to the destination we reached (used if the destination cannot be reached)
+    uint32_t closestIndex = startIndex;
+    int32_t closestDist = std::abs(destX - startX) + std::abs(destY - startY);
+
+    static const int32_t neighbors[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    bool isDestReached = false;
+    while(!mOpenTiles.empty() && (mNbExpandedTiles < mMaxExpandedTiles))
+    {
+        std::pop_heap(mOpenTiles.begin(), mOpenTiles.end());
+        uint32_t index = mOpenTiles.back().mIndex;
+        mOpenTiles.pop_back();
+        // A tile can be in the open list several times if a cheaper way has been found after it was added
+        if(mIsClosed[index])
+            continue;
+
+        mIsClosed[index] = true;
+        ++mNbExpandedTiles;
+        if(index == destIndex)
+        {
+            isDestReached = true;
+            break;
+        }
+
+        int32_t x = static_cast<int32_t>(index) % sizeX;
+        int32_t y = static_cast<int32_t>(index) / sizeX;
+        int32_t dist = std::abs(destX - x) + std::abs(destY - y);
+        if((dist < closestDist) ||
+           ((dist == closestDist) && (mCosts[index] < mCosts[closestIndex])))
+        {
+            closestDist = dist;
+            closestIndex = index;
+        }
+
+        for(const int32_t* neighbor : neighbors)
+        {
+            int32_t neighX = x + neighbor[0];
+            int32_t neighY = y + neighbor[1];
+            if((neighX < 0) || (neighX >= sizeX) || (neighY < 0) || (neighY >= sizeY))
+                continue;
+
+            uint32_t neighIndex = static_cast<uint32_t>(neighX + neighY * sizeX);
+            bool isKnown = (mSearchIds[neighIndex] == mSearchId);
+            if(isKnown && mIsClosed[neighIndex])
+                continue;
+
+            double cost = tileCost(neighX, neighY);
+            if(cost < 0.0)
+                continue;
+
+            cost += mCosts[index];
+            if(isKnown && (cost >= mCosts[neighIndex]))
+                continue;
+
+            mSearchIds[neighIndex] = mSearchId;
+            mCosts[neighIndex] = cost;
+            mParents[neighIndex] = index;
+            mIsClosed[neighIndex] = false;
+            double remaining = minCost * static_cast<double>(std::abs(destX - neighX) + std::abs(destY - neighY));
+            mOpenTiles.push_back(OpenTile{cost + remaining, neighIndex});
+            std::push_heap(mOpenTiles.begin(), mOpenTiles.end());
+        }
+    }
+
+    uint32_t index = isDestReached ? destIndex : closestIndex;
+    while(true)
+    {
+        path.push_back(index);
+        if(index == startIndex)
+            break;
+
+        index = mParents[index];
+    }
+    std::reverse(path.begin(), path.end());
+
+    return isDestReached;
+}
+
+#endif // DIGPATHSEARCH_H
@@ -60,6 +60,7 @@
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 #include "utils/ResourceManager.h"
+#include "utils/StateHash.h"
 
 #include <OgreTimer.h>
 
@@ -73,6 +74,9 @@
 
 const std::string DEFAULT_NICK = "You";
 
+//! \brief Number of turns between 2 checks of the seats counters (in debug only)
+const int64_t SEAT_COUNTERS_CHECK_PERIOD = 50;
+
 using namespace std;
 
 /*! \brief A helper class for the A* search in the GameMap::path function.
@@ -161,9 +165,11 @@ GameMap::GameMap(bool isServerGameMap) :
         mFloodFillEnabled(false),
         mIsFOWActivated(true),
         mNumCallsTo_path(0),
+        mNumCreatureActionSteps(0),
         mAiManager(*this),
         mTileSet(nullptr)
 {
+    mGoalStateVersions.assign(static_cast<uint32_t>(GoalDependency::nbValues), 0);
     resetUniqueNumbers();
 }
 
@@ -355,6 +361,8 @@ void GameMap::clearClasses()
             delete def.first;
     }
     mClassDescriptions.clear();
+    mClassDescriptionIndexesByName.clear();
+    mClassDescriptionIndexesByDef.clear();
 }
 
 void GameMap::clearWeapons()
@@ -369,6 +377,8 @@ void GameMap::clearWeapons()
             delete def.first;
     }
     mWeapons.clear();
+    mWeaponIndexesByName.clear();
+    mWeaponIndexesByDef.clear();
 }
 
 void GameMap::clearRenderedMovableEntities()
@@ -405,17 +415,23 @@ void GameMap::resetUniqueNumbers()
 
 void GameMap::addClassDescription(const CreatureDefinition *c)
 {
+    uint32_t index = mClassDescriptions.size();
     mClassDescriptions.push_back(std::pair<const CreatureDefinition*,CreatureDefinition*>(c, nullptr));
+    mClassDescriptionIndexesByName[c->getClassName()] = index;
+    mClassDescriptionIndexesByDef[c] = index;
 }
 
 void GameMap::addWeapon(const Weapon* weapon)
 {
+    uint32_t index = mWeapons.size();
     mWeapons.push_back(std::pair<const Weapon*,Weapon*>(weapon, nullptr));
+    mWeaponIndexesByName[weapon->getName()] = index;
+    mWeaponIndexesByDef[weapon] = index;
 }
 
 const Weapon* GameMap::getWeapon(int index)
 {
-    if(index >= static_cast<int>(mWeapons.size()))
+    if((index < 0) || (index >= static_cast<int>(mWeapons.size())))
     {
         OD_LOG_ERR("index=" + Helper::toString(index));
         return nullptr;
@@ -430,41 +446,44 @@ const Weapon* GameMap::getWeapon(int index)
 
 const Weapon* GameMap::getWeapon(const std::string& name)
 {
-    for (std::pair<const Weapon*,Weapon*>& def : mWeapons)
-    {
-        if(def.second != nullptr)
-        {
-            if (def.second->getName().compare(name) == 0)
-                return def.second;
-        }
-        else if(def.first->getName().compare(name) == 0)
-            return def.first;
-    }
+    auto it = mWeaponIndexesByName.find(name);
+    if(it == mWeaponIndexesByName.end())
+        return nullptr;
 
-    return nullptr;
+    return getWeapon(static_cast<int>(it->second));
+}
+
+int32_t GameMap::getWeaponIndex(const Weapon* weapon) const
+{
+    auto it = mWeaponIndexesByDef.find(weapon);
+    if(it == mWeaponIndexesByDef.end())
+        return -1;
+
+    return static_cast<int32_t>(it->second);
 }
 
 Weapon* GameMap::getWeaponForTuning(const std::string& name)
 {
-    for (std::pair<const Weapon*,Weapon*>& def : mWeapons)
+    auto it = mWeaponIndexesByName.find(name);
+    if(it != mWeaponIndexesByName.end())
     {
+        std::pair<const Weapon*,Weapon*>& def = mWeapons[it->second];
         if(def.second != nullptr)
-        {
-            if (def.second->getName().compare(name) == 0)
-                return def.second;
-        }
-        else if(def.first->getName().compare(name) == 0)
-        {
-            // If the definition is not a copy, we make one because we want to keep the original so we are able
-            // to save the changes if the map is saved
-            def.second = new Weapon(*def.first);
             return def.second;
-        }
+
+        // If the definition is not a copy, we make one because we want to keep the original so we are able
+        // to save the changes if the map is saved
+        def.second = new Weapon(*def.first);
+        mWeaponIndexesByDef[def.second] = it->second;
+        return def.second;
     }
 
     // It is a new definition
+    uint32_t index = mWeapons.size();
     Weapon* def = new Weapon(name);
     mWeapons.push_back(std::pair<const Weapon*,Weapon*>(nullptr, def));
+    mWeaponIndexesByName[name] = index;
+    mWeaponIndexesByDef[def] = index;
     return def;
 }
 
@@ -490,6 +509,8 @@ void GameMap::addCreature(Creature *cc)
         + ", seatId=" + (cc->getSeat() != nullptr ? Helper::toString(cc->getSeat()->getId()) : std::string("null")));
 
     mCreatures.push_back(cc);
+    notifyGoalStateChanged(GoalDependency::creatures);
+    cc->setIsInCreaturesList(true);
 }
 
 void GameMap::removeCreature(Creature *c)
@@ -504,6 +525,8 @@ void GameMap::removeCreature(Creature *c)
     }
 
     mCreatures.erase(it);
+    notifyGoalStateChanged(GoalDependency::creatures);
+    c->setIsInCreaturesList(false);
 }
 
 void GameMap::queueEntityForDeletion(GameEntity *ge)
@@ -513,39 +536,42 @@ void GameMap::queueEntityForDeletion(GameEntity *ge)
 
 const CreatureDefinition* GameMap::getClassDescription(const string &className)
 {
-    for (std::pair<const CreatureDefinition*,CreatureDefinition*>& def : mClassDescriptions)
-    {
-        if (def.second != nullptr)
-        {
-            if(def.second->getClassName().compare(className) == 0)
-                return def.second;
-        }
-        else if(def.first->getClassName().compare(className) == 0)
-            return def.first;
-    }
+    auto it = mClassDescriptionIndexesByName.find(className);
+    if(it == mClassDescriptionIndexesByName.end())
+        return nullptr;
 
-    return nullptr;
+    return getClassDescription(static_cast<int>(it->second));
+}
+
+int32_t GameMap::getClassDescriptionIndex(const CreatureDefinition* def) const
+{
+    auto it = mClassDescriptionIndexesByDef.find(def);
+    if(it == mClassDescriptionIndexesByDef.end())
+        return -1;
+
+    return static_cast<int32_t>(it->second);
 }
 
 CreatureDefinition* GameMap::getClassDescriptionForTuning(const std::string& name)
 {
-    for (std::pair<const CreatureDefinition*,CreatureDefinition*>& def : mClassDescriptions)
+    auto it = mClassDescriptionIndexesByName.find(name);
+    if(it != mClassDescriptionIndexesByName.end())
     {
+        std::pair<const CreatureDefinition*,CreatureDefinition*>& def = mClassDescriptions[it->second];
         if(def.second != nullptr)
-        {
-            if (def.second->getClassName().compare(name) == 0)
-                return def.second;
-        }
-        else if(def.first->getClassName().compare(name) == 0)
-        {
-            def.second = new CreatureDefinition(*def.first);
             return def.second;
-        }
+
+        def.second = new CreatureDefinition(*def.first);
+        mClassDescriptionIndexesByDef[def.second] = it->second;
+        return def.second;
     }
 
     // It is a new definition
+    uint32_t index = mClassDescriptions.size();
     CreatureDefinition* def = new CreatureDefinition(name);
     mClassDescriptions.push_back(std::pair<const CreatureDefinition*,CreatureDefinition*>(nullptr, def));
+    mClassDescriptionIndexesByName[name] = index;
+    mClassDescriptionIndexesByDef[def] = index;
     return def;
 }
 
@@ -614,9 +640,9 @@ Creature* GameMap::getWorkerToPickupBySeat(Seat* seat)
         bool isClaiming = false;
         bool isDigging = false;
 
-        for(const std::unique_ptr<CreatureAction>& action : creature->getActions())
+        for(const CreatureAction* action : creature->getActions())
         {
-            switch(action.get()->getType())
+            switch(action->getType())
             {
                 case CreatureActionType::fight:
                 case CreatureActionType::flee:
@@ -731,9 +757,9 @@ Creature* GameMap::getFighterToPickupBySeat(Seat* seat)
         bool isFleeing = false;
         bool isBusy = false;
 
-        for(const std::unique_ptr<CreatureAction>& action : creature->getActions())
+        for(const CreatureAction* action : creature->getActions())
         {
-            switch(action.get()->getType())
+            switch(action->getType())
             {
                 case CreatureActionType::flee:
                     isIdle = false;
@@ -902,6 +928,12 @@ void GameMap::saveLevelClassDescriptions(std::ofstream& levelFile)
 
 const CreatureDefinition* GameMap::getClassDescription(int index)
 {
+    if((index < 0) || (index >= static_cast<int>(mClassDescriptions.size())))
+    {
+        OD_LOG_ERR("index=" + Helper::toString(index));
+        return nullptr;
+    }
+
     std::pair<const CreatureDefinition*,CreatureDefinition*>& def = mClassDescriptions[index];
     if(def.second != nullptr)
         return def.second;
@@ -1076,6 +1108,7 @@ void GameMap::doTurn(double timeSinceLastTurn)
 {
     OD_LOG_INF("Computing turn " + Helper::toString(mTurnNumber) + ", timeSinceLastTurn=" + Helper::toString(timeSinceLastTurn));
     unsigned int numCallsTo_path_atStart = mNumCallsTo_path;
+    mNumCreatureActionSteps = 0;
 
     uint32_t miscUpkeepTime = doMiscUpkeep(timeSinceLastTurn);
 
@@ -1088,7 +1121,8 @@ void GameMap::doTurn(double timeSinceLastTurn)
     }
 
     OD_LOG_INF("During this turn there were " + Helper::toString(mNumCallsTo_path - numCallsTo_path_atStart)
-        + " calls to GameMap::path(), miscUpkeepTime=" + Helper::toString(miscUpkeepTime));
+        + " calls to GameMap::path(), " + Helper::toString(mNumCreatureActionSteps)
+        + " creature action steps, miscUpkeepTime=" + Helper::toString(miscUpkeepTime));
 }
 
 void GameMap::doPlayerAITurn(double timeSinceLastTurn)
@@ -1098,7 +1132,6 @@ void GameMap::doPlayerAITurn(double timeSinceLastTurn)
 
 unsigned long int GameMap::doMiscUpkeep(double timeSinceLastTurn)
 {
-    Tile *tempTile;
     Ogre::Timer stopwatch;
     unsigned long int timeTaken;
 
@@ -1132,7 +1165,7 @@ unsigned long int GameMap::doMiscUpkeep(double timeSinceLastTurn)
             if(!isCreatureSeat)
                 continue;
 
-            ServerNotification *serverNotification = new ServerNotification(
+            ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::chatServer, player);
             serverNotification->mPacket << "It's pay day !" << EventShortNoticeType::majorGameEvent;
             ODServer::getSingleton().queueServerNotification(serverNotification);
@@ -1160,28 +1193,6 @@ unsigned long int GameMap::doMiscUpkeep(double timeSinceLastTurn)
             addWinningSeat(seat);
 
         seat->mNumCreaturesFightersMax = getMaxNumberCreatures(seat);
-
-        // Set the creatures count to 0. It will be reset by the next count in doTurn()
-        seat->mNumCreaturesFighters = 0;
-        seat->mNumCreaturesWorkers = 0;
-    }
-
-    // Count how many creatures the player controls
-    for(Creature* creature : mCreatures)
-    {
-        // Check to see if the creature has died.
-        if (!creature->isAlive())
-            continue;
-
-        Seat *tempSeat = creature->getSeat();
-        if(tempSeat == nullptr)
-            continue;
-
-        // We only count fighters
-        if (creature->getDefinition()->isWorker())
-            ++(tempSeat->mNumCreaturesWorkers);
-        else
-            ++(tempSeat->mNumCreaturesFighters);
     }
 
     // At each upkeep, we re-compute tiles with vision
@@ -1272,29 +1283,151 @@ unsigned long int GameMap::doMiscUpkeep(double timeSinceLastTurn)
         }
     }
 
-    // Determine the number of tiles claimed by each seat.
-    // Begin by setting the number of claimed tiles for each seat to 0.
-    for (Seat* seat : mSeats)
-        seat->setNumClaimedTiles(0);
+#ifdef OD_DEBUG
+    // The claimed tiles counters are updated by the tiles when they get claimed/unclaimed. In debug,
+    // we check from time to time that they still match a full recount
+    if((mTurnNumber % SEAT_COUNTERS_CHECK_PERIOD) == 0)
+        checkSeatCounters();
+#endif
 
-    // Now loop over all of the tiles, if the tile is claimed increment the given seats count.
+    timeTaken = stopwatch.getMicroseconds();
+    return timeTaken;
+}
+
+bool GameMap::checkSeatCounters()
+{
+    std::vector<unsigned int> numClaimedTiles(mSeats.size(), 0);
     for (int jj = 0; jj < getMapSizeY(); ++jj)
     {
         for (int ii = 0; ii < getMapSizeX(); ++ii)
         {
-            tempTile = getTile(ii,jj);
+            Tile* tile = getTile(ii,jj);
+            if(!tile->isClaimed())
+                continue;
 
-            // Check to see if the current tile is claimed by anyone.
-            if (tempTile->isClaimed())
+            for(uint32_t i = 0; i < mSeats.size(); ++i)
             {
-                // Increment the count of the seat who owns the tile.
-                tempTile->getSeat()->incrementNumClaimedTiles();
+                if(mSeats[i] != tile->getSeat())
+                    continue;
+
+                ++numClaimedTiles[i];
+                break;
             }
         }
     }
 
-    timeTaken = stopwatch.getMicroseconds();
-    return timeTaken;
+    bool isOk = true;
+    for(uint32_t i = 0; i < mSeats.size(); ++i)
+    {
+        Seat* seat = mSeats[i];
+        if(seat->getNumClaimedTiles() == numClaimedTiles[i])
+            continue;
+
+        OD_LOG_ERR("Wrong claimed tiles count for seat=" + Helper::toString(seat->getId())
+            + ", count=" + Helper::toString(seat->getNumClaimedTiles())
+            + ", expected=" + Helper::toString(numClaimedTiles[i]));
+        seat->setNumClaimedTiles(numClaimedTiles[i]);
+        isOk = false;
+    }
+
+    if(!isOk)
+        notifyGoalStateChanged(GoalDependency::claimedTiles);
+
+    std::vector<std::map<const CreatureDefinition*, int32_t>> nbAliveCreatures(mSeats.size());
+    for(Creature* creature : mCreatures)
+    {
+        if(!creature->isAlive())
+            continue;
+
+        for(uint32_t i = 0; i < mSeats.size(); ++i)
+        {
+            if(mSeats[i] != creature->getSeat())
+                continue;
+
+            ++nbAliveCreatures[i][creature->getDefinition()];
+            break;
+        }
+    }
+
+    for(uint32_t i = 0; i < mSeats.size(); ++i)
+    {
+        Seat* seat = mSeats[i];
+        int numWorkers = 0;
+        int numFighters = 0;
+        for(const std::pair<const CreatureDefinition* const, int32_t>& count : nbAliveCreatures[i])
+        {
+            if(count.first->isWorker())
+                numWorkers += count.second;
+            else
+                numFighters += count.second;
+        }
+
+        if((seat->mNbAliveCreatures == nbAliveCreatures[i]) &&
+           (seat->mNumCreaturesWorkers == numWorkers) &&
+           (seat->mNumCreaturesFighters == numFighters))
+        {
+            continue;
+        }
+
+        OD_LOG_ERR("Wrong alive creatures count for seat=" + Helper::toString(seat->getId())
+            + ", workers=" + Helper::toString(seat->mNumCreaturesWorkers)
+            + ", expected=" + Helper::toString(numWorkers)
+            + ", fighters=" + Helper::toString(seat->mNumCreaturesFighters)
+            + ", expected=" + Helper::toString(numFighters));
+        seat->mNbAliveCreatures = nbAliveCreatures[i];
+        seat->mNumCreaturesWorkers = numWorkers;
+        seat->mNumCreaturesFighters = numFighters;
+        seat->notifyAliveCreaturesChanged();
+        isOk = false;
+    }
+
+    return isOk;
+}
+
+uint64_t GameMap::computeStateHash() const
+{
+    StateHash hash;
+    hash.add(static_cast<uint64_t>(mTurnNumber));
+
+    for (int jj = 0; jj < getMapSizeY(); ++jj)
+    {
+        for (int ii = 0; ii < getMapSizeX(); ++ii)
+        {
+            const Tile* tile = getTile(ii,jj);
+            hash.add(static_cast<uint32_t>(tile->getType()));
+            hash.add(tile->getFullness());
+            hash.add(tile->getClaimedPercentage());
+            hash.add(static_cast<int32_t>(tile->getSeat() != nullptr ? tile->getSeat()->getId() : -1));
+        }
+    }
+
+    for (const Creature* creature : mCreatures)
+    {
+        hash.add(creature->getName());
+        const Ogre::Vector3& pos = creature->getPosition();
+        hash.add(static_cast<double>(pos.x));
+        hash.add(static_cast<double>(pos.y));
+        hash.add(static_cast<double>(pos.z));
+        hash.add(creature->getHP());
+        hash.add(static_cast<uint32_t>(creature->getActions().size()));
+        for(const CreatureAction* action : creature->getActions())
+            hash.add(static_cast<uint32_t>(action->getType()));
+    }
+
+    for (const Room* room : mRooms)
+    {
+        hash.add(room->getName());
+        hash.add(static_cast<int32_t>(room->getTotalGoldStored()));
+    }
+
+    for (const Seat* seat : mSeats)
+    {
+        hash.add(static_cast<int32_t>(seat->getId()));
+        hash.add(static_cast<int32_t>(seat->getGold()));
+        hash.add(seat->getMana());
+    }
+
+    return hash.getValue();
 }
 
 void GameMap::updateAnimations(Ogre::Real timeSinceLastFrame)
@@ -1812,6 +1945,7 @@ void GameMap::addRoom(Room *r)
     }
 
     mRooms.push_back(r);
+    notifyGoalStateChanged(GoalDependency::rooms);
 }
 
 void GameMap::removeRoom(Room *r)
@@ -1827,6 +1961,7 @@ void GameMap::removeRoom(Room *r)
     }
 
     mRooms.erase(it);
+    notifyGoalStateChanged(GoalDependency::rooms);
 }
 
 std::vector<Room*> GameMap::getRoomsByType(RoomType type) const
@@ -2111,7 +2246,7 @@ void GameMap::addWinningSeat(Seat *s)
     Player* player = getPlayerBySeat(s);
     if (player && player->getIsHuman())
     {
-        ServerNotification* serverNotification = new ServerNotification(
+        ServerNotification* serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::chatServer, player);
         serverNotification->mPacket << "You Won" << EventShortNoticeType::majorGameEvent;
         ODServer::getSingleton().queueServerNotification(serverNotification);
@@ -2707,6 +2842,25 @@ GameEntity* GameMap::getEntityFromTypeAndName(GameEntityType entityType,
     return nullptr;
 }
 
+void GameMap::notifyGoalStateChanged(GoalDependency dependency)
+{
+    ++mGoalStateVersions[static_cast<uint32_t>(dependency)];
+}
+
+uint32_t GameMap::getGoalStateVersion(uint32_t dependencies) const
+{
+    // Counters only increase so the sum changes as soon as one of them changes
+    uint32_t version = 0;
+    for(uint32_t i = 0; i < mGoalStateVersions.size(); ++i)
+    {
+        if((dependencies & Goal::dependencyMask(static_cast<GoalDependency>(i))) == 0)
+            continue;
+
+        version += mGoalStateVersions[i];
+    }
+    return version;
+}
+
 void GameMap::logFloodFileTiles()
 {
     for(int yy = 0; yy < getMapSizeY(); ++yy)
@@ -2719,6 +2873,42 @@ void GameMap::logFloodFileTiles()
     }
 }
 
+void GameMap::logAITaskStats() const
+{
+    mAiManager.logTaskStats();
+}
+
+void GameMap::logMemoryFootprint() const
+{
+    uint32_t nbTiles = 0;
+    size_t tilesHeapSize = 0;
+    for(int xxx = 0; xxx < getMapSizeX(); ++xxx)
+    {
+        for(int yyy = 0; yyy < getMapSizeY(); ++yyy)
+        {
+            const Tile* tile = getTile(xxx, yyy);
+            if(tile == nullptr)
+                continue;
+
+            ++nbTiles;
+            tilesHeapSize += tile->getHeapMemoryFootprint();
+        }
+    }
+
+    OD_LOG_INF("Memory footprint (bytes) for map " + Helper::toString(getMapSizeX()) + "x" + Helper::toString(getMapSizeY()));
+    OD_LOG_INF("Tiles: nb=" + Helper::toString(nbTiles)
+        + ", objects=" + Helper::toString(static_cast<uint64_t>(nbTiles * sizeof(Tile)))
+        + ", containers=" + Helper::toString(static_cast<uint64_t>(tilesHeapSize)));
+    OD_LOG_INF("TileContainer arrays: " + Helper::toString(static_cast<uint64_t>(getTileContainerMemoryFootprint())));
+    for(const Seat* seat : mSeats)
+    {
+        OD_LOG_INF("Seat id=" + Helper::toString(seat->getId())
+            + ", tiles states=" + Helper::toString(static_cast<uint64_t>(seat->getTilesStatesMemoryFootprint())));
+    }
+    OD_LOG_INF("Creatures: nb=" + Helper::toString(static_cast<uint32_t>(mCreatures.size()))
+        + ", objects=" + Helper::toString(static_cast<uint64_t>(mCreatures.size() * sizeof(Creature))));
+}
+
 void GameMap::consoleSetCreatureDestination(const std::string& creatureName, int x, int y)
 {
     Creature* creature = getCreature(creatureName);
@@ -3058,6 +3248,8 @@ void GameMap::clientUpKeep(int64_t turnNumber)
 
 void GameMap::doorLock(Tile* tileDoor, Seat* seat, bool locked)
 {
+    notifyVisionChanged(*tileDoor);
+
     if(!locked)
     {
         // When a door is unlocked, we check all its neighboors to find a floodfill value for each possible
@@ -3234,17 +3426,7 @@ void GameMap::notifySeatsConfigured()
     }
 
     uint32_t nbTeams = mTeamIds.size();
-    for(int xxx = 0; xxx < getMapSizeX(); ++xxx)
-    {
-        for(int yyy = 0; yyy < getMapSizeY(); ++yyy)
-        {
-            Tile* tile = getTile(xxx, yyy);
-            if(tile == nullptr)
-                continue;
-
-            tile->setTeamsNumber(nbTeams);
-        }
-    }
+    setTeamsNumber(nbTeams);
     // Now that team ids are set and tiles are configured, we can compute floodfill
     enableFloodFill();
 }
@@ -3259,7 +3441,7 @@ void GameMap::fireGameSound(Tile& tile, const std::string& soundFamily)
         if(!seat->getPlayer()->getIsHuman())
             continue;
 
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::playSpatialSound, seat->getPlayer());
         serverNotification->mPacket << sound << tile.getX() << tile.getY();
         ODServer::getSingleton().queueServerNotification(serverNotification);
@@ -3275,7 +3457,7 @@ void GameMap::fireRelativeSound(const std::vector<Seat*>& seats, const std::stri
         if(!seat->getPlayer()->getIsHuman())
             continue;
 
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::playRelativeSound, seat->getPlayer());
         serverNotification->mPacket << soundFamily;
         ODServer::getSingleton().queueServerNotification(serverNotification);
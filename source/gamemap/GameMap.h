@@ -28,10 +28,12 @@
 #endif //mode_t
 #endif //mingw32
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <OgreVector3.h>
 
@@ -56,6 +58,7 @@ class TileSetValue;
 
 enum class GameEntityType;
 enum class FloodFillType;
+enum class GoalDependency;
 enum class KeeperAIType;
 enum class RoomType;
 enum class SpellType;
@@ -200,6 +203,11 @@ public:
     const CreatureDefinition* getClassDescription(const std::string& className);
     CreatureDefinition* getClassDescriptionForTuning(const std::string& name);
 
+    //! \brief Returns the index of the given class description (original or level tuned) or -1 if it
+    //! is not known by this game map. Indexes are the same on server and clients because the class
+    //! descriptions are sent in that order when the game starts
+    int32_t getClassDescriptionIndex(const CreatureDefinition* def) const;
+
     //! \brief Returns the total number of class descriptions stored in this game map.
     unsigned int numClassDescriptions();
 
@@ -209,6 +217,8 @@ public:
     const Weapon* getWeapon(int index);
     const Weapon* getWeapon(const std::string& name);
     Weapon* getWeaponForTuning(const std::string& name);
+    //! \brief Same as getClassDescriptionIndex for weapons
+    int32_t getWeaponIndex(const Weapon* weapon) const;
     uint32_t numWeapons();
     void saveLevelEquipments(std::ofstream& levelFile);
 
@@ -343,6 +353,11 @@ public:
 
     void doPlayerAITurn(double timeSinceLastTurn);
 
+    //! \brief Called by the creatures after their upkeep with the number of action steps
+    //! they ran. The total is logged at the end of each turn.
+    inline void increaseNumCreatureActionSteps(uint32_t nbSteps)
+    { mNumCreatureActionSteps += nbSteps; }
+
     //! \brief Tells whether a path exists between two tiles for the given creature.
     bool pathExists(const Creature* creature, Tile* tileStart, Tile* tileEnd);
 
@@ -448,7 +463,29 @@ public:
 
     uint32_t getMaxNumberCreatures(Seat* seat) const;
 
+    //! \brief Should be called when something goals can depend on changes so that seats
+    //! know they have to evaluate the goals depending on it again
+    void notifyGoalStateChanged(GoalDependency dependency);
+
+    //! \brief Returns a value that changes whenever notifyGoalStateChanged is called for one
+    //! of the dependencies in the given mask (see Goal::getDependencies)
+    uint32_t getGoalStateVersion(uint32_t dependencies) const;
+
+    //! \brief Recounts the tiles claimed and the alive creatures (by class and workers/fighters) of each seat
+    //! and compares with the counters kept up to date when they change. Wrong counters are logged and fixed.
+    //! Returns true if every counter was right
+    bool checkSeatCounters();
+
+    //! \brief Computes a hash of the authoritative game state (tiles, creatures positions, HP and
+    //! actions, gold stored in rooms and seats gold/mana). 2 runs of the same game that behave the
+    //! same way give the same hash for each turn, which allows to detect desyncs and nondeterminism
+    uint64_t computeStateHash() const;
+
     void logFloodFileTiles();
+    void logAITaskStats() const;
+
+    //! \brief Logs the memory used by the tiles, the tile container arrays and the seats tiles states
+    void logMemoryFootprint() const;
     void consoleSetCreatureDestination(const std::string& creatureName, int x, int y);
     void consoleToggleCreatureVisualDebug(const std::string& creatureName);
     void consoleToggleSeatVisualDebug(int seatId);
@@ -585,6 +622,13 @@ private:
     std::vector<std::pair<const CreatureDefinition*,CreatureDefinition*> > mClassDescriptions;
     std::vector<std::pair<const Weapon*,Weapon*> > mWeapons;
 
+    //! \brief Indexes in mClassDescriptions/mWeapons. Both the original and the tuned definitions
+    //! are referenced in the ...ByDef maps so that entities can be sent by index whatever the one they use
+    std::unordered_map<std::string, uint32_t> mClassDescriptionIndexesByName;
+    std::unordered_map<const CreatureDefinition*, uint32_t> mClassDescriptionIndexesByDef;
+    std::unordered_map<std::string, uint32_t> mWeaponIndexesByName;
+    std::unordered_map<const Weapon*, uint32_t> mWeaponIndexesByDef;
+
     //Mutable to allow locking in const functions.
     std::vector<MovableGameEntity*> mAnimatedObjects;
 
@@ -601,6 +645,9 @@ private:
     //! \brief Common player goals
     std::vector<std::unique_ptr<Goal>> mGoalsForAllSeats;
 
+    //! \brief Change counters indexed by GoalDependency
+    std::vector<uint32_t> mGoalStateVersions;
+
     //! \brief Entities that want to be notified for upkeep on client side
     std::vector<GameEntity*> mGameEntityClientUpkeep;
 
@@ -616,7 +663,11 @@ private:
     std::vector<GameEntity*> mEntitiesToDelete;
 
     //! \brief Debug member used to know how many call to pathfinding has been made within the same turn.
-    unsigned int mNumCallsTo_path;
+    //! \brief Atomic because the AIs may search paths from several threads (see AIManager::doTurn)
+    std::atomic<unsigned int> mNumCallsTo_path;
+
+    //! \brief Debug member used to know how many creature action steps have been run within the same turn.
+    uint32_t mNumCreatureActionSteps;
 
     std::vector<RenderedMovableEntity*> mRenderedMovableEntities;
 
@@ -632,7 +683,7 @@ private:
     std::string mTileSetName;
 
     //! \brief Updates different entities states.
-    //! Updates active objects (creatures, rooms, ...), goals, count each team Workers, gold, mana and claimed tiles.
+    //! Updates active objects (creatures, rooms, ...), goals, count each team Workers, gold and mana.
     unsigned long int doMiscUpkeep(double timeSinceLastTurn);
 
     //! \brief Resets the unique numbers
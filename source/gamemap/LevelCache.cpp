@@ -0,0 +1,242 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gamemap/LevelCache.h"
+
+#include "gamemap/LevelTokenizer.h"
+#include "utils/Helper.h"
+#include "utils/LogManager.h"
+
+#include <boost/filesystem.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace LevelCache
+{
+
+static const char COMPILED_MAGIC[4] = { 'O', 'D', 'L', 'B' };
+
+//! \brief To be increased each time the compiled file layout changes
+static const uint32_t COMPILED_FORMAT_VERSION = 1;
+
+static const std::string COMPILED_EXTENSION = ".levelbin";
+
+struct CompiledHeader
+{
+    char mMagic[4];
+    uint32_t mFormatVersion;
+    uint64_t mLevelSize;
+    uint64_t mLevelChecksum;
+    uint64_t mTilesEndOffset;
+    int32_t mMapSizeX;
+    int32_t mMapSizeY;
+    uint32_t mNbTiles;
+    uint32_t mRecordSize;
+    uint64_t mTilesChecksum;
+};
+
+std::string getCompiledLevelPath(const std::string& cacheDirectory, const std::string& levelFileName)
+{
+    // The level files may be in a read only directory. We keep the compiled files in the user
+    // data directory, named after the level path
+    std::string fullPath;
+    try
+    {
+        fullPath = boost::filesystem::absolute(levelFileName).string();
+    }
+    catch(const boost::filesystem::filesystem_error&)
+    {
+        fullPath = levelFileName;
+    }
+
+    uint64_t pathHash = LevelTokenizer::checksum(fullPath.data(), fullPath.size());
+    std::stringstream ss;
+    ss << cacheDirectory
+        << boost::filesystem::path(levelFileName).stem().string() << "_"
+        << std::hex << std::setfill('0') << std::setw(16) << pathHash
+        << COMPILED_EXTENSION;
+    return ss.str();
+}
+
+bool readTilesFromText(LevelTokenizer& levelFile, CompiledTiles& tiles)
+{
+    // Load the map size on next two lines
+    if(!levelFile.nextInt32(tiles.mMapSizeX) ||
+       !levelFile.nextInt32(tiles.mMapSizeY))
+    {
+        OD_LOG_WRN("Invalid map size");
+        return false;
+    }
+
+    std::string nextParam;
+    while (true)
+    {
+        if(!levelFile.nextToken(nextParam))
+        {
+            OD_LOG_WRN("unexpected EOF reached");
+            return false;
+        }
+
+        if (nextParam == "[/Tiles]")
+            break;
+
+        TileRecord record;
+        record.mX = Helper::toInt(nextParam);
+        int32_t tileType;
+        if(!levelFile.nextInt32(record.mY) ||
+           !levelFile.nextInt32(tileType))
+        {
+            OD_LOG_WRN("Invalid tile line for tile x=" + nextParam);
+            return false;
+        }
+        record.mType = static_cast<uint32_t>(tileType);
+
+        record.mFullness = 0.0;
+        if(!levelFile.isEndOfLine() && !levelFile.nextDouble(record.mFullness))
+        {
+            OD_LOG_WRN("Invalid tile fullness for tile x=" + nextParam);
+            return false;
+        }
+
+        record.mHasSeatId = 0;
+        record.mSeatId = 0;
+        if(!levelFile.isEndOfLine())
+        {
+            if(!levelFile.nextInt32(record.mSeatId))
+            {
+                OD_LOG_WRN("Invalid tile seat for tile x=" + nextParam);
+                return false;
+            }
+            record.mHasSeatId = 1;
+        }
+        record.mUnused = 0;
+
+        levelFile.skipLine();
+        tiles.mTiles.push_back(record);
+    }
+
+    tiles.mTilesEndOffset = levelFile.getPosition();
+    return true;
+}
+
+bool loadCompiledTiles(const std::string& compiledFileName, uint64_t levelSize, uint64_t levelChecksum,
+        CompiledTiles& tiles)
+{
+    std::ifstream file(compiledFileName.c_str(), std::ios::in | std::ios::binary);
+    if(!file.good())
+        return false;
+
+    CompiledHeader header;
+    if(!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+
+    if((std::memcmp(header.mMagic, COMPILED_MAGIC, sizeof(COMPILED_MAGIC)) != 0) ||
+       (header.mFormatVersion != COMPILED_FORMAT_VERSION) ||
+       (header.mRecordSize != sizeof(TileRecord)))
+    {
+        OD_LOG_INF("Ignoring compiled level with unsupported format=" + compiledFileName);
+        return false;
+    }
+
+    if((header.mLevelSize != levelSize) ||
+       (header.mLevelChecksum != levelChecksum))
+    {
+        OD_LOG_INF("Compiled level is outdated=" + compiledFileName);
+        return false;
+    }
+
+    tiles.mMapSizeX = header.mMapSizeX;
+    tiles.mMapSizeY = header.mMapSizeY;
+    tiles.mTilesEndOffset = header.mTilesEndOffset;
+    tiles.mTiles.resize(header.mNbTiles);
+    if(header.mNbTiles > 0)
+    {
+        uint64_t dataSize = static_cast<uint64_t>(header.mNbTiles) * sizeof(TileRecord);
+        if(!file.read(reinterpret_cast<char*>(tiles.mTiles.data()), dataSize))
+        {
+            OD_LOG_WRN("Truncated compiled level=" + compiledFileName);
+            return false;
+        }
+
+        if(LevelTokenizer::checksum(reinterpret_cast<const char*>(tiles.mTiles.data()), dataSize) != header.mTilesChecksum)
+        {
+            OD_LOG_WRN("Corrupted compiled level=" + compiledFileName);
+            return false;
+        }
+    }
+
+    OD_LOG_INF("Loaded " + Helper::toString(header.mNbTiles) + " tiles from compiled level=" + compiledFileName);
+    return true;
+}
+
+bool saveCompiledTiles(const std::string& compiledFileName, uint64_t levelSize, uint64_t levelChecksum,
+        const CompiledTiles& tiles)
+{
+    uint64_t dataSize = static_cast<uint64_t>(tiles.mTiles.size()) * sizeof(TileRecord);
+
+    CompiledHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.mMagic, COMPILED_MAGIC, sizeof(COMPILED_MAGIC));
+    header.mFormatVersion = COMPILED_FORMAT_VERSION;
+    header.mLevelSize = levelSize;
+    header.mLevelChecksum = levelChecksum;
+    header.mTilesEndOffset = tiles.mTilesEndOffset;
+    header.mMapSizeX = tiles.mMapSizeX;
+    header.mMapSizeY = tiles.mMapSizeY;
+    header.mNbTiles = static_cast<uint32_t>(tiles.mTiles.size());
+    header.mRecordSize = sizeof(TileRecord);
+    header.mTilesChecksum = LevelTokenizer::checksum(reinterpret_cast<const char*>(tiles.mTiles.data()), dataSize);
+
+    // We write in a temporary file so that a level loaded at the same time never reads
+    // a partially written file
+    std::string tmpFileName = compiledFileName + ".tmp";
+    {
+        std::ofstream file(tmpFileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!file.good())
+        {
+            OD_LOG_WRN("Couldn't open file for writing: " + tmpFileName);
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if(dataSize > 0)
+            file.write(reinterpret_cast<const char*>(tiles.mTiles.data()), dataSize);
+
+        if(!file.good())
+        {
+            OD_LOG_WRN("Unexpected failure on file: " + tmpFileName);
+            return false;
+        }
+    }
+
+    try
+    {
+        boost::filesystem::rename(tmpFileName, compiledFileName);
+    }
+    catch(const boost::filesystem::filesystem_error& e)
+    {
+        OD_LOG_WRN("Couldn't write compiled level=" + compiledFileName + ", error=" + e.what());
+        return false;
+    }
+
+    OD_LOG_INF("Saved compiled level=" + compiledFileName);
+    return true;
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LEVELCACHE_H
+#define LEVELCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class LevelTokenizer;
+
+//! \brief Compiled binary form of the tiles section of a level file (.levelbin files). Parsing
+//! the tiles is the longest part of loading a big level. The compiled file stores the parsed tiles
+//! with the size and the checksum of the text level it was built from. It is ignored (and rebuilt)
+//! as soon as the text level changes.
+namespace LevelCache
+{
+    //! \brief A tile as written in the level file. The layout is the one used in the compiled file
+    struct TileRecord
+    {
+        double mFullness;
+        int32_t mX;
+        int32_t mY;
+        uint32_t mType;
+        int32_t mSeatId;
+        uint32_t mHasSeatId;
+        uint32_t mUnused;
+    };
+
+    struct CompiledTiles
+    {
+        CompiledTiles() :
+            mMapSizeX(0),
+            mMapSizeY(0),
+            mTilesEndOffset(0)
+        {}
+
+        int32_t mMapSizeX;
+        int32_t mMapSizeY;
+
+        //! \brief Offset in the text level file right after the tiles section
+        uint64_t mTilesEndOffset;
+
+        std::vector<TileRecord> mTiles;
+    };
+
+    //! \brief Levels smaller than this are not compiled as parsing them is fast anyway
+    const int32_t MIN_TILES_FOR_COMPILED_LEVEL = 10000;
+
+    //! \brief Returns the path of the compiled file for the given level file in the given cache directory
+    std::string getCompiledLevelPath(const std::string& cacheDirectory, const std::string& levelFileName);
+
+    //! \brief Reads the tiles section from the text level file. The tokenizer is expected to be
+    //! just after the [Tiles] tag. It is positioned after the [/Tiles] tag on return
+    bool readTilesFromText(LevelTokenizer& levelFile, CompiledTiles& tiles);
+
+    //! \brief Loads the tiles from the compiled file. Returns false if the file does not exist, is invalid
+    //! or has not been built from a level file with the given size and checksum.
+    bool loadCompiledTiles(const std::string& compiledFileName, uint64_t levelSize, uint64_t levelChecksum,
+        CompiledTiles& tiles);
+
+    //! \brief Writes the compiled file for a level file with the given size and checksum
+    bool saveCompiledTiles(const std::string& compiledFileName, uint64_t levelSize, uint64_t levelChecksum,
+        const CompiledTiles& tiles);
+}
+
+#endif // LEVELCACHE_H
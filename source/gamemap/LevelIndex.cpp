@@ -0,0 +1,206 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gamemap/LevelIndex.h"
+
+#include "utils/Helper.h"
+#include "utils/LogManager.h"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+//! \brief When the index file contains more than this ratio of records per level, it is rewritten
+static const uint32_t MAX_RECORDS_PER_ENTRY = 2;
+
+//! \brief Allows a few outdated records before rewriting small index files
+static const uint32_t MIN_RECORDS_BEFORE_REWRITE = 32;
+
+LevelIndex::LevelIndex(const std::string& indexFileName) :
+    mIndexFileName(indexFileName),
+    mIsLoaded(false),
+    mNbRecords(0)
+{
+}
+
+bool LevelIndex::getLevelInfo(const std::string& fileName, LevelInfo& levelInfo)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    load();
+
+    auto it = mEntries.find(fileName);
+    if(it == mEntries.end())
+        return false;
+
+    uint64_t fileSize;
+    int64_t modifiedTime;
+    if(!getFileStamp(fileName, fileSize, modifiedTime))
+        return false;
+
+    const Entry& entry = it->second;
+    if((entry.mFileSize != fileSize) || (entry.mModifiedTime != modifiedTime))
+        return false;
+
+    levelInfo = entry.mLevelInfo;
+    return true;
+}
+
+void LevelIndex::setLevelInfo(const std::string& fileName, const LevelInfo& levelInfo)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    load();
+
+    Entry entry;
+    if(!getFileStamp(fileName, entry.mFileSize, entry.mModifiedTime))
+        return;
+
+    entry.mLevelInfo = levelInfo;
+    mEntries[fileName] = entry;
+
+    std::ofstream file(mIndexFileName.c_str(), std::ios::out | std::ios::app);
+    if(!file.good())
+    {
+        OD_LOG_WRN("Cannot write level index file=" + mIndexFileName);
+        return;
+    }
+
+    writeEntry(file, fileName, entry);
+    ++mNbRecords;
+}
+
+void LevelIndex::load()
+{
+    if(mIsLoaded)
+        return;
+
+    mIsLoaded = true;
+    std::ifstream file(mIndexFileName.c_str(), std::ios::in);
+    if(!file.good())
+        return;
+
+    std::string line;
+    std::string fileName;
+    Entry entry;
+    while(std::getline(file, line))
+    {
+        if(line == "[Level]")
+        {
+            fileName.clear();
+            entry = Entry();
+            continue;
+        }
+
+        if(line == "[/Level]")
+        {
+            ++mNbRecords;
+            if(!fileName.empty())
+                mEntries[fileName] = entry;
+
+            continue;
+        }
+
+        std::string::size_type sep = line.find('\t');
+        if(sep == std::string::npos)
+            continue;
+
+        std::string key = line.substr(0, sep);
+        std::string value = line.substr(sep + 1);
+        LevelInfo& info = entry.mLevelInfo;
+        if(key == "Path")
+            fileName = value;
+        else if(key == "Name")
+            info.mLevelName = value;
+        else if(key == "Description")
+            info.mInfoDescription = value;
+        else
+        {
+            std::stringstream ss(value);
+            if(key == "FileSize")
+                ss >> entry.mFileSize;
+            else if(key == "ModifiedTime")
+                ss >> entry.mModifiedTime;
+            else if(key == "MapSize")
+                ss >> info.mMapSizeX >> info.mMapSizeY;
+            else if(key == "Seats")
+                ss >> info.mNbSeatsHuman >> info.mNbSeatsAI >> info.mNbSeatsConfigurable;
+        }
+    }
+
+    for(auto& it : mEntries)
+        MapHandler::buildLevelDescription(it.second.mLevelInfo);
+
+    if(mNbRecords > std::max(MIN_RECORDS_BEFORE_REWRITE, static_cast<uint32_t>(mEntries.size()) * MAX_RECORDS_PER_ENTRY))
+    {
+        file.close();
+        rewrite();
+    }
+}
+
+void LevelIndex::rewrite()
+{
+    // We remove the levels that do not exist anymore
+    for(auto it = mEntries.begin(); it != mEntries.end();)
+    {
+        if(boost::filesystem::exists(it->first))
+            ++it;
+        else
+            it = mEntries.erase(it);
+    }
+
+    std::ofstream file(mIndexFileName.c_str(), std::ios::out | std::ios::trunc);
+    if(!file.good())
+    {
+        OD_LOG_WRN("Cannot write level index file=" + mIndexFileName);
+        return;
+    }
+
+    for(const auto& it : mEntries)
+        writeEntry(file, it.first, it.second);
+
+    mNbRecords = static_cast<uint32_t>(mEntries.size());
+    OD_LOG_INF("Level index rewritten with " + Helper::toString(mNbRecords) + " levels");
+}
+
+bool LevelIndex::getFileStamp(const std::string& fileName, uint64_t& fileSize, int64_t& modifiedTime)
+{
+    boost::system::error_code ec;
+    fileSize = boost::filesystem::file_size(fileName, ec);
+    if(ec)
+        return false;
+
+    modifiedTime = static_cast<int64_t>(boost::filesystem::last_write_time(fileName, ec));
+    if(ec)
+        return false;
+
+    return true;
+}
+
+void LevelIndex::writeEntry(std::ostream& os, const std::string& fileName, const Entry& entry)
+{
+    const LevelInfo& info = entry.mLevelInfo;
+    os << "[Level]" << std::endl;
+    os << "Path\t" << fileName << std::endl;
+    os << "FileSize\t" << entry.mFileSize << std::endl;
+    os << "ModifiedTime\t" << entry.mModifiedTime << std::endl;
+    os << "Name\t" << info.mLevelName << std::endl;
+    os << "Description\t" << info.mInfoDescription << std::endl;
+    os << "MapSize\t" << info.mMapSizeX << "\t" << info.mMapSizeY << std::endl;
+    os << "Seats\t" << info.mNbSeatsHuman << "\t" << info.mNbSeatsAI << "\t" << info.mNbSeatsConfigurable << std::endl;
+    os << "[/Level]" << std::endl;
+}
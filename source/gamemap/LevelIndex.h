@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LEVELINDEX_H
+#define LEVELINDEX_H
+
+#include "gamemap/MapHandler.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+//! \brief Persistent index of the level headers. The menus list every level in a directory each time
+//! they are opened. Instead of reading each level, the header info is taken from this index as long
+//! as the level file size and modification time did not change.
+//! The index file is append only: each new or updated level is appended at the end and the latest
+//! entry wins when the file is read. It is rewritten when it contains too many outdated entries.
+class LevelIndex
+{
+public:
+    LevelIndex(const std::string& indexFileName);
+
+    //! \brief Returns true if the given level is in the index and the level file did not change since.
+    //! In that case, levelInfo is filled.
+    bool getLevelInfo(const std::string& fileName, LevelInfo& levelInfo);
+
+    //! \brief Adds (or updates) the given level in the index
+    void setLevelInfo(const std::string& fileName, const LevelInfo& levelInfo);
+
+private:
+    struct Entry
+    {
+        Entry() :
+            mFileSize(0),
+            mModifiedTime(0)
+        {}
+
+        uint64_t mFileSize;
+        int64_t mModifiedTime;
+        LevelInfo mLevelInfo;
+    };
+
+    LevelIndex(const LevelIndex&) = delete;
+    LevelIndex& operator=(const LevelIndex&) = delete;
+
+    //! \brief Reads the index file if not already done
+    void load();
+
+    //! \brief Rewrites the index file with the current entries only
+    void rewrite();
+
+    //! \brief Gets the size and the modification time of the given file. Returns false if it cannot be read
+    static bool getFileStamp(const std::string& fileName, uint64_t& fileSize, int64_t& modifiedTime);
+
+    static void writeEntry(std::ostream& os, const std::string& fileName, const Entry& entry);
+
+    std::string mIndexFileName;
+    bool mIsLoaded;
+
+    //! \brief Number of entries written in the index file (including the outdated ones)
+    uint32_t mNbRecords;
+
+    std::map<std::string, Entry> mEntries;
+
+    //! \brief Levels are listed from the menus but the server also reads the header of the launched level
+    std::mutex mMutex;
+};
+
+#endif // LEVELINDEX_H
@@ -0,0 +1,277 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gamemap/LevelTokenizer.h"
+
+#include "utils/Helper.h"
+#include "utils/LogManager.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+
+const uint64_t LevelTokenizer::FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+static inline bool isSpace(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+LevelTokenizer::LevelTokenizer(const std::string& fileName) :
+    mData(nullptr),
+    mSize(0),
+    mPos(0)
+{
+    try
+    {
+        mFileMapping.reset(new boost::interprocess::file_mapping(fileName.c_str(), boost::interprocess::read_only));
+        mRegion.reset(new boost::interprocess::mapped_region(*mFileMapping, boost::interprocess::read_only));
+        mData = static_cast<const char*>(mRegion->get_address());
+        mSize = mRegion->get_size();
+    }
+    catch(const boost::interprocess::interprocess_exception& e)
+    {
+        OD_LOG_WRN("Could not map file=" + fileName + ", error=" + e.what());
+        mRegion.reset();
+        mFileMapping.reset();
+        mData = nullptr;
+        mSize = 0;
+    }
+}
+
+LevelTokenizer::~LevelTokenizer()
+{
+}
+
+void LevelTokenizer::setPosition(uint64_t pos)
+{
+    mPos = std::min(pos, mSize);
+}
+
+void LevelTokenizer::skipBlanks()
+{
+    while(mPos < mSize)
+    {
+        char c = mData[mPos];
+        if(c == '#')
+        {
+            while((mPos < mSize) && (mData[mPos] != '\n'))
+                ++mPos;
+
+            continue;
+        }
+
+        if(!isSpace(c))
+            return;
+
+        ++mPos;
+    }
+}
+
+void LevelTokenizer::skipSpaces()
+{
+    while((mPos < mSize) &&
+          ((mData[mPos] == ' ') || (mData[mPos] == '\t') || (mData[mPos] == '\r')))
+    {
+        ++mPos;
+    }
+}
+
+uint64_t LevelTokenizer::tokenLength() const
+{
+    uint64_t end = mPos;
+    while((end < mSize) && !isSpace(mData[end]) && (mData[end] != '#'))
+        ++end;
+
+    return end - mPos;
+}
+
+bool LevelTokenizer::nextToken(std::string& token)
+{
+    skipBlanks();
+    if(mPos >= mSize)
+        return false;
+
+    uint64_t length = tokenLength();
+    token.assign(mData + mPos, static_cast<size_t>(length));
+    mPos += length;
+    return true;
+}
+
+bool LevelTokenizer::nextLine(std::string& line)
+{
+    if(mPos >= mSize)
+        return false;
+
+    uint64_t end = mPos;
+    while((end < mSize) && (mData[end] != '\n'))
+        ++end;
+
+    uint64_t contentEnd = mPos;
+    while((contentEnd < end) && (mData[contentEnd] != '#'))
+        ++contentEnd;
+
+    // We do not want windows line endings in the content
+    if((contentEnd > mPos) && (contentEnd == end) && (mData[contentEnd - 1] == '\r'))
+        --contentEnd;
+
+    line.assign(mData + mPos, static_cast<size_t>(contentEnd - mPos));
+    mPos = std::min(end + 1, mSize);
+    return true;
+}
+
+bool LevelTokenizer::nextInt32(int32_t& value)
+{
+    skipBlanks();
+    if(mPos >= mSize)
+        return false;
+
+    uint64_t pos = mPos;
+    bool negative = false;
+    if((mData[pos] == '-') || (mData[pos] == '+'))
+    {
+        negative = (mData[pos] == '-');
+        ++pos;
+    }
+
+    int64_t number = 0;
+    uint64_t start = pos;
+    while((pos < mSize) && (mData[pos] >= '0') && (mData[pos] <= '9'))
+    {
+        number = number * 10 + (mData[pos] - '0');
+        ++pos;
+    }
+
+    if(pos == start)
+        return false;
+
+    // The token should end here
+    if((pos < mSize) && !isSpace(mData[pos]) && (mData[pos] != '#'))
+        return false;
+
+    value = static_cast<int32_t>(negative ? -number : number);
+    mPos = pos;
+    return true;
+}
+
+bool LevelTokenizer::nextDouble(double& value)
+{
+    skipBlanks();
+    if(mPos >= mSize)
+        return false;
+
+    uint64_t pos = mPos;
+    bool negative = false;
+    if((mData[pos] == '-') || (mData[pos] == '+'))
+    {
+        negative = (mData[pos] == '-');
+        ++pos;
+    }
+
+    double number = 0.0;
+    uint64_t start = pos;
+    while((pos < mSize) && (mData[pos] >= '0') && (mData[pos] <= '9'))
+    {
+        number = number * 10.0 + (mData[pos] - '0');
+        ++pos;
+    }
+
+    if((pos < mSize) && (mData[pos] == '.'))
+    {
+        ++pos;
+        double divisor = 1.0;
+        while((pos < mSize) && (mData[pos] >= '0') && (mData[pos] <= '9'))
+        {
+            number = number * 10.0 + (mData[pos] - '0');
+            divisor *= 10.0;
+            ++pos;
+        }
+        number /= divisor;
+    }
+
+    if(pos == start)
+        return false;
+
+    if((pos < mSize) && !isSpace(mData[pos]) && (mData[pos] != '#'))
+    {
+        // Uncommon format (exponent for example). We let the standard conversion handle it
+        uint64_t length = tokenLength();
+        value = Helper::toDouble(std::string(mData + mPos, static_cast<size_t>(length)));
+        mPos += length;
+        return true;
+    }
+
+    value = negative ? -number : number;
+    mPos = pos;
+    return true;
+}
+
+bool LevelTokenizer::isEndOfLine()
+{
+    skipSpaces();
+    return (mPos >= mSize) || (mData[mPos] == '\n') || (mData[mPos] == '#');
+}
+
+void LevelTokenizer::skipLine()
+{
+    while((mPos < mSize) && (mData[mPos] != '\n'))
+        ++mPos;
+
+    if(mPos < mSize)
+        ++mPos;
+}
+
+bool LevelTokenizer::readSection(const std::string& endTag, std::stringstream& ss)
+{
+    std::string line;
+    while(nextLine(line))
+    {
+        ss << line << "\n";
+
+        // We check if the first token of the line is the end tag
+        std::string::size_type start = line.find_first_not_of(" \t");
+        if(start == std::string::npos)
+            continue;
+
+        std::string::size_type end = line.find_first_of(" \t", start);
+        if(end == std::string::npos)
+            end = line.size();
+
+        if(line.compare(start, end - start, endTag) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+uint64_t LevelTokenizer::computeChecksum() const
+{
+    return checksum(mData, mSize);
+}
+
+uint64_t LevelTokenizer::checksum(const char* data, uint64_t size, uint64_t hash)
+{
+    for(uint64_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
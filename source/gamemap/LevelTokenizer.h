@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LEVELTOKENIZER_H
+#define LEVELTOKENIZER_H
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace boost
+{
+namespace interprocess
+{
+class file_mapping;
+class mapped_region;
+}
+}
+
+//! \brief Reads a level file without copying it. The file is memory mapped and tokens
+//! are read directly from the mapped memory. Comments (from '#' to the end of the line)
+//! are skipped.
+//! Sections that are still parsed through std::istream can be extracted with readSection.
+class LevelTokenizer
+{
+public:
+    //! \brief Maps the given file. isOpen() will return false if the file cannot be read
+    LevelTokenizer(const std::string& fileName);
+    ~LevelTokenizer();
+
+    inline bool isOpen() const
+    { return mData != nullptr; }
+
+    inline uint64_t getSize() const
+    { return mSize; }
+
+    //! \brief Current offset in the file
+    inline uint64_t getPosition() const
+    { return mPos; }
+
+    void setPosition(uint64_t pos);
+
+    //! \brief Reads the next whitespace separated token. Returns false at the end of the file.
+    bool nextToken(std::string& token);
+
+    //! \brief Reads the end of the current line (like std::getline would) and moves to the next one.
+    //! The comment (if any) is not included. Returns false at the end of the file.
+    bool nextLine(std::string& line);
+
+    //! \brief Reads the next token as a number. Returns false if the token is not a number.
+    bool nextInt32(int32_t& value);
+    bool nextDouble(double& value);
+
+    //! \brief Returns true if there is no more token on the current line.
+    bool isEndOfLine();
+
+    //! \brief Moves to the beginning of the next line
+    void skipLine();
+
+    //! \brief Copies the lines from the current position until the line starting with endTag (included) in ss
+    //! without the comments. That allows to use the std::istream based loaders on a part of the file only.
+    //! Returns false if endTag is not found.
+    bool readSection(const std::string& endTag, std::stringstream& ss);
+
+    //! \brief Returns a checksum of the whole file content.
+    uint64_t computeChecksum() const;
+
+    //! \brief FNV-1a hash of the given data. It is fast enough to be computed on a whole level file
+    static uint64_t checksum(const char* data, uint64_t size, uint64_t hash = FNV_OFFSET_BASIS);
+
+    static const uint64_t FNV_OFFSET_BASIS;
+
+private:
+    LevelTokenizer(const LevelTokenizer&) = delete;
+    LevelTokenizer& operator=(const LevelTokenizer&) = delete;
+
+    //! \brief Skips spaces, new lines and comments
+    void skipBlanks();
+
+    //! \brief Skips spaces on the current line only (not the comments)
+    void skipSpaces();
+
+    //! \brief Returns the size of the token at the current position
+    uint64_t tokenLength() const;
+
+    std::unique_ptr<boost::interprocess::file_mapping> mFileMapping;
+    std::unique_ptr<boost::interprocess::mapped_region> mRegion;
+    const char* mData;
+    uint64_t mSize;
+    uint64_t mPos;
+};
+
+#endif // LEVELTOKENIZER_H
@@ -36,6 +36,9 @@
 #include "entities/Tile.h"
 #include "entities/TreasuryObject.h"
 #include "entities/Weapon.h"
+#include "gamemap/LevelCache.h"
+#include "gamemap/LevelIndex.h"
+#include "gamemap/LevelTokenizer.h"
 #include "rooms/Room.h"
 #include "rooms/RoomManager.h"
 #include "spells/Spell.h"
@@ -55,13 +58,13 @@ namespace MapHandler {
 
 bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
 {
-    std::stringstream levelFile;
-    if(!Helper::readFileWithoutComments(fileName, levelFile))
+    LevelTokenizer levelFile(fileName);
+    if(!levelFile.isOpen())
         return false;
 
     std::string nextParam;
     // Read in the version number from the level file
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam.compare(ODApplication::VERSIONSTRING) != 0)
     {
         OD_LOG_WRN("Attempting to load a file produced by a different version of OpenDungeons, filename="
@@ -69,7 +72,7 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
         return false;
     }
 
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Info]")
     {
         OD_LOG_WRN("Invalid info start format: " + nextParam);
@@ -82,10 +85,10 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
     // Read in the seats from the level file
     while (true)
     {
-        if(!levelFile.good())
+        // Information can contain spaces. We need to read the whole line to get content
+        if(!levelFile.nextLine(nextParam))
             return false;
-        // Information can contain spaces. We need to use std::getline to get content
-        std::getline(levelFile, nextParam);
+
         std::string param;
         if (nextParam == "[/Info]")
         {
@@ -134,20 +137,26 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
         }
     }
 
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Seats]")
     {
         OD_LOG_WRN("Invalid seats start format=" + nextParam);
         return false;
     }
 
+    // The seats, goals, rooms, ... are small sections read by the entities themselves
+    // from std::istream. Only these sections are copied.
+    std::stringstream sectionStream;
+    if(!levelFile.readSection("[/Seats]", sectionStream))
+        return false;
+
     // Read in the seats from the level file
     while (true)
     {
-        if(!levelFile.good())
+        if(!sectionStream.good())
             return false;
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam == "[/Seats]")
             break;
 
@@ -158,7 +167,7 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
         }
 
         Seat* tempSeat = new Seat(&gameMap);
-        if(!tempSeat->importSeatFromStream(levelFile))
+        if(!tempSeat->importSeatFromStream(sectionStream))
         {
             delete tempSeat;
             return false;
@@ -173,67 +182,82 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
     }
 
     // Read in the goals that are shared by all players, the first player to complete all these goals is the winner.
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Goals]")
     {
         OD_LOG_WRN("Invalid Goals start format=" + nextParam);
         return false;
     }
 
+    sectionStream.str("");
+    sectionStream.clear();
+    if(!levelFile.readSection("[/Goals]", sectionStream))
+        return false;
+
     while(true)
     {
-        if(!levelFile.good())
+        if(!sectionStream.good())
             return false;
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam == "[/Goals]")
             break;
 
-        std::unique_ptr<Goal> tempGoal = Goals::loadGoalFromStream(nextParam, levelFile);
+        std::unique_ptr<Goal> tempGoal = Goals::loadGoalFromStream(nextParam, sectionStream);
 
         if (tempGoal.get() != nullptr)
             gameMap.addGoalForAllSeats(std::move(tempGoal));
     }
 
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Tiles]")
     {
         OD_LOG_WRN("Invalid tile start format:" + nextParam);
         return false;
     }
 
-    // Load the map size on next two lines
-    int mapSizeX;
-    int mapSizeY;
-    levelFile >> mapSizeX;
-    levelFile >> mapSizeY;
-
-    if (!gameMap.createNewMap(mapSizeX, mapSizeY))
-        return false;
-
-    // Read in the map tiles from disk
-    gameMap.disableFloodFill();
+    // The tiles are the biggest part of the file. If the level has already been loaded, we
+    // use the compiled version if the level file has not changed since
+    LevelCache::CompiledTiles tiles;
+    bool isCacheEnabled = ResourceManager::getSingleton().isLevelCacheEnabled();
+    bool isCompiledLoaded = false;
+    uint64_t levelChecksum = 0;
+    std::string compiledFileName;
+    if(isCacheEnabled)
+    {
+        levelChecksum = levelFile.computeChecksum();
+        compiledFileName = LevelCache::getCompiledLevelPath(ResourceManager::getSingleton().getLevelCachePath(), fileName);
+        isCompiledLoaded = LevelCache::loadCompiledTiles(compiledFileName, levelFile.getSize(), levelChecksum, tiles);
+    }
 
-    while (true)
+    if(isCompiledLoaded)
     {
-        if(!levelFile.good())
-        {
-            OD_LOG_WRN("unexpected EOF reached");
+        levelFile.setPosition(tiles.mTilesEndOffset);
+    }
+    else
+    {
+        if(!LevelCache::readTilesFromText(levelFile, tiles))
             return false;
+
+        if(isCacheEnabled &&
+           (tiles.mMapSizeX * tiles.mMapSizeY >= LevelCache::MIN_TILES_FOR_COMPILED_LEVEL))
+        {
+            LevelCache::saveCompiledTiles(compiledFileName, levelFile.getSize(), levelChecksum, tiles);
         }
+    }
 
-        levelFile >> nextParam;
-        if (nextParam == "[/Tiles]")
-            break;
+    if (!gameMap.createNewMap(tiles.mMapSizeX, tiles.mMapSizeY))
+        return false;
 
-        // Get all the params together in order to prepare for the new parsing function
-        std::string entire_line = nextParam;
-        std::getline(levelFile, nextParam);
-        entire_line += nextParam;
+    // Read in the map tiles from disk
+    gameMap.disableFloodFill();
 
-        Tile* tile = new Tile(&gameMap, true);
+    for(const LevelCache::TileRecord& record : tiles.mTiles)
+    {
+        Tile* tile = new Tile(&gameMap, record.mX, record.mY);
 
-        Tile::loadFromLine(entire_line, tile);
+        Tile::loadFromValues(tile, record.mX, record.mY, static_cast<TileType>(record.mType),
+            record.mFullness, record.mHasSeatId != 0, record.mSeatId);
         tile->computeTileVisual();
 
         gameMap.addTile(tile);
@@ -242,22 +266,30 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
     gameMap.setAllFullnessAndNeighbors();
 
     // Read in the rooms
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Rooms]")
     {
         OD_LOG_WRN("Invalid Rooms start format:" + nextParam);
         return false;
     }
 
+    sectionStream.str("");
+    sectionStream.clear();
+    if(!levelFile.readSection("[/Rooms]", sectionStream))
+    {
+        OD_LOG_WRN("unexpected EOF reached");
+        return false;
+    }
+
     while(true)
     {
-        if(!levelFile.good())
+        if(!sectionStream.good())
         {
             OD_LOG_WRN("unexpected EOF reached");
             return false;
         }
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam == "[/Rooms]")
             break;
 
@@ -270,7 +302,7 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
         if(!gameMap.isServerGameMap())
             continue;
 
-        Room* tempRoom = RoomManager::getRoomFromStream(&gameMap, levelFile);
+        Room* tempRoom = RoomManager::getRoomFromStream(&gameMap, sectionStream);
         if(tempRoom == nullptr)
         {
             OD_LOG_ERR("unexpected null room");
@@ -279,7 +311,7 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
 
         tempRoom->addToGameMap();
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam != "[/Room]")
         {
             OD_LOG_WRN("Expected [/Room] but got:" + nextParam);
@@ -288,22 +320,30 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
     }
 
     // Read in the traps
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Traps]")
     {
         OD_LOG_WRN("Invalid Traps start format:" + nextParam);
         return false;
     }
 
+    sectionStream.str("");
+    sectionStream.clear();
+    if(!levelFile.readSection("[/Traps]", sectionStream))
+    {
+        OD_LOG_WRN("unexpected EOF reached");
+        return false;
+    }
+
     while(true)
     {
-        if(!levelFile.good())
+        if(!sectionStream.good())
         {
             OD_LOG_WRN("unexpected EOF reached");
             return false;
         }
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam == "[/Traps]")
             break;
 
@@ -313,7 +353,7 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
             return false;
         }
 
-        Trap* tempTrap = TrapManager::getTrapFromStream(&gameMap, levelFile);
+        Trap* tempTrap = TrapManager::getTrapFromStream(&gameMap, sectionStream);
         if(tempTrap == nullptr)
         {
             OD_LOG_ERR("unexpected null trap");
@@ -322,7 +362,7 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
 
         tempTrap->addToGameMap();
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam != "[/Trap]")
         {
             OD_LOG_WRN("Expected [/Trap] but got:" + nextParam);
@@ -331,24 +371,29 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
     }
 
     // Read in the lights
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Lights]")
     {
         OD_LOG_WRN("Invalid Lights start format:" + nextParam);
         return false;
     }
 
+    sectionStream.str("");
+    sectionStream.clear();
+    if(!levelFile.readSection("[/Lights]", sectionStream))
+        return false;
+
     while(true)
     {
-        if(!levelFile.good())
+        if(!sectionStream.good())
             return false;
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam == "[/Lights]")
             break;
 
         std::string entire_line = nextParam;
-        std::getline(levelFile, nextParam);
+        std::getline(sectionStream, nextParam);
         entire_line += nextParam;
 
         std::stringstream ss(entire_line);
@@ -362,12 +407,17 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
         tempLight->addToGameMap();
     }
 
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam == "[CreatureDefinitions]")
     {
-        while(levelFile.good())
+        sectionStream.str("");
+        sectionStream.clear();
+        if(!levelFile.readSection("[/CreatureDefinitions]", sectionStream))
+            return false;
+
+        while(sectionStream.good())
         {
-            levelFile >> nextParam;
+            sectionStream >> nextParam;
             if (nextParam == "[/CreatureDefinitions]")
                 break;
 
@@ -381,29 +431,34 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
                 return false;
             }
 
-            levelFile >> nextParam;
+            sectionStream >> nextParam;
             if (nextParam == "Name")
             {
-                levelFile >> nextParam;
+                sectionStream >> nextParam;
                 CreatureDefinition* def = gameMap.getClassDescriptionForTuning(nextParam);
                 if (def == nullptr)
                 {
                     OD_LOG_WRN("Invalid Creature definition format for " + nextParam);
                     return false;
                 }
-                if(!CreatureDefinition::update(def, levelFile, ConfigManager::getSingleton().getCreatureDefinitions()))
+                if(!CreatureDefinition::update(def, sectionStream, ConfigManager::getSingleton().getCreatureDefinitions()))
                     return false;
             }
         }
 
-        levelFile >> nextParam;
+        levelFile.nextToken(nextParam);
     }
 
     if (nextParam == "[EquipmentDefinitions]")
     {
-        while(levelFile.good())
+        sectionStream.str("");
+        sectionStream.clear();
+        if(!levelFile.readSection("[/EquipmentDefinitions]", sectionStream))
+            return false;
+
+        while(sectionStream.good())
         {
-            levelFile >> nextParam;
+            sectionStream >> nextParam;
             if (nextParam == "[/EquipmentDefinitions]")
                 break;
 
@@ -416,22 +471,22 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
                 return false;
             }
 
-            levelFile >> nextParam;
+            sectionStream >> nextParam;
             if (nextParam == "Name")
             {
-                levelFile >> nextParam;
+                sectionStream >> nextParam;
                 Weapon* def = gameMap.getWeaponForTuning(nextParam);
                 if (def == nullptr)
                 {
                     OD_LOG_WRN("Invalid Weapon definition format for " + nextParam);
                     return false;
                 }
-                if(!Weapon::update(def, levelFile))
+                if(!Weapon::update(def, sectionStream))
                     return false;
             }
         }
 
-        levelFile >> nextParam;
+        levelFile.nextToken(nextParam);
     }
 
     // Read in the actual creatures themselves
@@ -441,18 +496,23 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
         return false;
     }
 
+    sectionStream.str("");
+    sectionStream.clear();
+    if(!levelFile.readSection("[/Creatures]", sectionStream))
+        return false;
+
     uint32_t nbCreatures = 0;
     while(true)
     {
-        if(!levelFile.good())
+        if(!sectionStream.good())
             return false;
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam == "[/Creatures]")
             break;
 
         std::string entire_line = nextParam;
-        std::getline(levelFile, nextParam);
+        std::getline(sectionStream, nextParam);
         entire_line += nextParam;
 
         std::stringstream ss(entire_line);
@@ -513,25 +573,29 @@ bool readGameMapFromFile(const std::string& fileName, GameMap& gameMap)
     return true;
 }
 
-bool readGameEntity(GameMap& gameMap, const std::string& item, GameEntityType type, std::stringstream& levelFile)
+bool readGameEntity(GameMap& gameMap, const std::string& item, GameEntityType type, LevelTokenizer& levelFile)
 {
     std::string nextParam;
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[" + item + "]")
         return false;
 
+    std::stringstream sectionStream;
+    if(!levelFile.readSection("[/" + item + "]", sectionStream))
+        return false;
+
     uint32_t nbEntity = 0;
     while(true)
     {
-        if(!levelFile.good())
+        if(!sectionStream.good())
             return false;
 
-        levelFile >> nextParam;
+        sectionStream >> nextParam;
         if (nextParam == "[/" + item + "]")
             break;
 
         std::string entire_line = nextParam;
-        std::getline(levelFile, nextParam);
+        std::getline(sectionStream, nextParam);
         entire_line += nextParam;
 
         std::stringstream ss(entire_line);
@@ -560,6 +624,19 @@ bool writeGameMapToFile(const std::string& fileName, GameMap& gameMap)
         return false;
     }
 
+    writeGameMapToStream(levelFile, gameMap);
+
+    if (!levelFile.good()) {
+        OD_LOG_WRN("Unexpected failure on file: " + fileName);
+        return false;
+    }
+
+    levelFile.close();
+    return true;
+}
+
+void writeGameMapToStream(std::ostream& levelFile, GameMap& gameMap)
+{
     // Write the identifier string and the version number
     levelFile << ODApplication::VERSIONSTRING
             << "  # The version of OpenDungeons which created this file (for compatibility reasons).\n";
@@ -778,42 +855,33 @@ bool writeGameMapToFile(const std::string& fileName, GameMap& gameMap)
         levelFile << std::endl;
     }
     levelFile << "[/Chickens]" << std::endl;
-
-    if (!levelFile.good()) {
-        OD_LOG_WRN("Unexpected failure on file: " + fileName);
-        return false;
-    }
-
-    levelFile.close();
-    return true;
 }
 
-bool getMapInfo(const std::string& fileName, LevelInfo& levelInfo)
+//! \brief Reads the level header. Only the beginning of the level file is read: the level is
+//! memory mapped and we stop reading at the map size.
+static bool readMapInfo(const std::string& fileName, LevelInfo& levelInfo)
 {
-    // Prepare an invalid level reference
-    std::stringstream levelFile;
-    if(!Helper::readFileWithoutComments(fileName, levelFile))
+    LevelTokenizer levelFile(fileName);
+    if(!levelFile.isOpen())
         return false;
 
     std::string nextParam;
     // Read in the version number from the level file
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam.compare(ODApplication::VERSIONSTRING) != 0)
         return false;
 
-    levelFile >> nextParam;
+    levelFile.nextToken(nextParam);
     if (nextParam != "[Info]")
         return false;
 
-    std::stringstream mapInfo;
-
     // Read in the seats from the level file
     while (true)
     {
-        if(!levelFile.good())
+        // Information can contain spaces. We need to read the whole line to get content
+        if(!levelFile.nextLine(nextParam))
             return false;
-        // Information can contain spaces. We need to use std::getline to get content
-        std::getline(levelFile, nextParam);
+
         std::string param;
         if (nextParam == "[/Info]")
         {
@@ -824,36 +892,27 @@ bool getMapInfo(const std::string& fileName, LevelInfo& levelInfo)
         if (nextParam.compare(0, param.size(), param) == 0)
         {
             levelInfo.mLevelName = nextParam.substr(param.size());
-            mapInfo << levelInfo.mLevelName << std::endl << std::endl;
             continue;
         }
 
         param = "Description\t";
         if (nextParam.compare(0, param.size(), param) == 0)
         {
-            mapInfo << nextParam.substr(param.size()) << std::endl << std::endl;
+            levelInfo.mInfoDescription = nextParam.substr(param.size());
             continue;
         }
 
     }
 
-    levelFile >> nextParam;
-    if (nextParam != "[Seats]")
-    {
-        levelInfo.mLevelDescription = mapInfo.str();
+    if (!levelFile.nextToken(nextParam) || (nextParam != "[Seats]"))
         return true;
-    }
 
     // Read in the seats from the level file
-    int playerSeatNumber = 0;
-    int AISeatNumber = 0;
-    int seatConfigurable = 0;
     while (true)
     {
-        if(!levelFile.good())
+        if(!levelFile.nextToken(nextParam))
             return false;
 
-        levelFile >> nextParam;
         if (nextParam == "[/Seats]")
             break;
 
@@ -863,7 +922,9 @@ bool getMapInfo(const std::string& fileName, LevelInfo& levelInfo)
         while(true)
         {
             std::string line;
-            std::getline(levelFile, line);
+            if(!levelFile.nextLine(line))
+                return false;
+
             std::stringstream ss(line);
             ss >> nextParam;
             if(nextParam == "[/Seat]")
@@ -875,73 +936,104 @@ bool getMapInfo(const std::string& fileName, LevelInfo& levelInfo)
             // We get the player type
             ss >> nextParam;
             if (nextParam == Seat::PLAYER_TYPE_HUMAN)
-                ++playerSeatNumber;
+                ++levelInfo.mNbSeatsHuman;
             else if (nextParam == Seat::PLAYER_TYPE_CHOICE)
-                ++seatConfigurable;
+                ++levelInfo.mNbSeatsConfigurable;
             else if (nextParam == Seat::PLAYER_TYPE_AI)
-                ++AISeatNumber;
+                ++levelInfo.mNbSeatsAI;
         }
     }
 
-    if (playerSeatNumber > 0 || AISeatNumber > 0)
+    // Read in the goals that are shared by all players, the first player to complete all these goals is the winner.
+    if (!levelFile.nextToken(nextParam) || (nextParam != "[Goals]"))
+        return true;
+
+    while(true)
+    {
+        if(!levelFile.nextToken(nextParam))
+            return false;
+
+        if (nextParam == "[/Goals]")
+            break;
+    }
+
+    if (!levelFile.nextToken(nextParam) || (nextParam != "[Tiles]"))
+        return true;
+
+    // Load the map size on next two lines. We do not need to read the tiles
+    int32_t mapSizeX;
+    int32_t mapSizeY;
+    if(!levelFile.nextInt32(mapSizeX) ||
+       !levelFile.nextInt32(mapSizeY))
+    {
+        return true;
+    }
+
+    levelInfo.mMapSizeX = mapSizeX;
+    levelInfo.mMapSizeY = mapSizeY;
+    return true;
+}
+
+static LevelIndex& getLevelIndex()
+{
+    static LevelIndex levelIndex(ResourceManager::getSingleton().getLevelCachePath() + "levelIndex.txt");
+    return levelIndex;
+}
+
+bool getMapInfo(const std::string& fileName, LevelInfo& levelInfo)
+{
+    bool isCacheEnabled = ResourceManager::getSingleton().isLevelCacheEnabled();
+    if(isCacheEnabled && getLevelIndex().getLevelInfo(fileName, levelInfo))
+        return true;
+
+    levelInfo = LevelInfo();
+    if(!readMapInfo(fileName, levelInfo))
+        return false;
+
+    buildLevelDescription(levelInfo);
+    if(isCacheEnabled)
+        getLevelIndex().setLevelInfo(fileName, levelInfo);
+
+    return true;
+}
+
+void buildLevelDescription(LevelInfo& levelInfo)
+{
+    std::stringstream mapInfo;
+    if (!levelInfo.mLevelName.empty())
+        mapInfo << levelInfo.mLevelName << std::endl << std::endl;
+
+    if (!levelInfo.mInfoDescription.empty())
+        mapInfo << levelInfo.mInfoDescription << std::endl << std::endl;
+
+    if (levelInfo.mNbSeatsHuman > 0 || levelInfo.mNbSeatsAI > 0)
     {
         std::string str;
 
-        if (playerSeatNumber > 0)
-            str += "Player slot(s): " + Helper::toString(playerSeatNumber);
-        if (AISeatNumber > 0)
+        if (levelInfo.mNbSeatsHuman > 0)
+            str += "Player slot(s): " + Helper::toString(levelInfo.mNbSeatsHuman);
+        if (levelInfo.mNbSeatsAI > 0)
         {
             if(!str.empty())
                 str += " / ";
 
-            str += "AI: " + Helper::toString(AISeatNumber);
+            str += "AI: " + Helper::toString(levelInfo.mNbSeatsAI);
         }
-        if (seatConfigurable > 0)
+        if (levelInfo.mNbSeatsConfigurable > 0)
         {
             if(!str.empty())
                 str += " / ";
 
-            str += "Configurable: " + Helper::toString(seatConfigurable);
+            str += "Configurable: " + Helper::toString(levelInfo.mNbSeatsConfigurable);
         }
 
         mapInfo << str << std::endl << std::endl;
     }
 
-    // Read in the goals that are shared by all players, the first player to complete all these goals is the winner.
-    levelFile >> nextParam;
-    if (nextParam != "[Goals]")
-    {
-        levelInfo.mLevelDescription = mapInfo.str();
-        return true;
-    }
-
-    while(true)
-    {
-        if(!levelFile.good())
-            return false;
-
-        levelFile >> nextParam;
-        if (nextParam == "[/Goals]")
-            break;
-    }
-
-    levelFile >> nextParam;
-    if (nextParam != "[Tiles]")
-    {
-        levelInfo.mLevelDescription = mapInfo.str();
-        return true;
-    }
-
-    // Load the map size on next two lines
-    int mapSizeX;
-    int mapSizeY;
-    levelFile >> mapSizeX;
-    levelFile >> mapSizeY;
-
-    mapInfo << "Size: " << mapSizeX << "x" << mapSizeY << std::endl << std::endl;
+    if (levelInfo.mMapSizeX > 0 && levelInfo.mMapSizeY > 0)
+        mapInfo << "Size: " << levelInfo.mMapSizeX << "x" << levelInfo.mMapSizeY << std::endl << std::endl;
 
     levelInfo.mLevelDescription = mapInfo.str();
-    return true;
 }
 
 } // Namespace MapHandler
@@ -19,16 +19,23 @@
 #ifndef MAPHANDLER_H
 #define MAPHANDLER_H
 
+#include <iosfwd>
 #include <string>
 
 class GameMap;
+class LevelTokenizer;
 
 enum class GameEntityType;
 
 //! \brief A small structure storing level info for the player
 struct LevelInfo
 {
-    LevelInfo()
+    LevelInfo() :
+        mMapSizeX(0),
+        mMapSizeY(0),
+        mNbSeatsHuman(0),
+        mNbSeatsAI(0),
+        mNbSeatsConfigurable(0)
     {}
 
     //! \brief The level visible name
@@ -36,6 +43,15 @@ struct LevelInfo
 
     //! \brief The level description, player's slot, size, ...
     std::string mLevelDescription;
+
+    //! \brief The description as written in the [Info] section of the level
+    std::string mInfoDescription;
+
+    int mMapSizeX;
+    int mMapSizeY;
+    int mNbSeatsHuman;
+    int mNbSeatsAI;
+    int mNbSeatsConfigurable;
 };
 
 namespace MapHandler
@@ -44,7 +60,11 @@ namespace MapHandler
 
     bool writeGameMapToFile(const std::string& fileName, GameMap& gameMap);
 
-    bool readGameEntity(GameMap& gameMap, const std::string& item, GameEntityType type, std::stringstream& levelFile);
+    //! \brief Writes the level to the given stream. It is used to take a snapshot of the game in memory
+    //! so that it can be written to disk without blocking the server (see MapSnapshotWriter)
+    void writeGameMapToStream(std::ostream& levelFile, GameMap& gameMap);
+
+    bool readGameEntity(GameMap& gameMap, const std::string& item, GameEntityType type, LevelTokenizer& levelFile);
 
     bool loadEquipments(const std::string& fileName, GameMap& gameMap);
 
@@ -52,8 +72,13 @@ namespace MapHandler
 
     //! \brief Reads the main user map info. Returns true if the level could be read and levelInfo is set to
     //! corresponding info. Returns false otherwise.
+    //! Only the level header is read (up to the map size). The result is kept in the level index so that
+    //! the level is not read again as long as it is not modified.
     bool getMapInfo(const std::string& fileName, LevelInfo& levelInfo);
 
+    //! \brief Sets levelInfo.mLevelDescription from the other fields of levelInfo
+    void buildLevelDescription(LevelInfo& levelInfo);
+
     //! \brief Level extension constant, used in different GUI modes.
     static const std::string LEVEL_EXTENSION = ".level";
 };
@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gamemap/MapSnapshotWriter.h"
+
+#include "utils/Helper.h"
+#include "utils/LogManager.h"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <fstream>
+
+MapSnapshotWriter::MapSnapshotWriter() :
+    mIsWriting(false),
+    mExit(false),
+    mThread(&MapSnapshotWriter::writerThread, this)
+{
+}
+
+MapSnapshotWriter::~MapSnapshotWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mWakeUpCondition.notify_one();
+    mThread.join();
+}
+
+void MapSnapshotWriter::queueSnapshot(const std::string& fileName, std::string& data, bool isAutosave)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPendingSnapshots.push_back(Snapshot());
+        Snapshot& snapshot = mPendingSnapshots.back();
+        snapshot.mFileName = fileName;
+        snapshot.mData.swap(data);
+        snapshot.mIsAutosave = isAutosave;
+    }
+    mWakeUpCondition.notify_one();
+}
+
+bool MapSnapshotWriter::popResult(Result& result)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(mResults.empty())
+        return false;
+
+    result = mResults.front();
+    mResults.pop_front();
+    return true;
+}
+
+bool MapSnapshotWriter::hasPendingWrites()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mIsWriting || !mPendingSnapshots.empty();
+}
+
+void MapSnapshotWriter::waitPendingWrites()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mIdleCondition.wait(lock, [this]() { return !mIsWriting && mPendingSnapshots.empty(); });
+}
+
+void MapSnapshotWriter::writerThread()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while(true)
+    {
+        // We write every pending snapshot before exiting
+        mWakeUpCondition.wait(lock, [this]() { return mExit || !mPendingSnapshots.empty(); });
+        if(mPendingSnapshots.empty())
+            return;
+
+        Snapshot snapshot;
+        snapshot.mFileName.swap(mPendingSnapshots.front().mFileName);
+        snapshot.mData.swap(mPendingSnapshots.front().mData);
+        snapshot.mIsAutosave = mPendingSnapshots.front().mIsAutosave;
+        mPendingSnapshots.pop_front();
+        mIsWriting = true;
+        lock.unlock();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Result result;
+        result.mFileName = snapshot.mFileName;
+        result.mIsAutosave = snapshot.mIsAutosave;
+        result.mSuccess = writeSnapshot(snapshot);
+        result.mWriteTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        OD_LOG_INF("Snapshot written file=" + result.mFileName + ", size=" + Helper::toString(static_cast<uint64_t>(snapshot.mData.size()))
+            + ", writeTimeMs=" + Helper::toString(result.mWriteTimeMs));
+
+        lock.lock();
+        mIsWriting = false;
+        mResults.push_back(result);
+        mIdleCondition.notify_all();
+    }
+}
+
+bool MapSnapshotWriter::writeSnapshot(const Snapshot& snapshot)
+{
+    try
+    {
+        // If the file exists, we make a backup
+        if (boost::filesystem::exists(snapshot.mFileName))
+            boost::filesystem::rename(snapshot.mFileName, snapshot.mFileName + ".bak");
+    }
+    catch(const boost::filesystem::filesystem_error& e)
+    {
+        OD_LOG_WRN("Couldn't backup file=" + snapshot.mFileName + ", error=" + e.what());
+        return false;
+    }
+
+    std::ofstream levelFile(snapshot.mFileName.c_str(), std::ios::out);
+    if (!levelFile.good())
+    {
+        OD_LOG_WRN("Couldn't open file for writing: " + snapshot.mFileName);
+        return false;
+    }
+
+    levelFile.write(snapshot.mData.data(), static_cast<std::streamsize>(snapshot.mData.size()));
+    levelFile.close();
+    if (levelFile.fail())
+    {
+        OD_LOG_WRN("Unexpected failure on file: " + snapshot.mFileName);
+        return false;
+    }
+
+    return true;
+}
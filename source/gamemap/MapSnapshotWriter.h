@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MAPSNAPSHOTWRITER_H
+#define MAPSNAPSHOTWRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+//! \brief Writes game snapshots to disk on a background thread. The server serializes the game
+//! in memory between 2 turns (see MapHandler::writeGameMapToStream) and queues the result here. Disk
+//! access (backup of the previous file and writing) is done by the writer thread so that the
+//! server turns are not delayed.
+//! The results are retrieved by the server thread with popResult so that the players can be notified
+//! from the server thread.
+class MapSnapshotWriter
+{
+public:
+    struct Result
+    {
+        std::string mFileName;
+        bool mIsAutosave;
+        bool mSuccess;
+        //! \brief Time spent writing the file to disk
+        double mWriteTimeMs;
+    };
+
+    MapSnapshotWriter();
+
+    //! \brief Waits for the pending snapshots to be written
+    ~MapSnapshotWriter();
+
+    //! \brief Queues the given snapshot. data is moved to the queue to avoid copying it.
+    //! If the file already exists, it will be renamed with .bak extension before writing.
+    void queueSnapshot(const std::string& fileName, std::string& data, bool isAutosave);
+
+    //! \brief Returns true if there was a result to retrieve. In this case, result is set.
+    bool popResult(Result& result);
+
+    //! \brief Returns true if some snapshots are waiting to be written or are being written
+    bool hasPendingWrites();
+
+    //! \brief Blocks until every queued snapshot is written
+    void waitPendingWrites();
+
+private:
+    struct Snapshot
+    {
+        std::string mFileName;
+        std::string mData;
+        bool mIsAutosave;
+    };
+
+    MapSnapshotWriter(const MapSnapshotWriter&) = delete;
+    MapSnapshotWriter& operator=(const MapSnapshotWriter&) = delete;
+
+    void writerThread();
+
+    static bool writeSnapshot(const Snapshot& snapshot);
+
+    std::mutex mMutex;
+    std::condition_variable mWakeUpCondition;
+    std::condition_variable mIdleCondition;
+    std::deque<Snapshot> mPendingSnapshots;
+    std::deque<Result> mResults;
+    bool mIsWriting;
+    bool mExit;
+    std::thread mThread;
+};
+
+#endif // MAPSNAPSHOTWRITER_H
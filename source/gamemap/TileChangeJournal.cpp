@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "gamemap/TileChangeJournal.h"
+
+//! \brief Removes from batch the changes in applied. applied should contain changes from batch in the same order
+static void removeAppliedChanges(std::vector<TileChangeJournal::TileChange>& batch,
+    const std::vector<TileChangeJournal::TileChange>& applied)
+{
+    uint32_t indexApplied = 0;
+    uint32_t nbKept = 0;
+    for(const TileChangeJournal::TileChange& change : batch)
+    {
+        if((indexApplied < applied.size()) &&
+           (applied[indexApplied].mX == change.mX) &&
+           (applied[indexApplied].mY == change.mY))
+        {
+            ++indexApplied;
+            continue;
+        }
+
+        batch[nbKept] = change;
+        ++nbKept;
+    }
+    batch.resize(nbKept);
+}
+
+TileChangeJournal::TileChangeJournal(uint32_t maxBatches) :
+    mMaxBatches(maxBatches)
+{
+}
+
+void TileChangeJournal::pushBatch(std::vector<TileChange>& batch)
+{
+    if(batch.empty())
+        return;
+
+    mRedoBatches.clear();
+    addUndoBatch(batch);
+}
+
+void TileChangeJournal::addUndoBatch(std::vector<TileChange>& batch)
+{
+    mUndoBatches.push_back(std::move(batch));
+    batch.clear();
+    while(mUndoBatches.size() > mMaxBatches)
+        mUndoBatches.pop_front();
+}
+
+bool TileChangeJournal::getUndoBatch(std::vector<TileChange>& batch) const
+{
+    if(mUndoBatches.empty())
+        return false;
+
+    batch = mUndoBatches.back();
+    return true;
+}
+
+void TileChangeJournal::undoApplied(std::vector<TileChange>& applied)
+{
+    if(mUndoBatches.empty())
+        return;
+
+    removeAppliedChanges(mUndoBatches.back(), applied);
+    if(mUndoBatches.back().empty())
+        mUndoBatches.pop_back();
+
+    if(applied.empty())
+        return;
+
+    mRedoBatches.push_back(std::move(applied));
+    applied.clear();
+}
+
+bool TileChangeJournal::getRedoBatch(std::vector<TileChange>& batch) const
+{
+    if(mRedoBatches.empty())
+        return false;
+
+    batch = mRedoBatches.back();
+    return true;
+}
+
+void TileChangeJournal::redoApplied(std::vector<TileChange>& applied)
+{
+    if(mRedoBatches.empty())
+        return;
+
+    removeAppliedChanges(mRedoBatches.back(), applied);
+    if(mRedoBatches.back().empty())
+        mRedoBatches.pop_back();
+
+    if(applied.empty())
+        return;
+
+    addUndoBatch(applied);
+}
+
+void TileChangeJournal::clear()
+{
+    mUndoBatches.clear();
+    mRedoBatches.clear();
+}
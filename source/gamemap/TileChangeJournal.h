@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TILECHANGEJOURNAL_H
+#define TILECHANGEJOURNAL_H
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+enum class TileType;
+
+//! \brief Keeps the tiles changes done in the editor so that they can be undone/redone.
+//! A batch is the list of the tiles changed by one editor request (usually a rectangle
+//! selection). Each change stores the tile state before and after so that it can be applied
+//! in both directions.
+class TileChangeJournal
+{
+public:
+    struct TileChange
+    {
+        int mX;
+        int mY;
+        TileType mOldType;
+        double mOldFullness;
+        //! \brief Seat id of the claimed tile, -1 if not claimed
+        int mOldSeatId;
+        TileType mNewType;
+        double mNewFullness;
+        int mNewSeatId;
+    };
+
+    explicit TileChangeJournal(uint32_t maxBatches);
+
+    //! \brief Adds the given batch to the undo history. The redo history is lost. If there are more
+    //! than maxBatches batches, the oldest one is forgotten. batch is moved to avoid copying it.
+    void pushBatch(std::vector<TileChange>& batch);
+
+    //! \brief Returns false if there is nothing to undo. Otherwise, batch is set to a copy of the last
+    //! batch. The caller should apply the old values and then call undoApplied with the changes it applied
+    bool getUndoBatch(std::vector<TileChange>& batch) const;
+
+    //! \brief Moves the given changes from the last batch to the redo history. applied should be the batch
+    //! returned by getUndoBatch without the changes that could not be applied (in the same order). These
+    //! stay in the undo history. applied is moved to avoid copying it.
+    void undoApplied(std::vector<TileChange>& applied);
+
+    //! \brief Same as getUndoBatch for the last undone batch. The caller should apply the new values
+    //! and then call redoApplied with the changes it applied
+    bool getRedoBatch(std::vector<TileChange>& batch) const;
+
+    //! \brief Same as undoApplied from the redo history to the undo history
+    void redoApplied(std::vector<TileChange>& applied);
+
+    void clear();
+
+private:
+    //! \brief Adds the given batch to the undo history and forgets the oldest ones if needed
+    void addUndoBatch(std::vector<TileChange>& batch);
+
+    uint32_t mMaxBatches;
+    std::deque<std::vector<TileChange>> mUndoBatches;
+    std::vector<std::vector<TileChange>> mRedoBatches;
+};
+
+#endif // TILECHANGEJOURNAL_H
@@ -23,8 +23,13 @@
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+#include <algorithm>
+
 const std::vector<Tile*> EMPTY_TILES;
 
+//! \brief Size of the square blocks used to track vision changes
+static const int VISION_BLOCK_SIZE = 8;
+
 class TileDistance
 {
 public:
@@ -332,8 +337,10 @@ TileContainer::TileContainer(int initTileDistance):
     mMapSizeX(0),
     mMapSizeY(0),
     mRr(0),
-    mTiles(nullptr),
-    mTileDistanceComputed(0)
+    mTileDistanceComputed(0),
+    mNbVisionBlocksX(0),
+    mNbVisionBlocksY(0),
+    mNbTeams(0)
 {
     buildTileDistance(initTileDistance);
 }
@@ -345,22 +352,22 @@ TileContainer::~TileContainer()
 
 void TileContainer::clearTiles()
 {
-    if (mTiles)
+    for (Tile* tile : mTiles)
     {
-        for (int ii = 0; ii < mMapSizeX; ++ii)
-        {
-            for (int jj = 0; jj < mMapSizeY; ++jj)
-            {
-                mTiles[ii][jj]->destroyMesh();
-                delete mTiles[ii][jj];
-            }
-            delete[] mTiles[ii];
-        }
-        delete[] mTiles;
-        mTiles = nullptr;
+        tile->destroyMesh();
+        delete tile;
     }
+    mTiles.clear();
     mMapSizeX = 0;
     mMapSizeY = 0;
+    mVisionBlockVersions.clear();
+    mNbVisionBlocksX = 0;
+    mNbVisionBlocksY = 0;
+    mFloodFillColors.clear();
+    mNbTeams = 0;
+    mTileTypes.clear();
+    mTileFullness.clear();
+    mTileClaimedPercentages.clear();
 }
 
 bool TileContainer::addTile(Tile* t)
@@ -370,12 +377,16 @@ bool TileContainer::addTile(Tile* t)
 
     if (x < getMapSizeX() && y < getMapSizeY() && x >= 0 && y >= 0)
     {
-        if(mTiles[x][y] != nullptr)
+        Tile*& tile = mTiles[getTileIndex(x, y)];
+        if(tile != nullptr)
         {
-            mTiles[x][y]->destroyMesh();
-            delete mTiles[x][y];
+            tile->destroyMesh();
+            delete tile;
         }
-        mTiles[x][y] = t;
+        tile = t;
+        if(mNbTeams > 0)
+            setTileFloodFillColors(*t);
+
         return true;
     }
 
@@ -432,48 +443,140 @@ Tile* TileContainer::tileFromPacket(ODPacket& packet) const
     return tile;
 }
 
-bool TileContainer::allocateMapMemory(int xSize, int ySize)
+void TileContainer::tilesToPacket(ODPacket& packet, const std::vector<Tile*>& tiles) const
 {
-    if (xSize <= 0 || ySize <= 0)
+    // We count the runs first because the reader needs to know how many there are
+    uint32_t nbRuns = 0;
+    for(uint32_t i = 0; i < tiles.size(); ++i)
     {
-        OD_LOG_ERR("Invalid map size given, xSize=" + Helper::toString(xSize) + ", ySize=" + Helper::toString(ySize));
-        return false;
+        if((i == 0) ||
+           (tiles[i]->getX() != tiles[i - 1]->getX()) ||
+           (tiles[i]->getY() != tiles[i - 1]->getY() + 1))
+        {
+            ++nbRuns;
+        }
     }
 
-    // Clear memory usage first
-    if (mTiles)
+    packet << nbRuns;
+    uint32_t i = 0;
+    while(i < tiles.size())
     {
-        for(int ii = 0; ii < mMapSizeX; ++ii)
+        int32_t x = tiles[i]->getX();
+        int32_t y = tiles[i]->getY();
+        uint32_t length = 1;
+        while((i + length < tiles.size()) &&
+              (tiles[i + length]->getX() == x) &&
+              (tiles[i + length]->getY() == y + static_cast<int32_t>(length)))
         {
-            for(int jj = 0; jj < mMapSizeY; ++jj)
+            ++length;
+        }
+
+        packet << x << y << length;
+        i += length;
+    }
+}
+
+bool TileContainer::tilesFromPacket(ODPacket& packet, std::vector<Tile*>& tiles) const
+{
+    uint32_t nbRuns;
+    if(!(packet >> nbRuns))
+        return false;
+
+    while(nbRuns > 0)
+    {
+        --nbRuns;
+        int32_t x;
+        int32_t y;
+        uint32_t length;
+        if(!(packet >> x >> y >> length))
+            return false;
+
+        for(uint32_t i = 0; i < length; ++i)
+        {
+            Tile* tile = getTile(x, y + static_cast<int32_t>(i));
+            if(tile == nullptr)
             {
-                delete  mTiles[ii][jj];
+                OD_LOG_ERR("tile=" + Helper::toString(x) + "," + Helper::toString(y + static_cast<int32_t>(i)));
+                continue;
             }
-            delete [] mTiles[ii];
+            tiles.push_back(tile);
         }
-        delete [] mTiles;
     }
 
-    // Set map size
-    mMapSizeX = xSize;
-    mMapSizeY = ySize;
+    return true;
+}
 
-    mTiles = new Tile **[mMapSizeX];
-    if(!mTiles)
+bool TileContainer::allocateMapMemory(int xSize, int ySize)
+{
+    if (xSize <= 0 || ySize <= 0)
     {
-        OD_LOG_ERR("Failed to allocate map memory");
+        OD_LOG_ERR("Invalid map size given, xSize=" + Helper::toString(xSize) + ", ySize=" + Helper::toString(ySize));
         return false;
     }
-    for(int ii = 0; ii < mMapSizeX; ++ii)
+
+    // Clear memory usage first
+    for(Tile* tile : mTiles)
+        delete tile;
+
+    mFloodFillColors.clear();
+    mNbTeams = 0;
+
+    // Set map size
+    mMapSizeX = xSize;
+    mMapSizeY = ySize;
+
+    mNbVisionBlocksX = (mMapSizeX + VISION_BLOCK_SIZE - 1) / VISION_BLOCK_SIZE;
+    mNbVisionBlocksY = (mMapSizeY + VISION_BLOCK_SIZE - 1) / VISION_BLOCK_SIZE;
+    mVisionBlockVersions.assign(mNbVisionBlocksX * mNbVisionBlocksY, 0);
+
+    mTiles.assign(mMapSizeX * mMapSizeY, nullptr);
+    mTileTypes.assign(mTiles.size() + 1, TileType::dirt);
+    mTileFullness.assign(mTiles.size() + 1, 0.0);
+    mTileClaimedPercentages.assign(mTiles.size() + 1, 0.0);
+
+    return true;
+}
+
+void TileContainer::setTeamsNumber(uint32_t nbTeams)
+{
+    mNbTeams = nbTeams;
+    mFloodFillColors.assign(mTiles.size() * mNbTeams * static_cast<uint32_t>(FloodFillType::nbValues), Tile::NO_FLOODFILL);
+    for(Tile* tile : mTiles)
     {
-        mTiles[ii] = new Tile *[mMapSizeY];
-        for(int jj = 0; jj < mMapSizeY; ++jj)
-        {
-            mTiles[ii][jj] = nullptr;
-        }
+        if(tile == nullptr)
+            continue;
+
+        setTileFloodFillColors(*tile);
     }
+}
 
-    return true;
+void TileContainer::setTileFloodFillColors(Tile& tile)
+{
+    uint32_t nbValuesPerTile = mNbTeams * static_cast<uint32_t>(FloodFillType::nbValues);
+    uint32_t index = getTileIndex(tile.getX(), tile.getY()) * nbValuesPerTile;
+    tile.setFloodFillColors(&mFloodFillColors[index], mNbTeams);
+}
+
+void TileContainer::setTileValuesStorage(Tile& tile)
+{
+    int x = tile.getX();
+    int y = tile.getY();
+    uint32_t index = static_cast<uint32_t>(mTiles.size());
+    if (x < getMapSizeX() && y < getMapSizeY() && x >= 0 && y >= 0)
+        index = getTileIndex(x, y);
+
+    tile.setValuesStorage(&mTileTypes[index], &mTileFullness[index], &mTileClaimedPercentages[index]);
+}
+
+size_t TileContainer::getTileContainerMemoryFootprint() const
+{
+    return mTiles.capacity() * sizeof(Tile*)
+        + mFloodFillColors.capacity() * sizeof(uint32_t)
+        + mTileTypes.capacity() * sizeof(TileType)
+        + mTileFullness.capacity() * sizeof(double)
+        + mTileClaimedPercentages.capacity() * sizeof(double)
+        + mVisionBlockVersions.capacity() * sizeof(uint32_t)
+        + mTileDistance.capacity() * sizeof(TileDistance);
 }
 
 std::vector<Tile*> TileContainer::rectangularRegion(int x1, int y1, int x2, int y2)
@@ -718,9 +821,9 @@ void TileContainer::buildTileDistance(int distance)
     mTileDistanceComputed = distance;
 }
 
-std::list<Tile*> TileContainer::tilesBetween(int x1, int y1, int x2, int y2) const
+void TileContainer::tilesBetween(int x1, int y1, int x2, int y2, std::vector<Tile*>& path) const
 {
-    std::list<Tile*> path;
+    path.clear();
 
     double deltax = x2 - x1;
     double deltay = y2 - y1;
@@ -804,8 +907,6 @@ std::list<Tile*> TileContainer::tilesBetween(int x1, int y1, int x2, int y2) con
     Tile* tile = getTile(x2, y2);
     if(tile != nullptr)
         path.push_back(tile);
-
-    return path;
 }
 
 std::vector<Tile*> TileContainer::visibleTiles(int x, int y, int radius)
@@ -969,3 +1070,34 @@ std::vector<Tile*> TileContainer::visibleTiles(int x, int y, int radius)
     }
     return returnList;
 }
+
+void TileContainer::notifyVisionChanged(const Tile& tile)
+{
+    if(mVisionBlockVersions.empty())
+        return;
+
+    int blockX = tile.getX() / VISION_BLOCK_SIZE;
+    int blockY = tile.getY() / VISION_BLOCK_SIZE;
+    ++mVisionBlockVersions[blockX * mNbVisionBlocksY + blockY];
+}
+
+uint32_t TileContainer::getVisionVersion(int x, int y, int radius) const
+{
+    if(mVisionBlockVersions.empty())
+        return 0;
+
+    int blockXMin = std::max(0, x - radius) / VISION_BLOCK_SIZE;
+    int blockXMax = std::min(mMapSizeX - 1, x + radius) / VISION_BLOCK_SIZE;
+    int blockYMin = std::max(0, y - radius) / VISION_BLOCK_SIZE;
+    int blockYMax = std::min(mMapSizeY - 1, y + radius) / VISION_BLOCK_SIZE;
+
+    // Counters only increase so the sum changes as soon as one of them changes
+    uint32_t version = 0;
+    for(int blockX = blockXMin; blockX <= blockXMax; ++blockX)
+    {
+        for(int blockY = blockYMin; blockY <= blockYMax; ++blockY)
+            version += mVisionBlockVersions[blockX * mNbVisionBlocksY + blockY];
+    }
+
+    return version;
+}
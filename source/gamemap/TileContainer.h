@@ -19,6 +19,8 @@
 #define TILECONTAINER_H
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <list>
 #include <vector>
 
@@ -47,10 +49,8 @@ public:
     //! \brief Returns a pointer to the tile at location (x, y) (const version).
     inline Tile* getTile(int xx, int yy) const
     {
-        assert(mTiles != nullptr);
-
         if (xx < getMapSizeX() && yy < getMapSizeY() && xx >= 0 && yy >= 0)
-            return mTiles[xx][yy];
+            return mTiles[getTileIndex(xx, yy)];
         else
         {
             return nullptr;
@@ -62,6 +62,14 @@ public:
     void tileToPacket(ODPacket& packet, Tile* tile) const;
     Tile* tileFromPacket(ODPacket& packet) const;
 
+    //! \brief Same as tileToPacket for a list of tiles. Consecutive tiles of the same column (as
+    //! returned by rectangularRegion) are sent as a single run so that a rectangle costs
+    //! one run per column instead of one coordinate per tile
+    void tilesToPacket(ODPacket& packet, const std::vector<Tile*>& tiles) const;
+    //! \brief Reads the tiles written by tilesToPacket and appends them to tiles.
+    //! Returns false if the packet is invalid
+    bool tilesFromPacket(ODPacket& packet, std::vector<Tile*>& tiles) const;
+
     //! \brief Returns all the valid tiles in the rectangular region specified by the two corner points given.
     std::vector<Tile*> rectangularRegion(int x1, int y1, int x2, int y2);
 
@@ -84,19 +92,41 @@ public:
     int getMapSizeY() const
     { return mMapSizeY; }
 
-    /*! \brief Returns a list of valid tiles along a straight line from (x1, y1) to (x2, y2)
-     * independently from their fullness or type.
+    /*! \brief Fills path with the valid tiles along a straight line from (x1, y1) to (x2, y2)
+     * independently from their fullness or type. path is cleared first so that callers can
+     * reuse the same vector without reallocating it.
      *
      * This algorithm is from
      * http://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
      * A more detailed description of how it works can be found there.
      */
-    std::list<Tile*> tilesBetween(int x1, int y1, int x2, int y2) const;
+    void tilesBetween(int x1, int y1, int x2, int y2, std::vector<Tile*>& path) const;
 
     //! \brief Returns the tiles visible from the given start tile within radius. The tiles are ordered from the closest to
     //! the furthest
     std::vector<Tile*> visibleTiles(int x, int y, int radius);
 
+    //! \brief Should be called when something that can change Tile::permitsVision happens on the
+    //! given tile (fullness, covering building, door state, ...).
+    void notifyVisionChanged(const Tile& tile);
+
+    //! \brief Returns a value that changes whenever notifyVisionChanged is called for a tile close
+    //! to the square of the given radius around (x, y). It allows to cache the result of visibleTiles
+    //! for entities that do not move.
+    uint32_t getVisionVersion(int x, int y, int radius) const;
+
+    //! \brief Sets the number of teams in this gamemap (after seat configuration). This number includes the rogue team.
+    //! The floodfill values of every tile are allocated in a single array.
+    void setTeamsNumber(uint32_t nbTeams);
+
+    //! \brief Makes the given tile store its type, fullness and claimed percentage in the TileContainer arrays.
+    //! Tiles are stored by field so that the loops scanning these values for the whole map stay in cache.
+    //! Tiles with coordinates outside the map share a spare slot
+    void setTileValuesStorage(Tile& tile);
+
+    //! \brief Returns the memory used by the TileContainer arrays (in bytes). The tiles themselves are not counted
+    size_t getTileContainerMemoryFootprint() const;
+
 protected:
     //! \brief The map size
     int mMapSizeX;
@@ -107,7 +137,14 @@ protected:
     //! \brief Set the map size and memory
     bool allocateMapMemory(int xSize, int ySize);
 private:
-    Tile*** mTiles;
+    //! \brief The tiles of the map indexed by getTileIndex
+    std::vector<Tile*> mTiles;
+
+    inline uint32_t getTileIndex(int x, int y) const
+    { return static_cast<uint32_t>(x * mMapSizeY + y); }
+
+    //! \brief Makes the given tile use its floodfill values from mFloodFillColors
+    void setTileFloodFillColors(Tile& tile);
 
     //! \brief Fills mTileDistance that will help to compute a vector with sorted Tiles more efficiently
     void buildTileDistance(int distance);
@@ -118,6 +155,22 @@ private:
     //! \brief Stores the highest distance computed. If a bigger distance is asked, mTileDistance will have to be updated by
     //! calling buildTileDistance with the higher distance
     int mTileDistanceComputed;
+
+    //! \brief Vision change counters for blocks of VISION_BLOCK_SIZE x VISION_BLOCK_SIZE tiles
+    std::vector<uint32_t> mVisionBlockVersions;
+    int mNbVisionBlocksX;
+    int mNbVisionBlocksY;
+
+    //! \brief Floodfill values of every tile. Each tile uses mNbTeams * FloodFillType::nbValues
+    //! consecutive values starting at getTileIndex * mNbTeams * FloodFillType::nbValues
+    std::vector<uint32_t> mFloodFillColors;
+    uint32_t mNbTeams;
+
+    //! \brief Type, fullness and claimed percentage of every tile indexed by getTileIndex. There is one
+    //! more value than tiles (see setTileValuesStorage)
+    std::vector<TileType> mTileTypes;
+    std::vector<double> mTileFullness;
+    std::vector<double> mTileClaimedPercentages;
 };
 
 #endif //TILECONTAINER_H
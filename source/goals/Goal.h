@@ -18,6 +18,7 @@
 #ifndef GOAL_H
 #define GOAL_H
 
+#include <cstdint>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -26,6 +27,18 @@
 class Seat;
 class GameMap;
 
+//! \brief Parts of the game state goals can depend on. When one of them changes, the
+//! GameMap is notified (see GameMap::notifyGoalStateChanged) and the goals depending on it
+//! will be evaluated again.
+enum class GoalDependency
+{
+    creatures,
+    rooms,
+    claimedTiles,
+    goldMined,
+    nbValues
+};
+
 class Goal
 {
 public:
@@ -45,6 +58,11 @@ public:
     virtual bool isUnmet(const Seat& s, const GameMap& gameMap);
     virtual bool isFailed(const Seat&, const GameMap&);
 
+    //! \brief Returns the mask of GoalDependency the goal result depends on. The goal will only
+    //! be evaluated again when one of them has changed. 0 means it is evaluated at every turn.
+    virtual uint32_t getDependencies() const
+    { return 0; }
+
     // Functions which cannot be overridden by child classes
     const std::string& getName() const
     { return mName; }
@@ -58,6 +76,9 @@ public:
     Goal* getFailureSubGoal(int index);
 
     static std::string getFormat();
+
+    static uint32_t dependencyMask(GoalDependency dependency)
+    { return 1u << static_cast<uint32_t>(dependency); }
     friend std::ostream& operator<<(std::ostream& os, Goal& g);
 
 protected:
@@ -32,6 +32,8 @@ public:
     std::string getDescription(const Seat& s);
     std::string getSuccessMessage(const Seat&);
     std::string getFailedMessage(const Seat&);
+    uint32_t getDependencies() const
+    { return dependencyMask(GoalDependency::claimedTiles); }
 
 private:
     unsigned int mNumberOfTiles;
@@ -32,6 +32,8 @@ public:
     std::string getDescription(const Seat &s);
     std::string getSuccessMessage(const Seat &s);
     std::string getFailedMessage(const Seat &s);
+    uint32_t getDependencies() const
+    { return dependencyMask(GoalDependency::goldMined); }
 
 private:
     int mGoldToMine;
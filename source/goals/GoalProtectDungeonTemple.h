@@ -35,6 +35,8 @@ public:
     std::string getDescription(const Seat&);
     std::string getSuccessMessage(const Seat&);
     std::string getFailedMessage(const Seat&);
+    uint32_t getDependencies() const
+    { return dependencyMask(GoalDependency::rooms); }
 };
 
 #endif // GOALPROTECTDUNGEONTEMPLE_H
@@ -56,7 +56,12 @@ const std::string HELPMESSAGE =
         "\n\tcatmullspline - Triggers the catmullspline camera movement type."
         "\n\tcirclearound - Triggers the circle camera movement type."
         "\n\tsetcamerafovy - Sets the camera vertical field of view aspect ratio value."
-        "\n\tlogfloodfill - Displays the FloodFillValues of all the Tiles in the GameMap.";
+        "\n\tlogfloodfill - Displays the FloodFillValues of all the Tiles in the GameMap."
+        "\n\taitaskstats - Logs the timing statistics of the AI tasks."
+        "\n\tnotifpoolstats - Logs the server notification pool statistics."
+        "\n\tmemoryfootprint - Logs the memory used by the tiles and the related structures."
+        "\n\tcheckseatcounters - Checks the claimed tiles and creatures counters of the seats against a full recount."
+        "\n\tstatehash - Displays the hash of the game state for the current turn.";
 
 //! \brief Template function to get/set a variable from the ODFrameListener object
 template<typename ValType, typename Getter, typename Setter>
@@ -418,6 +423,37 @@ Command::Result cSrvLogFloodFill(const Command::ArgumentList_t&, ConsoleInterfac
     return Command::Result::SUCCESS;
 }
 
+Command::Result cSrvLogAITaskStats(const Command::ArgumentList_t&, ConsoleInterface& c, GameMap& gameMap)
+{
+    gameMap.logAITaskStats();
+    return Command::Result::SUCCESS;
+}
+
+Command::Result cSrvLogNotificationPoolStats(const Command::ArgumentList_t&, ConsoleInterface& c, GameMap&)
+{
+    ODServer::getSingleton().logServerNotificationPoolStats();
+    return Command::Result::SUCCESS;
+}
+
+Command::Result cSrvLogMemoryFootprint(const Command::ArgumentList_t&, ConsoleInterface& c, GameMap& gameMap)
+{
+    gameMap.logMemoryFootprint();
+    return Command::Result::SUCCESS;
+}
+
+Command::Result cSrvCheckSeatCounters(const Command::ArgumentList_t&, ConsoleInterface& c, GameMap& gameMap)
+{
+    gameMap.checkSeatCounters();
+    return Command::Result::SUCCESS;
+}
+
+Command::Result cSrvStateHash(const Command::ArgumentList_t&, ConsoleInterface& c, GameMap& gameMap)
+{
+    c.print("Turn " + Helper::toString(gameMap.getTurnNumber())
+        + ", state hash=" + Helper::toString(gameMap.computeStateHash()));
+    return Command::Result::SUCCESS;
+}
+
 Command::Result cSetCameraFOVy(const Command::ArgumentList_t& args, ConsoleInterface& c, AbstractModeManager&)
 {
     Ogre::Camera* cam = ODFrameListener::getSingleton().getCameraManager()->getActiveCamera();
@@ -662,6 +698,36 @@ void addConsoleCommands(ConsoleInterface& cl)
                    cSrvLogFloodFill,
                    {AbstractModeManager::ModeType::GAME},
                    {});
+    cl.addCommand("aitaskstats",
+                   "'aitaskstats' logs, for each AI task, how many times it has been run or deferred and how long it took.",
+                   cSendCmdToServer,
+                   cSrvLogAITaskStats,
+                   {AbstractModeManager::ModeType::GAME},
+                   {});
+    cl.addCommand("notifpoolstats",
+                   "'notifpoolstats' logs how many server notifications are allocated, how many were used during the last turn and how many have been sent.",
+                   cSendCmdToServer,
+                   cSrvLogNotificationPoolStats,
+                   {AbstractModeManager::ModeType::GAME},
+                   {});
+    cl.addCommand("memoryfootprint",
+                   "'memoryfootprint' logs the memory used by the tiles, the tile container arrays and the seats tiles states.",
+                   cSendCmdToServer,
+                   cSrvLogMemoryFootprint,
+                   {AbstractModeManager::ModeType::GAME},
+                   {});
+    cl.addCommand("checkseatcounters",
+                   "'checkseatcounters' recounts the tiles claimed and the creatures of each seat and logs (and fixes) the counters that do not match.",
+                   cSendCmdToServer,
+                   cSrvCheckSeatCounters,
+                   {AbstractModeManager::ModeType::GAME},
+                   {});
+    cl.addCommand("statehash",
+                   "'statehash' displays the hash of the game state (tiles, creatures, rooms gold and seats) for the current turn. 2 runs of the same game should give the same value.",
+                   cSendCmdToServer,
+                   cSrvStateHash,
+                   {AbstractModeManager::ModeType::GAME},
+                   {});
     cl.addCommand("listmeshanims",
                    "'listmeshanims' lists all the animations for the given mesh.",
                    cListMeshAnims,
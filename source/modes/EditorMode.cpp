@@ -689,8 +689,25 @@ bool EditorMode::keyPressed(const OIS::KeyEvent &arg)
         updateCursorText();
         break;
 
-    //Toggle selected seat ID
+    // Undo the last tiles change
+    case OIS::KC_Z:
+        if (getKeyboard()->isModifierDown(OIS::Keyboard::Ctrl))
+        {
+            ClientNotification *clientNotification = new ClientNotification(
+                ClientNotificationType::editorAskUndoTiles);
+            ODClient::getSingleton().queueClientNotification(clientNotification);
+        }
+        break;
+
+    //Toggle selected seat ID (or redo the last undone tiles change with Ctrl)
     case OIS::KC_Y:
+        if (getKeyboard()->isModifierDown(OIS::Keyboard::Ctrl))
+        {
+            ClientNotification *clientNotification = new ClientNotification(
+                ClientNotificationType::editorAskRedoTiles);
+            ODClient::getSingleton().queueClientNotification(clientNotification);
+            break;
+        }
         getModeManager().getInputManager().mSeatIdSelected = mGameMap->nextSeatId(getModeManager().getInputManager().mSeatIdSelected);
         updateCursorText();
         updateFlagColor();
@@ -83,6 +83,10 @@ std::string ClientNotification::typeString(ClientNotificationType type)
             return "askExecuteConsoleCommand";
         case ClientNotificationType::editorAskChangeTiles:
             return "editorAskChangeTiles";
+        case ClientNotificationType::editorAskUndoTiles:
+            return "editorAskUndoTiles";
+        case ClientNotificationType::editorAskRedoTiles:
+            return "editorAskRedoTiles";
         case ClientNotificationType::editorAskBuildRoom:
             return "editorAskBuildRoom";
         case ClientNotificationType::editorAskBuildTrap:
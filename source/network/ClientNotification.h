@@ -56,6 +56,8 @@ enum class ClientNotificationType
 
     //  Editor
     editorAskChangeTiles,
+    editorAskUndoTiles,
+    editorAskRedoTiles,
     editorAskBuildRoom,
     editorAskBuildTrap,
     editorAskDestroyRoomTiles,
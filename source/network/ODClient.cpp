@@ -807,19 +807,15 @@ bool ODClient::processMessage(ServerNotificationType cmd, ODPacket& packetReceiv
         case ServerNotificationType::markTiles:
         {
             bool digSet;
-            uint32_t nbTiles;
-            OD_ASSERT_TRUE(packetReceived >> digSet >> nbTiles);
+            std::vector<Tile*> tiles;
+            OD_ASSERT_TRUE(packetReceived >> digSet);
+            OD_ASSERT_TRUE(gameMap->tilesFromPacket(packetReceived, tiles));
 
             SoundEffectsManager::getSingleton().playRelativeSound(SoundRelativeInterface::PickSelector);
 
             Player* player = getPlayer();
-            while(nbTiles > 0)
+            for(Tile* tile : tiles)
             {
-                --nbTiles;
-                Tile* tile = gameMap->tileFromPacket(packetReceived);
-                if(tile == nullptr)
-                    continue;
-
                 tile->setMarkedForDigging(digSet, player);
                 tile->refreshMesh();
             }
@@ -31,6 +31,7 @@
 #include "game/Seat.h"
 #include "gamemap/GameMap.h"
 #include "gamemap/MapHandler.h"
+#include "gamemap/MapSnapshotWriter.h"
 #include "modes/ConsoleCommands.h"
 #include "network/ODClient.h"
 #include "network/ServerMode.h"
@@ -60,10 +61,12 @@
 
 const std::string SAVEGAME_SKIRMISH_PREFIX = "SK-";
 const std::string SAVEGAME_MULTIPLAYER_PREFIX = "MP-";
+const std::string AUTOSAVE_PREFIX = "Autosave-";
 static const double MASTER_SERVER_UPDATE_PERIOD_MS = 30000.0;
 static const int32_t MASTER_SERVER_STATUS_PENDING = 0;
 static const int32_t MASTER_SERVER_STATUS_STARTED = 1;
 static const int32_t MASTER_SERVER_STATUS_FINISHED = 2;
+static const uint32_t EDITOR_TILE_JOURNAL_MAX_BATCHES = 100;
 
 template<> ODServer* Ogre::Singleton<ODServer>::msSingleton = nullptr;
 
@@ -75,7 +78,12 @@ ODServer::ODServer() :
     mSeatsConfigured(false),
     mPlayerConfig(nullptr),
     mConsoleInterface(std::bind(&ODServer::printConsoleMsg, this, std::placeholders::_1)),
-    mMasterServerGameStatusUpdateTime(0)
+    mMasterServerGameStatusUpdateTime(0),
+    mSnapshotWriter(new MapSnapshotWriter),
+    mAutosaveElapsedTime(0.0),
+    mFixedTurnLength(false),
+    mEditorTileJournal(EDITOR_TILE_JOURNAL_MAX_BATCHES),
+    mExitRequested(false)
 {
     ConsoleCommands::addConsoleCommands(mConsoleInterface);
 }
@@ -94,6 +102,9 @@ bool ODServer::startServer(const std::string& creator, const std::string& levelF
     mMasterServerGameId.clear();
     mMasterServerGameStatusUpdateTime = 0.0;
     mPlayerConfig = nullptr;
+    mAutosaveElapsedTime = 0.0;
+    mEditorTileJournal.clear();
+    mExitRequested = false;
 
     // Start the server socket listener as well as the server socket thread
     if (isConnected())
@@ -123,6 +134,19 @@ bool ODServer::startServer(const std::string& creator, const std::string& levelF
         return false;
     }
 
+    const std::string& stateHashTraceFile = ResourceManager::getSingleton().getStateHashTraceFile();
+    if(!stateHashTraceFile.empty() && (mode != ServerMode::ModeEditor))
+    {
+        mStateHashTrace.open(stateHashTraceFile.c_str(), std::ios::out | std::ios::trunc);
+        if(!mStateHashTrace.is_open())
+            OD_LOG_ERR("Couldn't open state hash trace file=" + stateHashTraceFile);
+    }
+
+    // When the game should be reproducible, the game time cannot depend on the time the turns really took
+    mFixedTurnLength = (ResourceManager::getSingleton().getRandomSeed() >= 0) || !stateHashTraceFile.empty();
+    if(mFixedTurnLength)
+        OD_LOG_INF("Server uses a fixed turn length of " + Helper::toString(1.0 / ODApplication::turnsPerSecond) + "s");
+
     // Set up the socket to listen on the specified port
     int32_t port = getNetworkPort();
     if (!createServer(port))
@@ -232,13 +256,17 @@ bool ODServer::startServer(const std::string& creator, const std::string& levelF
     return true;
 }
 
+ServerNotification* ODServer::createServerNotification(ServerNotificationType type, Player* concernedPlayer)
+{
+    return mServerNotificationPool.acquire(type, concernedPlayer);
+}
+
 void ODServer::queueServerNotification(ServerNotification* n)
 {
+    // If the server is not connected, the notification is dropped. It will be recycled with the others
     if ((n == nullptr) || (!isConnected()))
-    {
-        delete n;
         return;
-    }
+
     mServerNotificationQueue.push_back(n);
 }
 
@@ -293,7 +321,7 @@ void ODServer::handleConsoleCommand(Player* player, GameMap* gameMap, const std:
     }
 
     // We notify all players that a console command has been executed
-    ServerNotification *serverNotification = new ServerNotification(
+    ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
         ServerNotificationType::chatServer, nullptr);
 
     std::string msg = "Console cmd launched: " + args[0];
@@ -316,7 +344,7 @@ void ODServer::startNewTurn(double timeSinceLastTurn)
 
     gameMap->setTurnNumber(++turn);
 
-    ServerNotification* serverNotification = new ServerNotification(
+    ServerNotification* serverNotification = createServerNotification(
         ServerNotificationType::turnStarted, nullptr);
     serverNotification->mPacket << turn;
     queueServerNotification(serverNotification);
@@ -332,7 +360,7 @@ void ODServer::startNewTurn(double timeSinceLastTurn)
         Player* player = sock->getPlayer();
         // For now, only the player whose seat changed is notified. If we need it, we could send the event to every player
         // so that they can see how far from the goals the other players are
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::refreshPlayerSeat, player);
         std::string goals = gameMap->getGoalsStringForPlayer(player);
         Seat* seat = player->getSeat();
@@ -354,7 +382,7 @@ void ODServer::startNewTurn(double timeSinceLastTurn)
             {
                 std::string creatureInfos = creature->getStatsText();
 
-                ServerNotification *serverNotification = new ServerNotification(
+                ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                     ServerNotificationType::notifyCreatureInfo, player);
                 serverNotification->mPacket << name << creatureInfos;
                 ODServer::getSingleton().queueServerNotification(serverNotification);
@@ -388,6 +416,85 @@ void ODServer::startNewTurn(double timeSinceLastTurn)
 
     gameMap->fireRefreshEntities();
     gameMap->processDeletionQueues();
+
+    traceStateHash();
+}
+
+void ODServer::applyEditorTileChanges(std::vector<TileChangeJournal::TileChange>& changes, bool useNewValues)
+{
+    GameMap* gameMap = mGameMap;
+    std::vector<Tile*> affectedTiles;
+    affectedTiles.reserve(changes.size());
+    // The skipped changes are removed by moving the kept ones at the beginning of the vector
+    uint32_t nbKept = 0;
+    for(const TileChangeJournal::TileChange& change : changes)
+    {
+        TileType tileType = useNewValues ? change.mNewType : change.mOldType;
+        double tileFullness = useNewValues ? change.mNewFullness : change.mOldFullness;
+        int seatId = useNewValues ? change.mNewSeatId : change.mOldSeatId;
+        Tile* tile = gameMap->getTile(change.mX, change.mY);
+        if(tile == nullptr)
+        {
+            OD_LOG_ERR("tile=" + Helper::toString(change.mX) + "," + Helper::toString(change.mY));
+            continue;
+        }
+
+        // We do not change tiles where there is something
+        if(((tile->numEntitiesInTile() > 0) &&
+            ((tileFullness > 0.0) || (tileType == TileType::lava) || (tileType == TileType::water))) ||
+           (tile->getCoveringBuilding() != nullptr))
+        {
+            continue;
+        }
+
+        Seat* seat = nullptr;
+        if(seatId != -1)
+            seat = gameMap->getSeatById(seatId);
+
+        affectedTiles.push_back(tile);
+        tile->setType(tileType);
+        tile->setFullness(tileFullness);
+        if(seat != nullptr)
+            tile->claimTile(seat);
+        else
+            tile->unclaimTile();
+
+        tile->computeTileVisual();
+        changes[nbKept] = change;
+        ++nbKept;
+    }
+    changes.resize(nbKept);
+
+    if(affectedTiles.empty())
+        return;
+
+    uint32_t nbTiles = affectedTiles.size();
+    const std::vector<Seat*>& seats = gameMap->getSeats();
+    for(Seat* seat : seats)
+    {
+        if(seat->getPlayer() == nullptr)
+            continue;
+        if(!seat->getPlayer()->getIsHuman())
+            continue;
+
+        ServerNotification notif(ServerNotificationType::refreshTiles, seat->getPlayer());
+        notif.mPacket << nbTiles;
+        for(Tile* tile : affectedTiles)
+        {
+            gameMap->tileToPacket(notif.mPacket, tile);
+            seat->updateTileStateForSeat(tile, false);
+            tile->exportToPacketForUpdate(notif.mPacket, seat);
+        }
+        sendAsyncMsg(notif);
+    }
+}
+
+void ODServer::traceStateHash()
+{
+    if(!mStateHashTrace.is_open())
+        return;
+
+    mStateHashTrace << mGameMap->getTurnNumber() << " " << mGameMap->computeStateHash() << std::endl;
 }
 
 void ODServer::serverThread()
@@ -401,6 +508,17 @@ void ODServer::serverThread()
         // doTask should return after the length of 1 turn even if their are communications. When
         // it returns, we can launch next turn.
         doTask(static_cast<int32_t>(turnLengthMs));
+
+        if(mExitRequested.exchange(false))
+        {
+            mServerNotificationQueue.clear();
+            ServerNotification* exitServerNotification = createServerNotification(
+                ServerNotificationType::exit, nullptr);
+            queueServerNotification(exitServerNotification);
+            processServerNotifications();
+            continue;
+        }
+
         // If all the clients are disconnected during a game, we close the server
         if((mServerState == ServerState::StateGame) &&
            (mSockClients.empty()))
@@ -448,7 +566,7 @@ void ODServer::serverThread()
 
                 // Every client is connected and ready, we can launch the game
                 // Send turn 0 to init the map
-                ServerNotification* serverNotification = new ServerNotification(
+                ServerNotification* serverNotification = createServerNotification(
                     ServerNotificationType::turnStarted, nullptr);
                 serverNotification->mPacket << static_cast<int64_t>(0);
                 queueServerNotification(serverNotification);
@@ -510,9 +628,16 @@ void ODServer::serverThread()
         // to wait for server. If server is in advance, he might send commands before the
         // creatures arrive at their destination. That could result in weird issues like
         // creatures going through walls.
-        startNewTurn(static_cast<double>(clock.restart().asSeconds()) * 0.95);
+        double timeSinceLastTurn = static_cast<double>(clock.restart().asSeconds());
+        if(mFixedTurnLength)
+            timeSinceLastTurn = 1.0 / ODApplication::turnsPerSecond;
+
+        startNewTurn(timeSinceLastTurn * 0.95);
 
         processServerNotifications();
+
+        updateAutosave(timeSinceLastTurn);
+        processSnapshotResults();
     }
 
     if(!mMasterServerGameId.empty())
@@ -580,10 +705,11 @@ void ODServer::processServerNotifications()
                 sendMsg(event->mConcernedPlayer, event->mPacket);
                 break;
         }
-
-        delete event;
-        event = nullptr;
     }
+
+    // Every queued notification has been sent. We can reuse them
+    if (mServerNotificationQueue.empty())
+        mServerNotificationPool.recycleAll();
 }
 
 bool ODServer::processClientNotifications(ODSocketClient* clientSocket)
@@ -1336,7 +1462,7 @@ bool ODServer::processClientNotifications(ODSocketClient* clientSocket)
             if(!rooms.empty())
                 break;
 
-            ServerNotification *serverNotification = new ServerNotification(
+            ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                 ServerNotificationType::chatServer, player);
 
             std::string msg = "You need a workshop to craft the trap!";
@@ -1492,79 +1618,19 @@ bool ODServer::processClientNotifications(ODSocketClient* clientSocket)
                 std::ostringstream ss;
                 ss.imbue(loc);
                 ss << boost::posix_time::second_clock::local_time() << "-";
-                switch(mServerMode)
-                {
-                    case ServerMode::ModeGameSinglePlayer:
-                        ss << SAVEGAME_SKIRMISH_PREFIX;
-                        ss << fileLevel;
-                        break;
-                    case ServerMode::ModeGameMultiPlayer:
-                        ss << SAVEGAME_MULTIPLAYER_PREFIX;
-                        ss << fileLevel;
-                        break;
-                    case ServerMode::ModeGameLoaded:
-                    {
-                        // We look for the Skirmish or multiplayer prefix and keep it.
-                        uint32_t indexSk = fileLevel.find(SAVEGAME_SKIRMISH_PREFIX);
-                        uint32_t indexMp = fileLevel.find(SAVEGAME_MULTIPLAYER_PREFIX);
-                        if((indexSk != std::string::npos) && (indexMp == std::string::npos))
-                        {
-                            // Skirmish savegame
-                            ss << SAVEGAME_SKIRMISH_PREFIX;
-                            ss << fileLevel.substr(indexSk + SAVEGAME_SKIRMISH_PREFIX.length());
-
-                        }
-                        else if((indexSk == std::string::npos) && (indexMp != std::string::npos))
-                        {
-                            // Multiplayer savegame
-                            ss << SAVEGAME_MULTIPLAYER_PREFIX;
-                            ss << fileLevel.substr(indexMp + SAVEGAME_MULTIPLAYER_PREFIX.length());
-                        }
-                        else if((indexSk != std::string::npos) && (indexMp != std::string::npos))
-                        {
-                            // We found both prefixes. That can happen if the name contains the other
-                            // prefix. Because of filename construction, we know that the lowest is the good
-                            if(indexSk < indexMp)
-                            {
-                                ss << SAVEGAME_SKIRMISH_PREFIX;
-                                ss << fileLevel.substr(indexSk + SAVEGAME_SKIRMISH_PREFIX.length());
-                            }
-                            else
-                            {
-                                ss << SAVEGAME_MULTIPLAYER_PREFIX;
-                                ss << fileLevel.substr(indexMp + SAVEGAME_MULTIPLAYER_PREFIX.length());
-                            }
-                        }
-                        else
-                        {
-                            // We couldn't find any prefix. That's not normal
-                            OD_LOG_ERR("fileLevel=" + fileLevel);
-                            ss << fileLevel;
-                        }
-                        break;
-                    }
-                    default:
-                        OD_LOG_ERR("mode=" + Helper::toString(static_cast<int>(mServerMode)));
-                        ss << fileLevel;
-                        break;
-                }
+                ss << getSaveGameName(fileLevel);
                 std::string savePath = ResourceManager::getSingleton().getSaveGamePath() + ss.str();
                 levelSave = boost::filesystem::path(savePath);
             }
 
-            // If the file exists, we make a backup
-            if (boost::filesystem::exists(levelSave))
-                boost::filesystem::rename(levelSave, levelSave.string() + ".bak");
-
-            std::string msg = "Map saved successfully as: " + levelSave.string();
-            if (!MapHandler::writeGameMapToFile(levelSave.string(), *gameMap))
+            // The players will be notified when the file is written (see processSnapshotResults)
+            if (!saveGameSnapshot(levelSave.string(), false))
             {
-                msg = "Couldn't not save map file as: " + levelSave.string() + "\nPlease check logs.";
+                std::string msg = "Couldn't not save map file as: " + levelSave.string() + "\nPlease check logs.";
+                ServerNotification notif(ServerNotificationType::chatServer, nullptr);
+                notif.mPacket << msg << EventShortNoticeType::genericGameInfo;
+                sendAsyncMsg(notif);
             }
-            // We notify all the players that the game was saved successfully
-            ServerNotification notif(ServerNotificationType::chatServer, nullptr);
-            notif.mPacket << msg << EventShortNoticeType::genericGameInfo;
-            sendAsyncMsg(notif);
             break;
         }
 
@@ -1582,51 +1648,53 @@ bool ODServer::processClientNotifications(ODSocketClient* clientSocket)
 
             OD_ASSERT_TRUE(packetReceived >> x1 >> y1 >> x2 >> y2 >> tileType >> tileFullness >> seatId);
             std::vector<Tile*> selectedTiles = gameMap->rectangularRegion(x1, y1, x2, y2);
-            std::vector<Tile*> affectedTiles;
-            Seat* seat = nullptr;
-            if(seatId != -1)
-                seat = gameMap->getSeatById(seatId);
-
+            std::vector<TileChangeJournal::TileChange> changes;
+            changes.reserve(selectedTiles.size());
             for(Tile* tile : selectedTiles)
             {
-                // We do not change tiles where there is something
-                if((tile->numEntitiesInTile() > 0) &&
-                   ((tileFullness > 0.0) || (tileType == TileType::lava) || (tileType == TileType::water)))
-                    continue;
-                if(tile->getCoveringBuilding() != nullptr)
-                    continue;
+                TileChangeJournal::TileChange change;
+                change.mX = tile->getX();
+                change.mY = tile->getY();
+                change.mOldType = tile->getType();
+                change.mOldFullness = tile->getFullness();
+                change.mOldSeatId = tile->isClaimed() ? tile->getSeat()->getId() : -1;
+                change.mNewType = tileType;
+                change.mNewFullness = tileFullness;
+                change.mNewSeatId = seatId;
+                changes.push_back(change);
+            }
 
-                affectedTiles.push_back(tile);
-                tile->setType(tileType);
-                tile->setFullness(tileFullness);
-                if(seat != nullptr)
-                    tile->claimTile(seat);
-                else
-                    tile->unclaimTile();
+            applyEditorTileChanges(changes, true);
+            mEditorTileJournal.pushBatch(changes);
+            break;
+        }
 
-                tile->computeTileVisual();
+        case ClientNotificationType::editorAskUndoTiles:
+        case ClientNotificationType::editorAskRedoTiles:
+        {
+            if(mServerMode != ServerMode::ModeEditor)
+            {
+                OD_LOG_ERR("Received editor command while wrong mode mode" + Helper::toString(static_cast<int>(mServerMode)));
+                break;
             }
-            if(!affectedTiles.empty())
+
+            std::vector<TileChangeJournal::TileChange> changes;
+            // Only the changes that could be applied are moved to the other history. The skipped
+            // ones can be undone/redone later
+            if(clientCommand == ClientNotificationType::editorAskUndoTiles)
             {
-                uint32_t nbTiles = affectedTiles.size();
-                const std::vector<Seat*>& seats = gameMap->getSeats();
-                for(Seat* seat : seats)
+                if(mEditorTileJournal.getUndoBatch(changes))
                 {
-                    if(seat->getPlayer() == nullptr)
-                        continue;
-                    if(!seat->getPlayer()->getIsHuman())
-                        continue;
-
-                    ServerNotification notif(ServerNotificationType::refreshTiles, seat->getPlayer());
-                    notif.mPacket << nbTiles;
-                    for(Tile* tile : affectedTiles)
-                    {
-                        gameMap->tileToPacket(notif.mPacket, tile);
-                        seat->updateTileStateForSeat(tile, false);
-                        tile->exportToPacketForUpdate(notif.mPacket, seat);
-
-                    }
-                    sendAsyncMsg(notif);
+                    applyEditorTileChanges(changes, false);
+                    mEditorTileJournal.undoApplied(changes);
+                }
+            }
+            else
+            {
+                if(mEditorTileJournal.getRedoBatch(changes))
+                {
+                    applyEditorTileChanges(changes, true);
+                    mEditorTileJournal.redoApplied(changes);
                 }
             }
             break;
@@ -1882,7 +1950,7 @@ bool ODServer::notifyClientMessage(ODSocketClient *clientSocket)
                 if(!player->getIsHuman())
                     continue;
 
-                ServerNotification *serverNotification = new ServerNotification(
+                ServerNotification *serverNotification = createServerNotification(
                     ServerNotificationType::chatServer, player);
                 std::string msg = nick.empty() ?
                                   "A client disconnected." :
@@ -1911,26 +1979,33 @@ void ODServer::stopServer()
     mDisconnectedPlayers.clear();
     mPlayerConfig = nullptr;
 
-    // Now that the server is stopped, we can remove all pending messages
-    while(!mServerNotificationQueue.empty())
+    // We make sure the saves are written before leaving. Players cannot be notified anymore
+    mSnapshotWriter->waitPendingWrites();
+    MapSnapshotWriter::Result result;
+    while(mSnapshotWriter->popResult(result))
     {
-        delete mServerNotificationQueue.front();
-        mServerNotificationQueue.pop_front();
     }
+
+    // Now that the server is stopped, we can remove all pending messages
+    mServerNotificationQueue.clear();
+    mServerNotificationPool.recycleAll();
     mGameMap->clearAll();
+    mEditorTileJournal.clear();
+
+    if(mStateHashTrace.is_open())
+        mStateHashTrace.close();
 }
 
 void ODServer::notifyExit()
 {
-    while(!mServerNotificationQueue.empty())
-    {
-        delete mServerNotificationQueue.front();
-        mServerNotificationQueue.pop_front();
-    }
+    // This is called by the rendering thread. The notification pool and queue can only be used
+    // by the server thread
+    mExitRequested = true;
+}
 
-    ServerNotification* exitServerNotification = new ServerNotification(
-        ServerNotificationType::exit, nullptr);
-    queueServerNotification(exitServerNotification);
+void ODServer::logServerNotificationPoolStats() const
+{
+    mServerNotificationPool.logStats();
 }
 
 ODSocketClient* ODServer::getClientFromPlayer(Player* player)
@@ -2023,6 +2098,123 @@ int32_t ODServer::getNetworkPort() const
     return ConfigManager::getSingleton().getNetworkPort();
 }
 
+std::string ODServer::getSaveGameName(const std::string& fileLevel) const
+{
+    switch(mServerMode)
+    {
+        case ServerMode::ModeGameSinglePlayer:
+            return SAVEGAME_SKIRMISH_PREFIX + fileLevel;
+        case ServerMode::ModeGameMultiPlayer:
+            return SAVEGAME_MULTIPLAYER_PREFIX + fileLevel;
+        case ServerMode::ModeGameLoaded:
+        {
+            // We look for the Skirmish or multiplayer prefix and keep it.
+            uint32_t indexSk = fileLevel.find(SAVEGAME_SKIRMISH_PREFIX);
+            uint32_t indexMp = fileLevel.find(SAVEGAME_MULTIPLAYER_PREFIX);
+            if((indexSk != std::string::npos) && (indexMp == std::string::npos))
+            {
+                // Skirmish savegame
+                return SAVEGAME_SKIRMISH_PREFIX + fileLevel.substr(indexSk + SAVEGAME_SKIRMISH_PREFIX.length());
+            }
+            else if((indexSk == std::string::npos) && (indexMp != std::string::npos))
+            {
+                // Multiplayer savegame
+                return SAVEGAME_MULTIPLAYER_PREFIX + fileLevel.substr(indexMp + SAVEGAME_MULTIPLAYER_PREFIX.length());
+            }
+            else if((indexSk != std::string::npos) && (indexMp != std::string::npos))
+            {
+                // We found both prefixes. That can happen if the name contains the other
+                // prefix. Because of filename construction, we know that the lowest is the good
+                if(indexSk < indexMp)
+                    return SAVEGAME_SKIRMISH_PREFIX + fileLevel.substr(indexSk + SAVEGAME_SKIRMISH_PREFIX.length());
+                else
+                    return SAVEGAME_MULTIPLAYER_PREFIX + fileLevel.substr(indexMp + SAVEGAME_MULTIPLAYER_PREFIX.length());
+            }
+
+            // We couldn't find any prefix. That's not normal
+            OD_LOG_ERR("fileLevel=" + fileLevel);
+            return fileLevel;
+        }
+        default:
+            OD_LOG_ERR("mode=" + Helper::toString(static_cast<int>(mServerMode)));
+            return fileLevel;
+    }
+}
+
+bool ODServer::saveGameSnapshot(const std::string& fileName, bool isAutosave)
+{
+    // This is called between 2 turns so the gamemap is in a consistent state. We only serialize
+    // it in memory here. The file will be written by the snapshot writer thread
+    sf::Clock clock;
+    std::ostringstream snapshot;
+    MapHandler::writeGameMapToStream(snapshot, *mGameMap);
+    if(!snapshot.good())
+    {
+        OD_LOG_WRN("Couldn't take snapshot for file=" + fileName);
+        return false;
+    }
+
+    std::string data = snapshot.str();
+    OD_LOG_INF("Snapshot taken for file=" + fileName + ", size=" + Helper::toString(static_cast<uint64_t>(data.size()))
+        + ", snapshotTimeMs=" + Helper::toString(static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0));
+    mSnapshotWriter->queueSnapshot(fileName, data, isAutosave);
+    return true;
+}
+
+void ODServer::updateAutosave(double timeSinceLastTurn)
+{
+    int32_t autosavePeriod = ResourceManager::getSingleton().getAutosavePeriodSeconds();
+    if(autosavePeriod <= 0)
+        return;
+
+    // In editor mode, saving overwrites the edited level. We only autosave games
+    switch(mServerMode)
+    {
+        case ServerMode::ModeGameSinglePlayer:
+        case ServerMode::ModeGameMultiPlayer:
+        case ServerMode::ModeGameLoaded:
+            break;
+        default:
+            return;
+    }
+
+    mAutosaveElapsedTime += timeSinceLastTurn;
+    if(mAutosaveElapsedTime < static_cast<double>(autosavePeriod))
+        return;
+
+    // If the previous save is still being written, we wait for it
+    if(mSnapshotWriter->hasPendingWrites())
+        return;
+
+    mAutosaveElapsedTime = 0.0;
+    const boost::filesystem::path levelPath(mGameMap->getLevelFileName());
+    std::string fileLevel = levelPath.filename().string();
+    std::string savePath = ResourceManager::getSingleton().getSaveGamePath() + AUTOSAVE_PREFIX + getSaveGameName(fileLevel);
+    saveGameSnapshot(savePath, true);
+}
+
+void ODServer::processSnapshotResults()
+{
+    MapSnapshotWriter::Result result;
+    while(mSnapshotWriter->popResult(result))
+    {
+        // Players are only notified about autosave failures
+        if(result.mIsAutosave && result.mSuccess)
+            continue;
+
+        std::string msg;
+        if(result.mSuccess)
+            msg = "Map saved successfully as: " + result.mFileName;
+        else
+            msg = "Couldn't not save map file as: " + result.mFileName + "\nPlease check logs.";
+
+        // We notify all the players that the game was saved
+        ServerNotification notif(ServerNotificationType::chatServer, nullptr);
+        notif.mPacket << msg << EventShortNoticeType::genericGameInfo;
+        sendAsyncMsg(notif);
+    }
+}
+
 void ODServer::printConsoleMsg(const std::string& text)
 {
     OD_LOG_INF("Console:" + text);
@@ -20,13 +20,21 @@
 
 #include "ODSocketServer.h"
 #include "modes/ConsoleInterface.h"
+#include "gamemap/TileChangeJournal.h"
+#include "network/ServerNotificationPool.h"
 
 #include <OgreSingleton.h>
 
+#include <atomic>
+#include <fstream>
+#include <memory>
+
 class ServerNotification;
 class GameMap;
+class MapSnapshotWriter;
 
 enum class ServerMode;
+enum class ServerNotificationType;
 
 //! \brief An enum used to know what kind of game event it is.
 enum class EventShortNoticeType : int32_t
@@ -77,6 +85,10 @@ class ODServer: public Ogre::Singleton<ODServer>,
     bool startServer(const std::string& creator, const std::string& levelFilename, ServerMode mode, bool useMasterServer);
     void stopServer();
 
+    //! \brief Returns a new server notification for the concerned player. It is owned by the server: it should be
+    //! queued with queueServerNotification and never deleted
+    ServerNotification* createServerNotification(ServerNotificationType type, Player* concernedPlayer);
+
     //! \brief Adds a server notification to the server notification queue. The message will be sent to the concerned player
     void queueServerNotification(ServerNotification* n);
 
@@ -86,8 +98,13 @@ class ODServer: public Ogre::Singleton<ODServer>,
     //! for messages that need to show reactivity (after a player does something like building a room or tried to pickup a creature).
     void sendAsyncMsg(ServerNotification& notif);
 
+    //! \brief Asks the server to stop. It can be called from any thread: the exit notification
+    //! is created by the server thread
     void notifyExit();
 
+    //! \brief Logs how many server notifications are allocated and used
+    void logServerNotificationPoolStats() const;
+
     //! This function will block the calling thread until the game is launched and
     //! all the clients disconnect. Then, it will return true if everything went well
     //! and false if there is an error (server not launched or system error)
@@ -112,6 +129,10 @@ private:
 
     std::deque<ServerNotification*> mServerNotificationQueue;
 
+    //! \brief Notifications created with createServerNotification. They are recycled
+    //! once the queue has been processed
+    ServerNotificationPool mServerNotificationPool;
+
     std::map<ODSocketClient*, std::vector<std::string>> mCreaturesInfoWanted;
 
     ConsoleInterface mConsoleInterface;
@@ -119,6 +140,25 @@ private:
     std::string mMasterServerGameId;
     double mMasterServerGameStatusUpdateTime;
 
+    //! \brief Writes the saved games without blocking the server thread
+    std::unique_ptr<MapSnapshotWriter> mSnapshotWriter;
+
+    //! \brief Time (in seconds) since the last autosave
+    double mAutosaveElapsedTime;
+
+    //! \brief File where the state hash of each turn is written (see --statehashtrace). Not opened if disabled
+    std::ofstream mStateHashTrace;
+
+    //! \brief If true, each turn advances the game by 1 / turnsPerSecond seconds whatever the real time
+    //! elapsed. Set when the game should be reproducible (--seed or --statehashtrace)
+    bool mFixedTurnLength;
+
+    //! \brief Tiles changes done in the editor that can be undone/redone
+    TileChangeJournal mEditorTileJournal;
+
+    //! \brief Set by notifyExit. The server thread queues the exit notification when it sees it
+    std::atomic<bool> mExitRequested;
+
     void printConsoleMsg(const std::string& text);
 
     ODSocketClient* getClientFromPlayer(Player* player);
@@ -150,6 +190,28 @@ private:
 
     void fireSeatConfigurationRefresh();
 
+    //! \brief Returns the saved game file name (without the date) for the given level file name
+    std::string getSaveGameName(const std::string& fileLevel) const;
+
+    //! \brief Takes a snapshot of the gamemap and queues it to be written in the given file.
+    //! Returns false if the snapshot could not be taken
+    bool saveGameSnapshot(const std::string& fileName, bool isAutosave);
+
+    //! \brief Saves the game if the autosave is enabled and its period is elapsed
+    void updateAutosave(double timeSinceLastTurn);
+
+    //! \brief Applies the given editor tiles changes (old values if useNewValues is false) and
+    //! sends one refresh per human seat for all the changed tiles. Tiles that cannot be changed
+    //! (covered by a building or containing entities that would be buried) are skipped and removed
+    //! from changes
+    void applyEditorTileChanges(std::vector<TileChangeJournal::TileChange>& changes, bool useNewValues);
+
+    //! \brief Writes the state hash of the current turn in the trace file if it is enabled
+    void traceStateHash();
+
+    //! \brief Notifies the players about the saves written since the last call
+    void processSnapshotResults();
+
     //! \brief Handles console command. player is the player that launched the command
     void handleConsoleCommand(Player* player, GameMap* gameMap, const std::vector<std::string>& args);
 };
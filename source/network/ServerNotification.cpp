@@ -28,6 +28,14 @@ ServerNotification::ServerNotification(ServerNotificationType type,
     mPacket << type;
 }
 
+void ServerNotification::reset(ServerNotificationType type, Player* concernedPlayer)
+{
+    mType = type;
+    mConcernedPlayer = concernedPlayer;
+    mPacket.clear();
+    mPacket << type;
+}
+
 std::string ServerNotification::typeString(ServerNotificationType type)
 {
     switch(type)
@@ -96,6 +96,7 @@ ODPacket& operator>>(ODPacket& is, ServerNotificationType& nt);
 class ServerNotification
 {
     friend class ODServer;
+    friend class ServerNotificationPool;
 
     public:
         /*! \brief Creates a message to be sent to concernedPlayer. If concernedPlayer is null, the message will be sent to
@@ -110,6 +111,9 @@ class ServerNotification
         static std::string typeString(ServerNotificationType type);
 
     private:
+        //! \brief Called by ServerNotificationPool to reuse the notification (and its packet buffer)
+        void reset(ServerNotificationType type, Player* concernedPlayer);
+
         ServerNotificationType mType;
         Player *mConcernedPlayer;
 };
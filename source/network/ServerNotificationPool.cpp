@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "network/ServerNotificationPool.h"
+
+#include "network/ServerNotification.h"
+#include "utils/Helper.h"
+#include "utils/LogManager.h"
+#include "utils/MakeUnique.h"
+
+ServerNotificationPool::ServerNotificationPool() :
+    mNbUsed(0),
+    mNbUsedLastRecycle(0),
+    mNbAcquired(0),
+    mNbRecycles(0)
+{
+}
+
+ServerNotificationPool::~ServerNotificationPool()
+{
+}
+
+ServerNotification* ServerNotificationPool::acquire(ServerNotificationType type, Player* concernedPlayer)
+{
+    ++mNbAcquired;
+    if(mNbUsed < mNotifications.size())
+    {
+        ServerNotification* notification = mNotifications[mNbUsed].get();
+        ++mNbUsed;
+        notification->reset(type, concernedPlayer);
+        return notification;
+    }
+
+    mNotifications.emplace_back(Utils::make_unique<ServerNotification>(type, concernedPlayer));
+    ++mNbUsed;
+    return mNotifications.back().get();
+}
+
+void ServerNotificationPool::recycleAll()
+{
+    if(mNbUsed == 0)
+        return;
+
+    ++mNbRecycles;
+    mNbUsedLastRecycle = mNbUsed;
+    mNbUsed = 0;
+}
+
+void ServerNotificationPool::logStats() const
+{
+    uint64_t average = (mNbRecycles > 0) ? mNbAcquired / mNbRecycles : 0;
+    OD_LOG_INF("Server notification pool stats: highWater=" + Helper::toString(static_cast<uint32_t>(mNotifications.size()))
+        + ", used=" + Helper::toString(mNbUsed)
+        + ", usedLastRecycle=" + Helper::toString(mNbUsedLastRecycle)
+        + ", acquired=" + Helper::toString(mNbAcquired)
+        + ", recycles=" + Helper::toString(mNbRecycles)
+        + ", averagePerRecycle=" + Helper::toString(average));
+}
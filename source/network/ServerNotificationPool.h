@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SERVERNOTIFICATIONPOOL_H
+#define SERVERNOTIFICATIONPOOL_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Player;
+class ServerNotification;
+
+enum class ServerNotificationType;
+
+//! \brief Pool of the notifications queued by the server. Notifications are never
+//! deleted individually: they are all recycled at once when the server notification
+//! queue has been processed. Recycled notifications keep their packet buffer so that
+//! the next ones do not need to allocate memory.
+//! Note that the pool should only be used from the server thread.
+class ServerNotificationPool
+{
+public:
+    ServerNotificationPool();
+    ~ServerNotificationPool();
+
+    //! \brief Returns an empty notification of the given type for the given player. It
+    //! remains valid until the next call to recycleAll
+    ServerNotification* acquire(ServerNotificationType type, Player* concernedPlayer);
+
+    //! \brief Makes every acquired notification available again. This should only be
+    //! called when none of them is used anymore
+    void recycleAll();
+
+    //! \brief Logs the pool statistics
+    void logStats() const;
+
+private:
+    ServerNotificationPool(const ServerNotificationPool&) = delete;
+    ServerNotificationPool& operator=(const ServerNotificationPool&) = delete;
+
+    //! \brief Every notification allocated by the pool. The first mNbUsed ones are in use.
+    //! Since notifications are only allocated when every other one is used, its size is
+    //! the maximum number of notifications used at the same time
+    std::vector<std::unique_ptr<ServerNotification>> mNotifications;
+    uint32_t mNbUsed;
+
+    //! \brief Number of notifications used when recycleAll was last called
+    uint32_t mNbUsedLastRecycle;
+    //! \brief Number of notifications acquired since the pool has been created
+    uint64_t mNbAcquired;
+    //! \brief Number of times the notifications have been recycled
+    uint64_t mNbRecycles;
+};
+
+#endif // SERVERNOTIFICATIONPOOL_H
@@ -25,6 +25,7 @@
 #include "game/Player.h"
 #include "game/Seat.h"
 #include "gamemap/GameMap.h"
+#include "goals/Goal.h"
 #include "modes/InputCommand.h"
 #include "modes/InputManager.h"
 #include "network/ODClient.h"
@@ -35,11 +36,16 @@
 #include "utils/ConfigManager.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 
 #include <istream>
 #include <ostream>
 
+//! \brief Flags used in the room tiles bitmap by updateActiveSpots. The spot flags are shifted
+//! according to the ActiveSpotPlace
+static const uint16_t FLAG_CENTER = 0x0002;
+static const uint16_t FLAG_ORIGINAL_SPOT = 0x0004;
+static const uint16_t FLAG_NEW_SPOT = 0x0008;
+
 Room::Room(GameMap* gameMap):
     Building(gameMap),
     mNumActiveSpots(0)
@@ -66,12 +72,16 @@ void Room::addToGameMap()
 {
     getGameMap()->addRoom(this);
     getGameMap()->addActiveObject(this);
+    if(getGameMap()->isServerGameMap())
+        getSeat()->getRoomAvailabilityIndex().addRoom(*this);
 }
 
 void Room::removeFromGameMap()
 {
     fireEntityRemoveFromGameMap();
     getGameMap()->removeRoom(this);
+    if(getGameMap()->isServerGameMap())
+        getSeat()->getRoomAvailabilityIndex().removeRoom(*this);
     setIsOnMap(false);
     for(Seat* seat : getGameMap()->getSeats())
     {
@@ -143,7 +153,7 @@ void Room::handleCreatureUsingAbsorbedRoom(Creature& creature)
     // will do something else
     creature.clearDestinations(EntityAnimation::idle_anim, true, true);
     creature.clearActionQueue();
-    creature.pushAction(Utils::make_unique<CreatureActionSearchJob>(creature, true));
+    creature.pushAction<CreatureActionSearchJob>(creature, true);
 }
 
 void Room::reorderRoomTiles(std::vector<Tile*>& tiles)
@@ -159,6 +169,7 @@ bool Room::addCreatureUsingRoom(Creature* c)
         return false;
 
     mCreaturesUsingRoom.push_back(c);
+    fireRoomAvailabilityChanged();
     return true;
 }
 
@@ -172,6 +183,18 @@ void Room::removeCreatureUsingRoom(Creature *c)
             break;
         }
     }
+    fireRoomAvailabilityChanged();
+}
+
+void Room::fireRoomAvailabilityChanged()
+{
+    if(!getGameMap()->isServerGameMap())
+        return;
+
+    if(getSeat() == nullptr)
+        return;
+
+    getSeat()->getRoomAvailabilityIndex().notifyRoomChanged(*this);
 }
 
 Creature* Room::getCreatureUsingRoom(unsigned index)
@@ -187,6 +210,18 @@ std::string Room::getRoomStreamFormat()
     return "typeRoom\tname\tseatId\tnumTiles\t\tSubsequent Lines: tileX\ttileY";
 }
 
+void Room::changeSeat(Seat* seat)
+{
+    getSeat()->getRoomAvailabilityIndex().removeRoom(*this);
+    setSeat(seat);
+    seat->getRoomAvailabilityIndex().addRoom(*this);
+    getGameMap()->notifyGoalStateChanged(GoalDependency::rooms);
+
+    // Whether the covered tiles can be claimed depends on the room seat
+    for(Tile* tile : mCoveredTiles)
+        tile->fireClaimableStateChanged();
+}
+
 void Room::setupRoom(const std::string& name, Seat* seat, const std::vector<Tile*>& tiles)
 {
     setIsOnMap(true);
@@ -225,7 +260,10 @@ void Room::checkForRoomAbsorbtion()
     }
 
     if(isRoomAbsorbed)
+    {
         reorderRoomTiles(mCoveredTiles);
+        fireRoomAvailabilityChanged();
+    }
 }
 
 void Room::updateActiveSpots()
@@ -236,197 +274,63 @@ void Room::updateActiveSpots()
     std::vector<Tile*> topWallsActiveSpotTiles;
     std::vector<Tile*> bottomWallsActiveSpotTiles;
 
-    // Detect the centers of 3x3 squares tiles
-    for(unsigned int i = 0, size = mCoveredTiles.size(); i < size; ++i)
-    {
-        bool foundTop = false;
-        bool foundTopLeft = false;
-        bool foundTopRight = false;
-        bool foundLeft = false;
-        bool foundRight = false;
-        bool foundBottomLeft = false;
-        bool foundBottomRight = false;
-        bool foundBottom = false;
-        Tile* tile = mCoveredTiles[i];
-        int tileX = tile->getX();
-        int tileY = tile->getY();
-
-        // Check all other tiles to know whether we have one center tile.
-        for(unsigned int j = 0; j < size; ++j)
-        {
-            // Don't check the tile itself
-            if (tile == mCoveredTiles[j])
-                continue;
+    mTilesBitmap.reset(mCoveredTiles);
 
-            // Check whether the tile around the tile checked is already a center spot
-            // as we can't have two center spots next to one another.
-            if (std::find(centralActiveSpotTiles.begin(), centralActiveSpotTiles.end(), mCoveredTiles[j]) != centralActiveSpotTiles.end())
-                continue;
-
-            int tile2X = mCoveredTiles[j]->getX();
-            int tile2Y = mCoveredTiles[j]->getY();
-
-            if(tile2X == tileX - 1)
-            {
-                if (tile2Y == tileY + 1)
-                    foundTopLeft = true;
-                else if (tile2Y == tileY)
-                    foundLeft = true;
-                else if (tile2Y == tileY - 1)
-                    foundBottomLeft = true;
-            }
-            else if(tile2X == tileX)
-            {
-                if (tile2Y == tileY + 1)
-                    foundTop = true;
-                else if (tile2Y == tileY - 1)
-                    foundBottom = true;
-            }
-            else if(tile2X == tileX + 1)
-            {
-                if (tile2Y == tileY + 1)
-                    foundTopRight = true;
-                else if (tile2Y == tileY)
-                    foundRight = true;
-                else if (tile2Y == tileY - 1)
-                    foundBottomRight = true;
-            }
-        }
+    // Detect the centers of 3x3 squares tiles. We can't have two center spots next to one another
+    for(Tile* tile : mCoveredTiles)
+    {
+        uint8_t neighbours = mTilesBitmap.getNeighboursMask(tile->getX(), tile->getY(),
+            RoomTilesBitmap::FLAG_COVERED, FLAG_CENTER);
+        if(neighbours != RoomTilesBitmap::ALL_NEIGHBOURS)
+            continue;
 
-        // Check whether we found a tile at the center of others
-        if (foundTop && foundTopLeft && foundTopRight && foundLeft && foundRight
-                && foundBottomLeft && foundBottomRight && foundBottom)
-        {
-            centralActiveSpotTiles.push_back(tile);
-        }
+        mTilesBitmap.addFlags(tile->getX(), tile->getY(), FLAG_CENTER);
+        centralActiveSpotTiles.push_back(tile);
     }
 
     // Now that we've got the center tiles, we can test the tile around for walls.
-    for (unsigned int i = 0, size = centralActiveSpotTiles.size(); i < size; ++i)
+    struct WallDirection
     {
-        Tile* centerTile = centralActiveSpotTiles[i];
-        if (centerTile == nullptr)
-            continue;
-
-        // Test for walls around
-        // Up
-        Tile* testTile;
-        testTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() + 2);
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
-        {
-            Tile* topTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() + 1);
-            if (topTile != nullptr)
-                topWallsActiveSpotTiles.push_back(topTile);
-        }
-        // Up for 4 tiles wide room
-        testTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() + 3);
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
-        {
-            bool isFound = true;
-            for(int k = 0; k < 3; ++k)
-            {
-                Tile* testTile2 = getGameMap()->getTile(centerTile->getX() + k - 1, centerTile->getY() + 2);
-                if((testTile2 == nullptr) || (testTile2->getCoveringBuilding() != this))
-                {
-                    isFound = false;
-                    break;
-                }
-            }
-
-            if(isFound)
-            {
-                Tile* topTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() + 2);
-                topWallsActiveSpotTiles.push_back(topTile);
-            }
-        }
-
-        // Down
-        testTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() - 2);
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
-        {
-            Tile* bottomTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() - 1);
-            if (bottomTile != nullptr)
-                bottomWallsActiveSpotTiles.push_back(bottomTile);
-        }
-        // Down for 4 tiles wide room
-        testTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() - 3);
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
-        {
-            bool isFound = true;
-            for(int k = 0; k < 3; ++k)
-            {
-                Tile* testTile2 = getGameMap()->getTile(centerTile->getX() + k - 1, centerTile->getY() - 2);
-                if((testTile2 == nullptr) || (testTile2->getCoveringBuilding() != this))
-                {
-                    isFound = false;
-                    break;
-                }
-            }
-
-            if(isFound)
-            {
-                Tile* topTile = getGameMap()->getTile(centerTile->getX(), centerTile->getY() - 2);
-                bottomWallsActiveSpotTiles.push_back(topTile);
-            }
-        }
-
-        // Left
-        testTile = getGameMap()->getTile(centerTile->getX() - 2, centerTile->getY());
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
-        {
-            Tile* leftTile = getGameMap()->getTile(centerTile->getX() - 1, centerTile->getY());
-            if (leftTile != nullptr)
-                leftWallsActiveSpotTiles.push_back(leftTile);
-        }
-        // Left for 4 tiles wide room
-        testTile = getGameMap()->getTile(centerTile->getX() - 3, centerTile->getY());
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
+        int32_t mDirX;
+        int32_t mDirY;
+        std::vector<Tile*>& mSpotTiles;
+    };
+    WallDirection directions[4] =
+    {
+        {0, 1, topWallsActiveSpotTiles},
+        {0, -1, bottomWallsActiveSpotTiles},
+        {-1, 0, leftWallsActiveSpotTiles},
+        {1, 0, rightWallsActiveSpotTiles}
+    };
+    for(Tile* centerTile : centralActiveSpotTiles)
+    {
+        int32_t x = centerTile->getX();
+        int32_t y = centerTile->getY();
+        for(WallDirection& dir : directions)
         {
-            bool isFound = true;
-            for(int k = 0; k < 3; ++k)
+            // Wall next to the 3x3 square
+            Tile* testTile = getGameMap()->getTile(x + 2 * dir.mDirX, y + 2 * dir.mDirY);
+            if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
             {
-                Tile* testTile2 = getGameMap()->getTile(centerTile->getX() - 2, centerTile->getY() + k - 1);
-                if((testTile2 == nullptr) || (testTile2->getCoveringBuilding() != this))
-                {
-                    isFound = false;
-                    break;
-                }
+                Tile* spotTile = getGameMap()->getTile(x + dir.mDirX, y + dir.mDirY);
+                if (spotTile != nullptr)
+                    dir.mSpotTiles.push_back(spotTile);
             }
 
-            if(isFound)
-            {
-                Tile* topTile = getGameMap()->getTile(centerTile->getX() - 2, centerTile->getY());
-                leftWallsActiveSpotTiles.push_back(topTile);
-            }
-        }
-
-        // Right
-        testTile = getGameMap()->getTile(centerTile->getX() + 2, centerTile->getY());
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
-        {
-            Tile* rightTile = getGameMap()->getTile(centerTile->getX() + 1, centerTile->getY());
-            if (rightTile != nullptr)
-                rightWallsActiveSpotTiles.push_back(rightTile);
-        }
-        // Right for 4 tiles wide room
-        testTile = getGameMap()->getTile(centerTile->getX() + 3, centerTile->getY());
-        if (testTile != nullptr && testTile->isWallClaimedForSeat(getSeat()))
-        {
-            bool isFound = true;
-            for(int k = 0; k < 3; ++k)
-            {
-                Tile* testTile2 = getGameMap()->getTile(centerTile->getX() + 2, centerTile->getY() + k - 1);
-                if((testTile2 == nullptr) || (testTile2->getCoveringBuilding() != this))
-                {
-                    isFound = false;
-                    break;
-                }
-            }
+            // Wall for 4 tiles wide room. The 3 tiles between the square and the wall should be in the room
+            testTile = getGameMap()->getTile(x + 3 * dir.mDirX, y + 3 * dir.mDirY);
+            if (testTile == nullptr || !testTile->isWallClaimedForSeat(getSeat()))
+                continue;
 
-            if(isFound)
+            int32_t rowX = x + 2 * dir.mDirX;
+            int32_t rowY = y + 2 * dir.mDirY;
+            int32_t stepX = (dir.mDirX == 0) ? 1 : 0;
+            int32_t stepY = (dir.mDirY == 0) ? 1 : 0;
+            if(mTilesBitmap.hasFlags(rowX - stepX, rowY - stepY, RoomTilesBitmap::FLAG_COVERED) &&
+               mTilesBitmap.hasFlags(rowX, rowY, RoomTilesBitmap::FLAG_COVERED) &&
+               mTilesBitmap.hasFlags(rowX + stepX, rowY + stepY, RoomTilesBitmap::FLAG_COVERED))
             {
-                Tile* topTile = getGameMap()->getTile(centerTile->getX() + 2, centerTile->getY());
-                rightWallsActiveSpotTiles.push_back(topTile);
+                dir.mSpotTiles.push_back(getGameMap()->getTile(rowX, rowY));
             }
         }
     }
@@ -447,16 +351,26 @@ void Room::updateActiveSpots()
     mNumActiveSpots = mCentralActiveSpotTiles.size()
                       + mLeftWallsActiveSpotTiles.size() + mRightWallsActiveSpotTiles.size()
                       + mTopWallsActiveSpotTiles.size() + mBottomWallsActiveSpotTiles.size();
+
+    fireRoomAvailabilityChanged();
 }
 
 void Room::activeSpotCheckChange(ActiveSpotPlace place, const std::vector<Tile*>& originalSpotTiles,
     const std::vector<Tile*>& newSpotTiles)
 {
+    // We flag the spots in the bitmap built by updateActiveSpots to compare both lists in linear time.
+    // Original spots outside of the bitmap are not covered by the room anymore so they are not new spots
+    uint16_t originalFlag = static_cast<uint16_t>(FLAG_ORIGINAL_SPOT << (2 * place));
+    uint16_t newFlag = static_cast<uint16_t>(FLAG_NEW_SPOT << (2 * place));
+    for(Tile* tile : originalSpotTiles)
+        mTilesBitmap.addFlags(tile->getX(), tile->getY(), originalFlag);
+    for(Tile* tile : newSpotTiles)
+        mTilesBitmap.addFlags(tile->getX(), tile->getY(), newFlag);
+
     // We create the non existing tiles
-    for(std::vector<Tile*>::const_iterator it = newSpotTiles.begin(); it != newSpotTiles.end(); ++it)
+    for(Tile* tile : newSpotTiles)
     {
-        Tile* tile = *it;
-        if(std::find(originalSpotTiles.begin(), originalSpotTiles.end(), tile) == originalSpotTiles.end())
+        if(!mTilesBitmap.hasFlags(tile->getX(), tile->getY(), originalFlag))
         {
             // The tile do not exist
             BuildingObject* ro = notifyActiveSpotCreated(place, tile);
@@ -469,10 +383,9 @@ void Room::activeSpotCheckChange(ActiveSpotPlace place, const std::vector<Tile*>
         }
     }
     // We remove the suppressed tiles
-    for(std::vector<Tile*>::const_iterator it = originalSpotTiles.begin(); it != originalSpotTiles.end(); ++it)
+    for(Tile* tile : originalSpotTiles)
     {
-        Tile* tile = *it;
-        if(std::find(newSpotTiles.begin(), newSpotTiles.end(), tile) == newSpotTiles.end())
+        if(!mTilesBitmap.hasFlags(tile->getX(), tile->getY(), newFlag))
         {
             // The tile has been removed
             notifyActiveSpotRemoved(place, tile);
@@ -589,7 +502,7 @@ void Room::restoreInitialEntityState()
         if(!p.first->getPlayer()->getIsHuman())
             continue;
 
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::refreshTiles, p.first->getPlayer());
         std::vector<Tile*>& tilesRefresh = p.second;
         uint32_t nbTiles = tilesRefresh.size();
@@ -701,7 +614,7 @@ void Room::fireRoomSound(Tile& tile, const std::string& soundFamily)
         if(!seat->getPlayer()->getIsHuman())
             continue;
 
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::playSpatialSound, seat->getPlayer());
         serverNotification->mPacket << sound << tile.getX() << tile.getY();
         ODServer::getSingleton().queueServerNotification(serverNotification);
@@ -715,5 +628,5 @@ bool Room::importRoomFromStream(Room& room, std::istream& is)
 
 void Room::creatureDropped(Creature& creature)
 {
-    creature.pushAction(Utils::make_unique<CreatureActionSearchJob>(creature, true));
+    creature.pushAction<CreatureActionSearchJob>(creature, true);
 }
@@ -19,6 +19,7 @@
 #define ROOM_H
 
 #include "entities/Building.h"
+#include "rooms/RoomTilesBitmap.h"
 
 #include <string>
 #include <iosfwd>
@@ -68,6 +69,10 @@ public:
     virtual void removeCreatureUsingRoom(Creature* c);
     virtual Creature* getCreatureUsingRoom(unsigned index);
     virtual bool hasOpenCreatureSpot(Creature* c) { return false; }
+    //! \brief Returns false if no creature can use this room right now whatever the creature. Used to
+    //! index the available rooms (see RoomAvailabilityIndex). If true is returned, hasOpenCreatureSpot
+    //! should be called to know if a given creature can use the room
+    virtual bool mayHaveOpenCreatureSpot() const { return false; }
 
     //! \brief Called by the creature during its upkeep when using the room when it is ready
     //! to do something (no cooldown or no other action).
@@ -136,6 +141,10 @@ public:
 protected:
     static void fireRoomSound(Tile& tile, const std::string& soundFamily);
 
+    //! \brief Gives the room to the given seat when it is claimed. Goals depending on rooms
+    //! are notified because they may check who owns the room (portals, temples, ...)
+    void changeSeat(Seat* seat);
+
     /*! \brief Exports the headers needed to recreate the Room. It allows to extend Room as much as wanted.
      * The content of the Room will be exported by exportToPacket.
      */
@@ -166,9 +175,15 @@ protected:
     virtual BuildingObject* notifyActiveSpotCreated(ActiveSpotPlace place, Tile* tile);
     virtual void notifyActiveSpotRemoved(ActiveSpotPlace place, Tile* tile);
 
+    //! \brief Notifies the seat room index that the availability of this room may have changed (server side only)
+    void fireRoomAvailabilityChanged();
+
     //! \brief This function will be called when reordering room is needed (for example if another room has been absorbed)
     static void reorderRoomTiles(std::vector<Tile*>& tiles);
 private :
+    //! \brief Covered tiles and active spots flags. Rebuilt by updateActiveSpots
+    RoomTilesBitmap mTilesBitmap;
+
     void activeSpotCheckChange(ActiveSpotPlace place, const std::vector<Tile*>& originalSpotTiles,
         const std::vector<Tile*>& newSpotTiles);
 
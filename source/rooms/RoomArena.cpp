@@ -27,10 +27,13 @@
 #include "gamemap/Pathfinding.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> ARENA_COST_PER_TILE(ConfigParamCategory::rooms, "ArenaCostPerTile");
+static ConfigParam<uint32_t> ARENA_MAX_TRAINING_LEVEL(ConfigParamCategory::rooms, "ArenaMaxTrainingLevel");
+
 const std::string RoomArenaName = "Arena";
 const std::string RoomArenaNameDisplay = "Arena room";
 const RoomType RoomArena::mRoomType = RoomType::arena;
@@ -49,7 +52,7 @@ class RoomArenaFactory : public RoomFactory
     { return RoomArenaNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("ArenaCostPerTile"); }
+    { return ARENA_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -137,12 +140,17 @@ bool RoomArena::hasOpenCreatureSpot(Creature* c)
         return false;
 
     // We allow using arena only if level is not too high
-    if (c->getLevel() >= ConfigManager::getSingleton().getRoomConfigUInt32("ArenaMaxTrainingLevel"))
+    if (c->getLevel() >= ARENA_MAX_TRAINING_LEVEL.get())
         return false;
 
     return true;
 }
 
+bool RoomArena::mayHaveOpenCreatureSpot() const
+{
+    return mCreaturesFighting.size() < mCentralActiveSpotTiles.size();
+}
+
 bool RoomArena::addCreatureUsingRoom(Creature* creature)
 {
     if(!Room::addCreatureUsingRoom(creature))
@@ -235,7 +243,7 @@ void RoomArena::doUpkeep()
         }
 
         // We don't notify player fight when in the arena
-        creature->pushAction(Utils::make_unique<CreatureActionFightFriendly>(*creature, closestOpponent, true, getCoveredTiles(), false));
+        creature->pushAction<CreatureActionFightFriendly>(*creature, closestOpponent, true, getCoveredTiles(), false);
     }
 }
 
@@ -345,6 +353,7 @@ bool RoomArena::notifyDead(GameEntity* entity)
             continue;
 
         mCreaturesFighting.erase(it);
+        fireRoomAvailabilityChanged();
         return false;
     }
     return true;
@@ -359,6 +368,7 @@ bool RoomArena::notifyRemovedFromGameMap(GameEntity* entity)
             continue;
 
         mCreaturesFighting.erase(it);
+        fireRoomAvailabilityChanged();
         return false;
     }
     return true;
@@ -373,6 +383,7 @@ bool RoomArena::notifyPickedUp(GameEntity* entity)
             continue;
 
         mCreaturesFighting.erase(it);
+        fireRoomAvailabilityChanged();
         return false;
     }
     return true;
@@ -34,6 +34,7 @@ public:
 
     void absorbRoom(Room *r) override;
     bool hasOpenCreatureSpot(Creature* c) override;
+    bool mayHaveOpenCreatureSpot() const override;
     bool addCreatureUsingRoom(Creature* c) override;
     void removeCreatureUsingRoom(Creature* c) override;
     void doUpkeep() override;
@@ -351,7 +351,7 @@ void RoomBridge::claimForSeat(Seat* seat, Tile* tile, double danceRate)
 
     OD_LOG_INF("Bridge=" + getName() + " claimed by seat id=" + Helper::toString(seat->getId()));
     mClaimedValue = static_cast<double>(numCoveredTiles());
-    setSeat(seat);
+    changeSeat(seat);
 
     for(Tile* tile : mCoveredTiles)
         tile->claimTile(seat);
@@ -25,9 +25,12 @@
 #include "network/ODPacket.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> STONE_BRIDGE_COST_PER_TILE(ConfigParamCategory::rooms, "StoneBridgeCostPerTile");
+
 const std::string RoomBridgeStoneName = "StoneBridge";
 const std::string RoomBridgeStoneNameDisplay = "Stone Bridge room";
 const RoomType RoomBridgeStone::mRoomType = RoomType::bridgeStone;
@@ -47,7 +50,7 @@ class RoomBridgeStoneFactory : public BridgeRoomFactory
     { return RoomBridgeStoneNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("StoneBridgeCostPerTile"); }
+    { return STONE_BRIDGE_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
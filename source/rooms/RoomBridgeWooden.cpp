@@ -25,9 +25,12 @@
 #include "network/ODPacket.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> WOODEN_BRIDGE_COST_PER_TILE(ConfigParamCategory::rooms, "WoodenBridgeCostPerTile");
+
 const std::string RoomBridgeWoodenName = "WoodenBridge";
 const std::string RoomBridgeWoodenNameDisplay = "Wooden Bridge room";
 const RoomType RoomBridgeWooden::mRoomType = RoomType::bridgeWooden;
@@ -47,7 +50,7 @@ class RoomBridgeWoodenFactory : public BridgeRoomFactory
     { return RoomBridgeWoodenNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("WoodenBridgeCostPerTile"); }
+    { return WOODEN_BRIDGE_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
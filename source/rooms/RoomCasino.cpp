@@ -31,11 +31,18 @@
 #include "gamemap/Pathfinding.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> CASINO_COST_PER_TILE(ConfigParamCategory::rooms, "CasinoCostPerTile");
+static ConfigParam<uint32_t> CASINO_COOLDOWN_WORK_MIN(ConfigParamCategory::rooms, "CasinoCooldownWorkMin");
+static ConfigParam<uint32_t> CASINO_COOLDOWN_WORK_MAX(ConfigParamCategory::rooms, "CasinoCooldownWorkMax");
+static ConfigParam<double> CASINO_FEE(ConfigParamCategory::rooms, "CasinoFee");
+static ConfigParam<double> CASINO_WAKEFULNESS_PER_WORK(ConfigParamCategory::rooms, "CasinoWakefulnessPerWork");
+static ConfigParam<int32_t> CASINO_BET(ConfigParamCategory::rooms, "CasinoBet");
+
 const std::string RoomCasinoName = "Casino";
 const std::string RoomCasinoNameDisplay = "Casino room";
 const RoomType RoomCasino::mRoomType = RoomType::casino;
@@ -54,7 +61,7 @@ class RoomCasinoFactory : public RoomFactory
     { return RoomCasinoNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("CasinoCostPerTile"); }
+    { return CASINO_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -216,6 +223,20 @@ bool RoomCasino::hasOpenCreatureSpot(Creature* creature)
     return false;
 }
 
+bool RoomCasino::mayHaveOpenCreatureSpot() const
+{
+    for(const std::pair<Tile* const,RoomCasinoGame>& p : mCreaturesSpots)
+    {
+        if(p.second.mCreature1.mCreature == nullptr)
+            return true;
+
+        if(p.second.mCreature2.mCreature == nullptr)
+            return true;
+    }
+
+    return false;
+}
+
 bool RoomCasino::addCreatureUsingRoom(Creature* creature)
 {
     const CreatureRoomAffinity& creatureRoomAffinity = creature->getDefinition()->getRoomAffinity(getType());
@@ -375,11 +396,11 @@ void RoomCasino::doUpkeep()
         // TODO: we could use the wall active spots to change feePercent/bets
 
         // We set anim for both creatures
-        uint32_t cooldown = Random::Uint(ConfigManager::getSingleton().getRoomConfigUInt32("CasinoCooldownWorkMin"),
-            ConfigManager::getSingleton().getRoomConfigUInt32("CasinoCooldownWorkMax"));
-        double feePercent = std::min(ConfigManager::getSingleton().getRoomConfigDouble("CasinoFee"), 1.0);
-        double wakefullness = ConfigManager::getSingleton().getRoomConfigDouble("CasinoWakefulnessPerWork");
-        int32_t creatureBet = ConfigManager::getSingleton().getRoomConfigInt32("CasinoBet");
+        uint32_t cooldown = Random::Uint(CASINO_COOLDOWN_WORK_MIN.get(),
+            CASINO_COOLDOWN_WORK_MAX.get());
+        double feePercent = std::min(CASINO_FEE.get(), 1.0);
+        double wakefullness = CASINO_WAKEFULNESS_PER_WORK.get();
+        int32_t creatureBet = CASINO_BET.get();
         creatureBet = std::min(creatureBet, p.second.mCreature1.mCreature->getGoldCarried());
         creatureBet = std::min(creatureBet, p.second.mCreature2.mCreature->getGoldCarried());
         int32_t totalBet = 0;
@@ -483,8 +504,8 @@ bool RoomCasino::useRoom(Creature& creature, bool forced)
         {
             // We fight for KO
             // We notify the player that his own creatures are fighting
-            creature.pushAction(Utils::make_unique<CreatureActionFightFriendly>(creature, opponent, true, getCoveredTiles(), true));
-            opponent->pushAction(Utils::make_unique<CreatureActionFightFriendly>(*opponent, &creature, true, getCoveredTiles(), true));
+            creature.pushAction<CreatureActionFightFriendly>(creature, opponent, true, getCoveredTiles(), true);
+            opponent->pushAction<CreatureActionFightFriendly>(*opponent, &creature, true, getCoveredTiles(), true);
         }
         return true;
     }
@@ -29,9 +29,16 @@
 #include "network/ServerNotification.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/LogManager.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> CRYPT_COST_PER_TILE(ConfigParamCategory::rooms, "CryptCostPerTile");
+static ConfigParam<int32_t> CRYPT_ROT_NB_TURNS(ConfigParamCategory::rooms, "CryptRotNbTurns");
+static ConfigParam<double> CRYPT_BONUS_WALL_ACTIVE_SPOT(ConfigParamCategory::rooms, "CryptBonusWallActiveSpot");
+static ConfigParam<int32_t> CRYPT_POINTS_FOR_SPAWN(ConfigParamCategory::rooms, "CryptPointsForSpawn");
+static ConfigParam<std::string> CRYPT_SPAWN_CLASS(ConfigParamCategory::rooms, "CryptSpawnClass");
+
 const std::string RoomCryptName = "Crypt";
 const std::string RoomCryptNameDisplay = "Crypt room";
 const RoomType RoomCrypt::mRoomType = RoomType::crypt;
@@ -50,7 +57,7 @@ class RoomCryptFactory : public RoomFactory
     { return RoomCryptNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("CryptCostPerTile"); }
+    { return CRYPT_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -219,11 +226,11 @@ void RoomCrypt::doUpkeep()
         ConfigManager& configManager = ConfigManager::getSingleton();
 
         ++p.second.second;
-        if(p.second.second < configManager.getRoomConfigInt32("CryptRotNbTurns"))
+        if(p.second.second < CRYPT_ROT_NB_TURNS.get())
             continue;
 
         // We add the rotten creature points to the room and release the active spot
-        double coef = 1.0 + static_cast<double>(mNumActiveSpots - mCentralActiveSpotTiles.size()) * configManager.getRoomConfigDouble("CryptBonusWallActiveSpot");
+        double coef = 1.0 + static_cast<double>(mNumActiveSpots - mCentralActiveSpotTiles.size()) * CRYPT_BONUS_WALL_ACTIVE_SPOT.get();
         Creature* c = p.second.first;
         mRottenPoints += static_cast<int32_t>(c->getMaxHp() * coef);
 
@@ -234,13 +241,13 @@ void RoomCrypt::doUpkeep()
 
         int32_t maxCreatures = configManager.getMaxCreaturesPerSeatAbsolute();
         int32_t numCreatures = getGameMap()->getCreaturesBySeat(getSeat()).size();
-        int32_t cryptPointsForSpawn = configManager.getRoomConfigInt32("CryptPointsForSpawn");
+        int32_t cryptPointsForSpawn = CRYPT_POINTS_FOR_SPAWN.get();
         if((numCreatures < maxCreatures) &&
            (mRottenPoints >= cryptPointsForSpawn))
         {
             Tile* tileSpawn = p.first;
             mRottenPoints -= cryptPointsForSpawn;
-            const std::string& className = configManager.getRoomConfigString("CryptSpawnClass");
+            const std::string& className = CRYPT_SPAWN_CLASS.get();
             const CreatureDefinition* classToSpawn = getGameMap()->getClassDescription(className);
             if(classToSpawn == nullptr)
             {
@@ -252,7 +259,7 @@ void RoomCrypt::doUpkeep()
                getSeat()->getPlayer()->getIsHuman() &&
                !getSeat()->getPlayer()->getHasLost())
             {
-                ServerNotification *serverNotification = new ServerNotification(
+                ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                     ServerNotificationType::chatServer, getSeat()->getPlayer());
                 std::string msg = "A creature has raised in your crypt thanks to the blood of the creatures rotting there";
                 serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
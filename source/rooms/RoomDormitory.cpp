@@ -28,9 +28,11 @@
 #include "gamemap/GameMap.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
+
+static ConfigParam<int32_t> DORMITORY_COST_PER_TILE(ConfigParamCategory::rooms, "DormitoryCostPerTile");
 
 const std::string RoomDormitoryName = "Dormitory";
 const std::string RoomDormitoryNameDisplay = "Dormitory room";
@@ -50,7 +52,7 @@ class RoomDormitoryFactory : public RoomFactory
     { return RoomDormitoryNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("DormitoryCostPerTile"); }
+    { return DORMITORY_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -161,6 +163,22 @@ bool RoomDormitory::removeCoveredTile(Tile* t)
     return false;
 }
 
+bool RoomDormitory::hasOpenTile() const
+{
+    for (const std::pair<Tile* const, TileData*>& p : mTileData)
+    {
+        const RoomDormitoryTileData* roomDormitoryTileData = static_cast<const RoomDormitoryTileData*>(p.second);
+        if (roomDormitoryTileData->mHP <=0)
+            continue;
+        if (roomDormitoryTileData->mCreature != nullptr)
+            continue;
+
+        return true;
+    }
+
+    return false;
+}
+
 std::vector<Tile*> RoomDormitory::getOpenTiles()
 {
     std::vector<Tile*> returnVector;
@@ -255,6 +273,7 @@ void RoomDormitory::createBed(Tile* sleepTile, int x, int y, int width, int heig
     ro->createMesh();
     // Save the info for later...
     mBedRoomObjectsInfo.push_back(bedInfo);
+    fireRoomAvailabilityChanged();
 }
 
 bool RoomDormitory::releaseTileForSleeping(Tile* t, Creature* c)
@@ -270,6 +289,7 @@ bool RoomDormitory::releaseTileForSleeping(Tile* t, Creature* c)
         if (roomDormitoryTileData->mCreature == c)
             roomDormitoryTileData->mCreature = nullptr;
     }
+    fireRoomAvailabilityChanged();
 
     Tile* homeTile = c->getHomeTile();
     if(homeTile == nullptr)
@@ -568,6 +588,6 @@ void RoomDormitory::notifyCarryingStateChanged(Creature* carrier, GameEntity* ca
 
 void RoomDormitory::creatureDropped(Creature& creature)
 {
-    creature.pushAction(Utils::make_unique<CreatureActionSleep>(creature));
-    creature.pushAction(Utils::make_unique<CreatureActionFindHome>(creature, true));
+    creature.pushAction<CreatureActionSleep>(creature);
+    creature.pushAction<CreatureActionFindHome>(creature, true);
 }
@@ -150,6 +150,8 @@ public:
 
     // Functions specific to this class.
     std::vector<Tile*> getOpenTiles();
+    //! \brief Returns true if at least one tile is free. Note that a free tile does not mean a bed can be built
+    bool hasOpenTile() const;
     Tile* claimTileForSleeping(Tile *t, Creature *c);
     bool releaseTileForSleeping(Tile *t, Creature *c);
     Tile* getLocationForBed(Creature* creature);
@@ -28,8 +28,11 @@
 #include "gamemap/GameMap.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
+
+static ConfigParam<int32_t> HATCHERY_COST_PER_TILE(ConfigParamCategory::rooms, "HatcheryCostPerTile");
+static ConfigParam<uint32_t> HATCHERY_CHICKEN_SPAWN_RATE(ConfigParamCategory::rooms, "HatcheryChickenSpawnRate");
 
 const std::string RoomHatcheryName = "Hatchery";
 const std::string RoomHatcheryNameDisplay = "Hatchery room";
@@ -49,7 +52,7 @@ class RoomHatcheryFactory : public RoomFactory
     { return RoomHatcheryNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("HatcheryCostPerTile"); }
+    { return HATCHERY_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -155,7 +158,7 @@ void RoomHatchery::doUpkeep()
 
     // Chickens have been eaten. We check when we will spawn another one
     ++mSpawnChickenCooldown;
-    if(mSpawnChickenCooldown < ConfigManager::getSingleton().getRoomConfigUInt32("HatcheryChickenSpawnRate"))
+    if(mSpawnChickenCooldown < HATCHERY_CHICKEN_SPAWN_RATE.get())
         return;
 
     // We spawn 1 chicken per chicken coop (until chickens are maxed)
@@ -180,6 +183,11 @@ bool RoomHatchery::hasOpenCreatureSpot(Creature* c)
     return mNumActiveSpots > mCreaturesUsingRoom.size();
 }
 
+bool RoomHatchery::mayHaveOpenCreatureSpot() const
+{
+    return mNumActiveSpots > mCreaturesUsingRoom.size();
+}
+
 bool RoomHatchery::useRoom(Creature& creature, bool forced)
 {
     // Check if the creature needs to eat
@@ -221,7 +229,7 @@ bool RoomHatchery::useRoom(Creature& creature, bool forced)
     if(chickenClosest == nullptr)
         return false;
 
-    creature.pushAction(Utils::make_unique<CreatureActionEatChicken>(creature, *chickenClosest));
+    creature.pushAction<CreatureActionEatChicken>(creature, *chickenClosest);
     return true;
 }
 
@@ -229,10 +237,10 @@ void RoomHatchery::handleCreatureUsingAbsorbedRoom(Creature& creature)
 {
     creature.clearDestinations(EntityAnimation::idle_anim, true, true);
     creature.clearActionQueue();
-    creature.pushAction(Utils::make_unique<CreatureActionSearchFood>(creature, true));
+    creature.pushAction<CreatureActionSearchFood>(creature, true);
 }
 
 void RoomHatchery::creatureDropped(Creature& creature)
 {
-    creature.pushAction(Utils::make_unique<CreatureActionSearchFood>(creature, true));
+    creature.pushAction<CreatureActionSearchFood>(creature, true);
 }
@@ -36,6 +36,7 @@ public:
 
     void doUpkeep() override;
     bool hasOpenCreatureSpot(Creature* c) override;
+    bool mayHaveOpenCreatureSpot() const override;
     bool shouldStopUseIfHungrySleepy(Creature& creature, bool forced) override
     { return false; }
     bool shouldNotUseIfBadMood(Creature& creature, bool forced) override
@@ -29,10 +29,18 @@
 #include "gamemap/GameMap.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> LIBRARY_COST_PER_TILE(ConfigParamCategory::rooms, "LibraryCostPerTile");
+static ConfigParam<int32_t> LIBRARY_SKILL_POINTS_BOOK(ConfigParamCategory::rooms, "LibrarySkillPointsBook");
+static ConfigParam<double> LIBRARY_POINTS_PER_WORK(ConfigParamCategory::rooms, "LibraryPointsPerWork");
+static ConfigParam<double> LIBRARY_WAKEFULNESS_PER_WORK(ConfigParamCategory::rooms, "LibraryWakefulnessPerWork");
+static ConfigParam<uint32_t> LIBRARY_COOLDOWN_WORK_MIN(ConfigParamCategory::rooms, "LibraryCooldownWorkMin");
+static ConfigParam<uint32_t> LIBRARY_COOLDOWN_WORK_MAX(ConfigParamCategory::rooms, "LibraryCooldownWorkMax");
+
 const std::string RoomLibraryName = "Library";
 const std::string RoomLibraryNameDisplay = "Library room";
 const RoomType RoomLibrary::mRoomType = RoomType::library;
@@ -51,7 +59,7 @@ class RoomLibraryFactory : public RoomFactory
     { return RoomLibraryNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("LibraryCostPerTile"); }
+    { return LIBRARY_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -223,6 +231,11 @@ bool RoomLibrary::hasOpenCreatureSpot(Creature* c)
     return !mUnusedSpots.empty();
 }
 
+bool RoomLibrary::mayHaveOpenCreatureSpot() const
+{
+    return !mUnusedSpots.empty();
+}
+
 bool RoomLibrary::addCreatureUsingRoom(Creature* creature)
 {
     if(!Room::addCreatureUsingRoom(creature))
@@ -324,7 +337,7 @@ void RoomLibrary::doUpkeep()
 
 bool RoomLibrary::useRoom(Creature& creature, bool forced)
 {
-    int32_t skillEntityPoints = ConfigManager::getSingleton().getRoomConfigInt32("LibrarySkillPointsBook");
+    int32_t skillEntityPoints = LIBRARY_SKILL_POINTS_BOOK.get();
     auto it = mCreaturesSpots.find(&creature);
     if(it == mCreaturesSpots.end())
     {
@@ -374,10 +387,10 @@ bool RoomLibrary::useRoom(Creature& creature, bool forced)
     OD_ASSERT_TRUE_MSG(creatureRoomAffinity.getRoomType() == getType(), "name=" + getName() + ", creature=" + creature.getName()
         + ", creatureRoomAffinityType=" + Helper::toString(static_cast<int>(creatureRoomAffinity.getRoomType())));
 
-    int32_t pointsEarned = static_cast<int32_t>(creatureRoomAffinity.getEfficiency() * ConfigManager::getSingleton().getRoomConfigDouble("LibraryPointsPerWork"));
-    creature.jobDone(ConfigManager::getSingleton().getRoomConfigDouble("LibraryWakefulnessPerWork"));
-    creature.setJobCooldown(Random::Uint(ConfigManager::getSingleton().getRoomConfigUInt32("LibraryCooldownWorkMin"),
-        ConfigManager::getSingleton().getRoomConfigUInt32("LibraryCooldownWorkMax")));
+    int32_t pointsEarned = static_cast<int32_t>(creatureRoomAffinity.getEfficiency() * LIBRARY_POINTS_PER_WORK.get());
+    creature.jobDone(LIBRARY_WAKEFULNESS_PER_WORK.get());
+    creature.setJobCooldown(Random::Uint(LIBRARY_COOLDOWN_WORK_MIN.get(),
+        LIBRARY_COOLDOWN_WORK_MAX.get()));
 
     // We check if we have enough points to create a skill entity
     mSkillPoints += pointsEarned;
@@ -29,12 +29,16 @@
 #include "network/ServerNotification.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 #include "utils/Random.h"
 
 #include <cmath>
 
+static ConfigParam<uint32_t> PORTAL_COOLDOWN_SPAWN_MIN(ConfigParamCategory::rooms, "PortalCooldownSpawnMin");
+static ConfigParam<uint32_t> PORTAL_COOLDOWN_SPAWN_MAX(ConfigParamCategory::rooms, "PortalCooldownSpawnMax");
+
 const std::string RoomPortalName = "Portal";
 const std::string RoomPortalNameDisplay = "Portal room";
 const RoomType RoomPortal::mRoomType = RoomType::portal;
@@ -147,7 +151,7 @@ void RoomPortal::claimForSeat(Seat* seat, Tile* tile, double danceRate)
     }
 
     mClaimedValue = static_cast<double>(numCoveredTiles());
-    setSeat(seat);
+    changeSeat(seat);
 
     for(Tile* tile : mCoveredTiles)
         tile->claimTile(seat);
@@ -216,8 +220,8 @@ void RoomPortal::doUpkeep()
         --mSpawnCreatureCountdown;
         return;
     }
-    mSpawnCreatureCountdown = Random::Uint(ConfigManager::getSingleton().getRoomConfigUInt32("PortalCooldownSpawnMin"),
-        ConfigManager::getSingleton().getRoomConfigUInt32("PortalCooldownSpawnMax"));
+    mSpawnCreatureCountdown = Random::Uint(PORTAL_COOLDOWN_SPAWN_MIN.get(),
+        PORTAL_COOLDOWN_SPAWN_MAX.get());
 
     if (mCoveredTiles.empty())
         return;
@@ -343,7 +347,7 @@ void RoomPortal::restoreInitialEntityState()
             continue;
 
         uint32_t nbTiles = tilesToNotify.size();
-        ServerNotification *serverNotification = new ServerNotification(
+        ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
             ServerNotificationType::refreshTiles, seat->getPlayer());
         serverNotification->mPacket << nbTiles;
         for(Tile* tile : tilesToNotify)
@@ -18,6 +18,7 @@
 #ifndef ROOMPORTALWAVE_H
 #define ROOMPORTALWAVE_H
 
+#include "gamemap/DigPathSearch.h"
 #include "rooms/Room.h"
 #include "rooms/RoomType.h"
 
@@ -151,15 +152,19 @@ private:
 
     //! \brief Tiles that will be checked if claimed by an enemy. If yes, the corresponding player will get attacked
     std::vector<Tile*> mTilesBorder;
+
+    //! \brief Used to find the tiles to dig to reach the target dungeon
+    DigPathSearch mDigPathSearch;
     //! \brief List of the seats that can be attacked by the portal
     std::vector<Seat*> mAttackableSeats;
 
     //! \brief Updates the portal mesh position.
     void updatePortalPosition();
 
-    //! \brief Finds the best diggable path between tileStart and tileDest.
-    //! Note that a path is returned even if tileDest is not reachable. It should go around
-    //! the undiggable tiles
+    //! \brief Finds the diggable path between tileStart and tileDest that takes the least time to walk
+    //! and dig (see DigPathSearch). The tiles to dig are added to tiles.
+    //! Note that a path is returned even if tileDest is not reachable. It leads to the closest
+    //! reachable tile.
     //! Returns true if a path was found to the dungeon and false otherwise
     bool findBestDiggablePath(Tile* tileStart, Tile* tileDest, Creature* creature, std::vector<Tile*>& tiles);
 
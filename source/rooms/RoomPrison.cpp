@@ -30,11 +30,15 @@
 #include "network/ServerNotification.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> PRISON_COST_PER_TILE(ConfigParamCategory::rooms, "PrisonCostPerTile");
+static ConfigParam<double> PRISON_DAMAGE_PER_TURN(ConfigParamCategory::rooms, "PrisonDamagePerTurn");
+static ConfigParam<std::string> PRISON_SPAWN_CLASS(ConfigParamCategory::rooms, "PrisonSpawnClass");
+
 const std::string RoomPrisonName = "Prison";
 const std::string RoomPrisonNameDisplay = "Prison room";
 const RoomType RoomPrison::mRoomType = RoomType::prison;
@@ -53,7 +57,7 @@ class RoomPrisonFactory : public RoomFactory
     { return RoomPrisonNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("PrisonCostPerTile"); }
+    { return PRISON_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -210,7 +214,7 @@ void RoomPrison::doUpkeep()
 
             ++nbCreatures;
             // We slightly damage the prisoner
-            double damage = ConfigManager::getSingleton().getRoomConfigDouble("PrisonDamagePerTurn");
+            double damage = PRISON_DAMAGE_PER_TURN.get();
             creature->takeDamage(this, damage, 0.0, 0.0, 0.0, creatureTile, false);
             creature->increaseTurnsPrison();
 
@@ -224,7 +228,7 @@ void RoomPrison::doUpkeep()
                getSeat()->getPlayer()->getIsHuman() &&
                !getSeat()->getPlayer()->getHasLost())
             {
-                ServerNotification *serverNotification = new ServerNotification(
+                ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                     ServerNotificationType::chatServer, getSeat()->getPlayer());
                 std::string msg = "A creature died starving in your prison";
                 serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
@@ -235,7 +239,7 @@ void RoomPrison::doUpkeep()
             creature->removeFromGameMap();
             creature->deleteYourself();
 
-            const std::string& className = ConfigManager::getSingleton().getRoomConfigString("PrisonSpawnClass");
+            const std::string& className = PRISON_SPAWN_CLASS.get();
             const CreatureDefinition* classToSpawn = getGameMap()->getClassDescription(className);
             if(classToSpawn == nullptr)
             {
@@ -315,7 +319,7 @@ void RoomPrison::restoreInitialEntityState()
         }
 
         creature->clearActionQueue();
-        creature->pushAction(Utils::make_unique<CreatureActionUseRoom>(*creature, *this, true));
+        creature->pushAction<CreatureActionUseRoom>(*creature, *this, true);
     }
 }
 
@@ -330,6 +334,12 @@ bool RoomPrison::hasOpenCreatureSpot(Creature* creature)
     return true;
 }
 
+bool RoomPrison::mayHaveOpenCreatureSpot() const
+{
+    // The pending prisoners are not followed by the room index
+    return !mCentralActiveSpotTiles.empty();
+}
+
 bool RoomPrison::addCreatureUsingRoom(Creature* creature)
 {
     if(!Room::addCreatureUsingRoom(creature))
@@ -402,7 +412,7 @@ void RoomPrison::notifyCarryingStateChanged(Creature* carrier, GameEntity* carri
     mPendingPrisoners.erase(it);
 
     prisonerCreature->clearActionQueue();
-    prisonerCreature->pushAction(Utils::make_unique<CreatureActionUseRoom>(*prisonerCreature, *this, true));
+    prisonerCreature->pushAction<CreatureActionUseRoom>(*prisonerCreature, *this, true);
     prisonerCreature->resetKoTurns();
 }
 
@@ -484,5 +494,5 @@ void RoomPrison::creatureDropped(Creature& creature)
     // We only push the use room action. We do not want this creature to be
     // considered as searching for a job
     creature.clearActionQueue();
-    creature.pushAction(Utils::make_unique<CreatureActionUseRoom>(creature, *this, true));
+    creature.pushAction<CreatureActionUseRoom>(creature, *this, true);
 }
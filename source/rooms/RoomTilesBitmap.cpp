@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "rooms/RoomTilesBitmap.h"
+
+#include "entities/Tile.h"
+
+const int32_t RoomTilesBitmap::NEIGHBOURS[8][2] =
+{
+    {-1, -1}, {0, -1}, {1, -1},
+    {-1, 0}, {1, 0},
+    {-1, 1}, {0, 1}, {1, 1}
+};
+
+RoomTilesBitmap::RoomTilesBitmap() :
+    mMinX(0),
+    mMinY(0),
+    mSizeX(0),
+    mSizeY(0)
+{
+}
+
+void RoomTilesBitmap::reset(const std::vector<Tile*>& tiles)
+{
+    mFlags.clear();
+    mSizeX = 0;
+    mSizeY = 0;
+    if(tiles.empty())
+        return;
+
+    int32_t minX = tiles[0]->getX();
+    int32_t maxX = minX;
+    int32_t minY = tiles[0]->getY();
+    int32_t maxY = minY;
+    for(Tile* tile : tiles)
+    {
+        if(tile->getX() < minX)
+            minX = tile->getX();
+        if(tile->getX() > maxX)
+            maxX = tile->getX();
+        if(tile->getY() < minY)
+            minY = tile->getY();
+        if(tile->getY() > maxY)
+            maxY = tile->getY();
+    }
+
+    mMinX = minX;
+    mMinY = minY;
+    mSizeX = maxX - minX + 1;
+    mSizeY = maxY - minY + 1;
+    mFlags.assign(static_cast<uint32_t>(mSizeX * mSizeY), 0);
+    for(Tile* tile : tiles)
+        addFlags(tile->getX(), tile->getY(), FLAG_COVERED);
+}
+
+uint8_t RoomTilesBitmap::getNeighboursMask(int32_t x, int32_t y, uint16_t flags, uint16_t excludedFlags) const
+{
+    uint8_t mask = 0;
+    for(uint32_t i = 0; i < 8; ++i)
+    {
+        uint16_t tileFlags = getFlags(x + NEIGHBOURS[i][0], y + NEIGHBOURS[i][1]);
+        if(((tileFlags & flags) == flags) && ((tileFlags & excludedFlags) == 0))
+            mask |= static_cast<uint8_t>(1 << i);
+    }
+
+    return mask;
+}
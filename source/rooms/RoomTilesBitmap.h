@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ROOMTILESBITMAP_H
+#define ROOMTILESBITMAP_H
+
+#include <cstdint>
+#include <vector>
+
+class Tile;
+
+//! \brief Flags set on the tiles of the bounding box of a room. It allows to check the neighbourhood
+//! of a tile in constant time instead of going through every covered tile.
+class RoomTilesBitmap
+{
+public:
+    //! \brief Flag set by reset on the given tiles
+    static const uint16_t FLAG_COVERED = 0x0001;
+
+    //! \brief Offsets of the 8 neighbours. Bit i of the masks returned by getNeighboursMask
+    //! corresponds to NEIGHBOURS[i]
+    static const int32_t NEIGHBOURS[8][2];
+    static const uint8_t ALL_NEIGHBOURS = 0xFF;
+
+    RoomTilesBitmap();
+
+    //! \brief Resizes the bitmap to the bounding box of the given tiles, clears it and sets FLAG_COVERED
+    //! on the given tiles
+    void reset(const std::vector<Tile*>& tiles);
+
+    //! \brief Returns the flags of the given tile. Tiles outside of the bounding box have no flag
+    inline uint16_t getFlags(int32_t x, int32_t y) const
+    {
+        if(!isInside(x, y))
+            return 0;
+
+        return mFlags[(x - mMinX) + (y - mMinY) * mSizeX];
+    }
+
+    //! \brief Adds the given flags to the given tile. Nothing is done if the tile is outside of the bounding box
+    inline void addFlags(int32_t x, int32_t y, uint16_t flags)
+    {
+        if(!isInside(x, y))
+            return;
+
+        mFlags[(x - mMinX) + (y - mMinY) * mSizeX] |= flags;
+    }
+
+    //! \brief Returns true if the given tile has every given flag
+    inline bool hasFlags(int32_t x, int32_t y, uint16_t flags) const
+    { return (getFlags(x, y) & flags) == flags; }
+
+    //! \brief Returns the mask of the neighbours of the given tile having every flag in flags and none
+    //! of excludedFlags
+    uint8_t getNeighboursMask(int32_t x, int32_t y, uint16_t flags, uint16_t excludedFlags) const;
+
+private:
+    inline bool isInside(int32_t x, int32_t y) const
+    {
+        return (x >= mMinX) && (x < mMinX + mSizeX) &&
+            (y >= mMinY) && (y < mMinY + mSizeY);
+    }
+
+    int32_t mMinX;
+    int32_t mMinY;
+    int32_t mSizeX;
+    int32_t mSizeY;
+    std::vector<uint16_t> mFlags;
+};
+
+#endif // ROOMTILESBITMAP_H
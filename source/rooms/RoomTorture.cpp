@@ -29,11 +29,17 @@
 #include "network/ServerNotification.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
-#include "utils/MakeUnique.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> TORTURE_COST_PER_TILE(ConfigParamCategory::rooms, "TortureCostPerTile");
+static ConfigParam<double> TORTURE_DAMAGE_PER_TURN(ConfigParamCategory::rooms, "TortureDamagePerTurn");
+static ConfigParam<double> TORTURE_RALLY_PERCENT(ConfigParamCategory::rooms, "TortureRallyPercent");
+static ConfigParam<uint32_t> TORTURE_SESSION_LENGTH_MIN(ConfigParamCategory::rooms, "TortureSessionLengthMin");
+static ConfigParam<uint32_t> TORTURE_SESSION_LENGTH_MAX(ConfigParamCategory::rooms, "TortureSessionLengthMax");
+
 const std::string RoomTortureName = "Torture";
 const std::string RoomTortureNameDisplay = "Torture room";
 const RoomType RoomTorture::mRoomType = RoomType::torture;
@@ -52,7 +58,7 @@ class RoomTortureFactory : public RoomFactory
     { return RoomTortureNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("TortureCostPerTile"); }
+    { return TORTURE_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -216,6 +222,17 @@ bool RoomTorture::hasOpenCreatureSpot(Creature* creature)
     return false;
 }
 
+bool RoomTorture::mayHaveOpenCreatureSpot() const
+{
+    for(const std::pair<Tile* const,RoomTortureCreatureInfo>& p : mCreaturesSpots)
+    {
+        if(p.second.mCreature == nullptr)
+            return true;
+    }
+
+    return false;
+}
+
 bool RoomTorture::addCreatureUsingRoom(Creature* creature)
 {
     RoomTortureCreatureInfo* infoToUse = nullptr;
@@ -281,7 +298,6 @@ void RoomTorture::doUpkeep()
     if (mCoveredTiles.empty())
         return;
 
-    ConfigManager& config = ConfigManager::getSingleton();
     for(std::pair<Tile* const,RoomTortureCreatureInfo>& p : mCreaturesSpots)
     {
         if(p.second.mCreature == nullptr)
@@ -297,7 +313,7 @@ void RoomTorture::doUpkeep()
             break;
         }
         creature->increaseTurnsTorture();
-        double damage = config.getRoomConfigDouble("TortureDamagePerTurn");
+        double damage = TORTURE_DAMAGE_PER_TURN.get();
         creature->takeDamage(this, damage, 0.0, 0.0, 0.0, tileCreature, false);
         break;
     }
@@ -312,7 +328,6 @@ bool RoomTorture::useRoom(Creature& creature, bool forced)
         return false;
     }
 
-    ConfigManager& config = ConfigManager::getSingleton();
     for(std::pair<Tile* const,RoomTortureCreatureInfo>& p : mCreaturesSpots)
     {
         if(p.second.mCreature != &creature)
@@ -328,7 +343,7 @@ bool RoomTorture::useRoom(Creature& creature, bool forced)
         p.second.mIsReady = true;
 
         if((getSeat() != creature.getSeat()) &&
-           (Random::Double(0.0, 1.0) <= config.getRoomConfigDouble("TortureRallyPercent")))
+           (Random::Double(0.0, 1.0) <= TORTURE_RALLY_PERCENT.get()))
         {
             // The creature changes side
             creature.changeSeat(getSeat());
@@ -339,7 +354,7 @@ bool RoomTorture::useRoom(Creature& creature, bool forced)
                getSeat()->getPlayer()->getIsHuman() &&
                !getSeat()->getPlayer()->getHasLost())
             {
-                ServerNotification *serverNotification = new ServerNotification(
+                ServerNotification *serverNotification = ODServer::getSingleton().createServerNotification(
                     ServerNotificationType::chatServer, getSeat()->getPlayer());
                 std::string msg = "Your tormentors have convinced another creature how sweet it is to live under your rule";
                 serverNotification->mPacket << msg << EventShortNoticeType::aboutCreatures;
@@ -349,8 +364,8 @@ bool RoomTorture::useRoom(Creature& creature, bool forced)
         }
 
         // We start the fire effect and we set job cooldown
-        uint32_t nbTurns = Random::Uint(config.getRoomConfigUInt32("TortureSessionLengthMin"),
-            config.getRoomConfigUInt32("TortureSessionLengthMax"));
+        uint32_t nbTurns = Random::Uint(TORTURE_SESSION_LENGTH_MIN.get(),
+            TORTURE_SESSION_LENGTH_MAX.get());
         creature.setJobCooldown(nbTurns);
 
         BuildingObject* obj = getBuildingObjectFromTile(tileCreature);
@@ -411,7 +426,7 @@ void RoomTorture::creatureDropped(Creature& creature)
     // We only push the use room action. We do not want this creature to be
     // considered as searching for a job
     creature.clearActionQueue();
-    creature.pushAction(Utils::make_unique<CreatureActionUseRoom>(creature, *this, true));
+    creature.pushAction<CreatureActionUseRoom>(creature, *this, true);
 }
 void RoomTorture::exportToStream(std::ostream& os) const
 {
@@ -475,6 +490,6 @@ void RoomTorture::restoreInitialEntityState()
         }
 
         creature->clearActionQueue();
-        creature->pushAction(Utils::make_unique<CreatureActionUseRoom>(*creature, *this, true));
+        creature->pushAction<CreatureActionUseRoom>(*creature, *this, true);
     }
 }
@@ -53,6 +53,7 @@ public:
 
     void doUpkeep() override;
     bool hasOpenCreatureSpot(Creature* creature) override;
+    bool mayHaveOpenCreatureSpot() const override;
     bool addCreatureUsingRoom(Creature* creature) override;
     void removeCreatureUsingRoom(Creature* creature) override;
     void absorbRoom(Room* room) override;
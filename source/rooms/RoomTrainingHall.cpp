@@ -25,10 +25,19 @@
 #include "gamemap/GameMap.h"
 #include "rooms/RoomManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> TRAIN_HALL_COST_PER_TILE(ConfigParamCategory::rooms, "TrainHallCostPerTile");
+static ConfigParam<uint32_t> TRAIN_HALL_MAX_TRAINING_LEVEL(ConfigParamCategory::rooms, "TrainHallMaxTrainingLevel");
+static ConfigParam<double> TRAIN_HALL_BONUS_WALL_ACTIVE_SPOT(ConfigParamCategory::rooms, "TrainHallBonusWallActiveSpot");
+static ConfigParam<double> TRAIN_HALL_XP_PER_ATTACK(ConfigParamCategory::rooms, "TrainHallXpPerAttack");
+static ConfigParam<double> TRAIN_HALL_WAKEFULNESS_PER_ATTACK(ConfigParamCategory::rooms, "TrainHallWakefulnessPerAttack");
+static ConfigParam<uint32_t> TRAIN_HALL_COOLDOWN_HIT_MIN(ConfigParamCategory::rooms, "TrainHallCooldownHitMin");
+static ConfigParam<uint32_t> TRAIN_HALL_COOLDOWN_HIT_MAX(ConfigParamCategory::rooms, "TrainHallCooldownHitMax");
+
 const std::string RoomTrainingHallName = "TrainingHall";
 const std::string RoomTrainingHallNameDisplay = "Training hall room";
 const RoomType RoomTrainingHall::mRoomType = RoomType::trainingHall;
@@ -47,7 +56,7 @@ class RoomTrainingHallFactory : public RoomFactory
     { return RoomTrainingHallNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("TrainHallCostPerTile"); }
+    { return TRAIN_HALL_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -221,6 +230,7 @@ void RoomTrainingHall::refreshCreaturesDummies()
     mCreaturesDummies.clear();
     mUnusedDummies.clear();
     nbTurnsNoChangeDummies = 0;
+    fireRoomAvailabilityChanged();
 
     mUnusedDummies.insert(mUnusedDummies.end(), mCentralActiveSpotTiles.begin(), mCentralActiveSpotTiles.end());
 
@@ -266,13 +276,18 @@ void RoomTrainingHall::refreshCreaturesDummies()
 
 bool RoomTrainingHall::hasOpenCreatureSpot(Creature* c)
 {
-    if (c->getLevel() >= ConfigManager::getSingleton().getRoomConfigUInt32("TrainHallMaxTrainingLevel"))
+    if (c->getLevel() >= TRAIN_HALL_MAX_TRAINING_LEVEL.get())
         return false;
 
     // We accept all creatures as soon as there are free dummies
     return mUnusedDummies.size() > 0;
 }
 
+bool RoomTrainingHall::mayHaveOpenCreatureSpot() const
+{
+    return !mUnusedDummies.empty();
+}
+
 bool RoomTrainingHall::addCreatureUsingRoom(Creature* creature)
 {
     if(!Room::addCreatureUsingRoom(creature))
@@ -389,14 +404,14 @@ bool RoomTrainingHall::useRoom(Creature& creature, bool forced)
         + ", creatureRoomAffinityType=" + Helper::toString(static_cast<int>(creatureRoomAffinity.getRoomType())));
 
     // We add a bonus per wall active spots
-    double coef = 1.0 + static_cast<double>(mNumActiveSpots - mCentralActiveSpotTiles.size()) * ConfigManager::getSingleton().getRoomConfigDouble("TrainHallBonusWallActiveSpot");
-    double expReceived = creatureRoomAffinity.getEfficiency() * ConfigManager::getSingleton().getRoomConfigDouble("TrainHallXpPerAttack");
+    double coef = 1.0 + static_cast<double>(mNumActiveSpots - mCentralActiveSpotTiles.size()) * TRAIN_HALL_BONUS_WALL_ACTIVE_SPOT.get();
+    double expReceived = creatureRoomAffinity.getEfficiency() * TRAIN_HALL_XP_PER_ATTACK.get();
     expReceived *= coef;
 
     creature.receiveExp(expReceived);
-    creature.jobDone(ConfigManager::getSingleton().getRoomConfigDouble("TrainHallWakefulnessPerAttack"));
-    creature.setJobCooldown(Random::Uint(ConfigManager::getSingleton().getRoomConfigUInt32("TrainHallCooldownHitMin"),
-        ConfigManager::getSingleton().getRoomConfigUInt32("TrainHallCooldownHitMax")));
+    creature.jobDone(TRAIN_HALL_WAKEFULNESS_PER_ATTACK.get());
+    creature.setJobCooldown(Random::Uint(TRAIN_HALL_COOLDOWN_HIT_MIN.get(),
+        TRAIN_HALL_COOLDOWN_HIT_MAX.get()));
 
     return false;
 }
@@ -36,6 +36,7 @@ public:
 
     void doUpkeep() override;
     bool hasOpenCreatureSpot(Creature* c) override;
+    bool mayHaveOpenCreatureSpot() const override;
     bool addCreatureUsingRoom(Creature* c) override;
     void removeCreatureUsingRoom(Creature* c) override;
     void absorbRoom(Room *r) override;
@@ -32,12 +32,15 @@
 #include "rooms/RoomManager.h"
 #include "sound/SoundEffectsManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 #include "utils/Random.h"
 
 #include <string>
 
+static ConfigParam<int32_t> TREASURY_COST_PER_TILE(ConfigParamCategory::rooms, "TreasuryCostPerTile");
+
 const std::string RoomTreasuryName = "Treasury";
 const std::string RoomTreasuryNameDisplay = "Treasury room";
 const RoomType RoomTreasury::mRoomType = RoomType::treasury;
@@ -56,7 +59,7 @@ class RoomTreasuryFactory : public RoomFactory
     { return RoomTreasuryNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("TreasuryCostPerTile"); }
+    { return TREASURY_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -287,6 +290,7 @@ bool RoomTreasury::removeCoveredTile(Tile* t)
 
     roomTreasuryTileData->mMeshOfTile.clear();
     roomTreasuryTileData->mGoldInTile = 0;
+    fireRoomAvailabilityChanged();
     return Room::removeCoveredTile(t);
 }
 
@@ -344,6 +348,7 @@ int RoomTreasury::depositGold(int gold, Tile *tile)
         return wasDeposited;
 
     mGoldChanged = true;
+    fireRoomAvailabilityChanged();
 
     // Tells the client to play a deposit gold sound. For now, we only send it to the players
     // with vision on tile
@@ -355,6 +360,7 @@ int RoomTreasury::depositGold(int gold, Tile *tile)
 int RoomTreasury::withdrawGold(int gold)
 {
     mGoldChanged = true;
+    fireRoomAvailabilityChanged();
 
     int withdrawlAmount = 0;
     for (std::pair<Tile* const, TileData*>& p : mTileData)
@@ -31,10 +31,17 @@
 #include "traps/TrapManager.h"
 #include "traps/TrapType.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 #include "utils/Random.h"
 
+static ConfigParam<int32_t> WORKSHOP_COST_PER_TILE(ConfigParamCategory::rooms, "WorkshopCostPerTile");
+static ConfigParam<double> WORKSHOP_POINTS_PER_WORK(ConfigParamCategory::rooms, "WorkshopPointsPerWork");
+static ConfigParam<double> WORKSHOP_WAKEFULNESS_PER_WORK(ConfigParamCategory::rooms, "WorkshopWakefulnessPerWork");
+static ConfigParam<uint32_t> WORKSHOP_COOLDOWN_WORK_MIN(ConfigParamCategory::rooms, "WorkshopCooldownWorkMin");
+static ConfigParam<uint32_t> WORKSHOP_COOLDOWN_WORK_MAX(ConfigParamCategory::rooms, "WorkshopCooldownWorkMax");
+
 const std::string RoomWorkshopName = "Workshop";
 const std::string RoomWorkshopNameDisplay = "Workshop room";
 const RoomType RoomWorkshop::mRoomType = RoomType::workshop;
@@ -53,7 +60,7 @@ class RoomWorkshopFactory : public RoomFactory
     { return RoomWorkshopNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getRoomConfigInt32("WorkshopCostPerTile"); }
+    { return WORKSHOP_COST_PER_TILE.get(); }
 
     void checkBuildRoom(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand) const override
     {
@@ -231,6 +238,11 @@ bool RoomWorkshop::hasOpenCreatureSpot(Creature* c)
     return !mUnusedSpots.empty();
 }
 
+bool RoomWorkshop::mayHaveOpenCreatureSpot() const
+{
+    return !mUnusedSpots.empty();
+}
+
 bool RoomWorkshop::addCreatureUsingRoom(Creature* creature)
 {
     if(!Room::addCreatureUsingRoom(creature))
@@ -471,10 +483,10 @@ bool RoomWorkshop::useRoom(Creature& creature, bool forced)
     OD_ASSERT_TRUE_MSG(creatureRoomAffinity.getRoomType() == getType(), "name=" + getName() + ", creature=" + creature.getName()
         + ", creatureRoomAffinityType=" + Helper::toString(static_cast<int>(creatureRoomAffinity.getRoomType())));
 
-    mPoints += static_cast<int32_t>(creatureRoomAffinity.getEfficiency() * ConfigManager::getSingleton().getRoomConfigDouble("WorkshopPointsPerWork"));
-    creature.jobDone(ConfigManager::getSingleton().getRoomConfigDouble("WorkshopWakefulnessPerWork"));
-    creature.setJobCooldown(Random::Uint(ConfigManager::getSingleton().getRoomConfigUInt32("WorkshopCooldownWorkMin"),
-        ConfigManager::getSingleton().getRoomConfigUInt32("WorkshopCooldownWorkMax")));
+    mPoints += static_cast<int32_t>(creatureRoomAffinity.getEfficiency() * WORKSHOP_POINTS_PER_WORK.get());
+    creature.jobDone(WORKSHOP_WAKEFULNESS_PER_WORK.get());
+    creature.setJobCooldown(Random::Uint(WORKSHOP_COOLDOWN_WORK_MIN.get(),
+        WORKSHOP_COOLDOWN_WORK_MAX.get()));
 
     return false;
 }
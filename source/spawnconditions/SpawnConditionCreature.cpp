@@ -15,21 +15,13 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "entities/Creature.h"
-
-#include "gamemap/GameMap.h"
+#include "game/Seat.h"
 
 #include "spawnconditions/SpawnConditionCreature.h"
 
-bool SpawnConditionCreature::computePointsForSeat(const GameMap& gameMap, const Seat& seat, int32_t& computedPoints) const
+bool SpawnConditionCreature::computePointsForSeat(const GameMap&, const Seat& seat, int32_t& computedPoints) const
 {
-    int32_t nbCreatures = 0;
-    std::vector<Creature*> creatures = gameMap.getCreaturesBySeat(&seat);
-    for(Creature* creature : creatures)
-    {
-        if(creature->getDefinition() == mCreatureDefinition)
-            ++nbCreatures;
-    }
+    int32_t nbCreatures = seat.getNbAliveCreatures(mCreatureDefinition);
     if(nbCreatures < mNbCreatureMin)
         return false;
 
@@ -15,20 +15,13 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "gamemap/GameMap.h"
-
-#include "rooms/Room.h"
+#include "game/Seat.h"
 
 #include "spawnconditions/SpawnConditionRoom.h"
 
-bool SpawnConditionRoom::computePointsForSeat(const GameMap& gameMap, const Seat& seat, int32_t& computedPoints) const
+bool SpawnConditionRoom::computePointsForSeat(const GameMap&, const Seat& seat, int32_t& computedPoints) const
 {
-    int32_t nbActiveSpots = 0;
-    std::vector<const Room*> rooms = gameMap.getRoomsByTypeAndSeat(mRoomType, &seat);
-    for(const Room* room : rooms)
-    {
-        nbActiveSpots += room->getNumActiveSpots();
-    }
+    int32_t nbActiveSpots = seat.getRoomAvailabilityIndex().getNbActiveSpots(mRoomType);
     if(nbActiveSpots < mNbActiveSpotsMin)
         return false;
 
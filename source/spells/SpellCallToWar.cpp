@@ -27,9 +27,13 @@
 #include "network/ODClient.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CALL_TO_WAR_NB_TURNS_MAX(ConfigParamCategory::spells, "CallToWarNbTurnsMax");
+static ConfigParam<int32_t> CALL_TO_WAR_PRICE(ConfigParamCategory::spells, "CallToWarPrice");
+
 const std::string SpellCallToWarName = "callToWar";
 const std::string SpellCallToWarNameDisplay = "Call to war";
 const std::string SpellCallToWarCooldownKey = "CallToWarCooldown";
@@ -70,7 +74,7 @@ static SpellRegister reg(new SpellCallToWarFactory);
 
 SpellCallToWar::SpellCallToWar(GameMap* gameMap) :
     Spell(gameMap, SpellManager::getSpellNameFromSpellType(SpellType::callToWar), "WarBanner", 0.0,
-        ConfigManager::getSingleton().getSpellConfigInt32("CallToWarNbTurnsMax"))
+        CALL_TO_WAR_NB_TURNS_MAX.get())
 {
     mPrevAnimationState = "Loop";
     mPrevAnimationStateLoop = true;
@@ -110,7 +114,7 @@ void SpellCallToWar::checkSpellCast(GameMap* gameMap, const InputManager& inputM
         return;
 
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
-    int32_t price = ConfigManager::getSingleton().getSpellConfigInt32("CallToWarPrice");
+    int32_t price = CALL_TO_WAR_PRICE.get();
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
         if(playerMana < price)
@@ -153,7 +157,7 @@ bool SpellCallToWar::castSpell(GameMap* gameMap, Player* player, ODPacket& packe
         return false;
 
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
-    int32_t manaCost = ConfigManager::getSingleton().getSpellConfigInt32("CallToWarPrice");
+    int32_t manaCost = CALL_TO_WAR_PRICE.get();
     if(playerMana < manaCost)
         return false;
 
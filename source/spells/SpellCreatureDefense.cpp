@@ -32,9 +32,14 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CREATURE_DEFENSE_PRICE(ConfigParamCategory::spells, "CreatureDefensePrice");
+static ConfigParam<uint32_t> CREATURE_DEFENSE_DURATION(ConfigParamCategory::spells, "CreatureDefenseDuration");
+static ConfigParam<double> CREATURE_DEFENSE_VALUE(ConfigParamCategory::spells, "CreatureDefenseValue");
+
 const std::string SpellCreatureDefenseName = "creatureDefense";
 const std::string SpellCreatureDefenseNameDisplay = "Creature defense";
 const std::string SpellCreatureDefenseCooldownKey = "CreatureDefenseCooldown";
@@ -76,7 +81,7 @@ static SpellRegister reg(new SpellCreatureDefenseFactory);
 void SpellCreatureDefense::checkSpellCast(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand)
 {
     Player* player = gameMap->getLocalPlayer();
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureDefensePrice");
+    int32_t pricePerTarget = CREATURE_DEFENSE_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
@@ -194,13 +199,13 @@ bool SpellCreatureDefense::castSpell(GameMap* gameMap, Player* player, ODPacket&
         return false;
     }
 
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureDefensePrice");
+    int32_t pricePerTarget = CREATURE_DEFENSE_PRICE.get();
 
     if(!player->getSeat()->takeMana(pricePerTarget))
         return false;
 
-    uint32_t duration = ConfigManager::getSingleton().getSpellConfigUInt32("CreatureDefenseDuration");
-    double value = ConfigManager::getSingleton().getSpellConfigDouble("CreatureDefenseValue");
+    uint32_t duration = CREATURE_DEFENSE_DURATION.get();
+    double value = CREATURE_DEFENSE_VALUE.get();
     CreatureEffectDefense* effect = new CreatureEffectDefense(duration, value, 0.0, 0.0, "SpellCreatureDefense");
     creature->addCreatureEffect(effect);
 
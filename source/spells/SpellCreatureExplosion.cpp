@@ -30,9 +30,14 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CREATURE_EXPLOSION_PRICE(ConfigParamCategory::spells, "CreatureExplosionPrice");
+static ConfigParam<uint32_t> CREATURE_EXPLOSION_DURATION(ConfigParamCategory::spells, "CreatureExplosionDuration");
+static ConfigParam<double> CREATURE_EXPLOSION_VALUE(ConfigParamCategory::spells, "CreatureExplosionValue");
+
 const std::string SpellCreatureExplosionName = "creatureExplosion";
 const std::string SpellCreatureExplosionNameDisplay = "Creature explosion";
 const std::string SpellCreatureExplosionCooldownKey = "CreatureExplosionCooldown";
@@ -75,7 +80,7 @@ void SpellCreatureExplosion::checkSpellCast(GameMap* gameMap, const InputManager
 {
     Player* player = gameMap->getLocalPlayer();
     int32_t priceTotal = 0;
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureExplosionPrice");
+    int32_t pricePerTarget = CREATURE_EXPLOSION_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
@@ -205,7 +210,7 @@ bool SpellCreatureExplosion::castSpell(GameMap* gameMap, Player* player, ODPacke
     if(creatures.empty())
         return false;
 
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureExplosionPrice");
+    int32_t pricePerTarget = CREATURE_EXPLOSION_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     uint32_t nbTargets = std::min(static_cast<uint32_t>(playerMana / pricePerTarget), static_cast<uint32_t>(creatures.size()));
     int32_t priceTotal = nbTargets * pricePerTarget;
@@ -216,8 +221,8 @@ bool SpellCreatureExplosion::castSpell(GameMap* gameMap, Player* player, ODPacke
     if(!player->getSeat()->takeMana(priceTotal))
         return false;
 
-    uint32_t duration = ConfigManager::getSingleton().getSpellConfigUInt32("CreatureExplosionDuration");
-    double value = ConfigManager::getSingleton().getSpellConfigDouble("CreatureExplosionValue");
+    uint32_t duration = CREATURE_EXPLOSION_DURATION.get();
+    double value = CREATURE_EXPLOSION_VALUE.get();
     for(Creature* creature : creatures)
     {
         CreatureEffectExplosion* effect = new CreatureEffectExplosion(duration, value, "SpellCreatureExplosion");
@@ -31,9 +31,14 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CREATURE_HASTE_PRICE(ConfigParamCategory::spells, "CreatureHastePrice");
+static ConfigParam<uint32_t> CREATURE_HASTE_DURATION(ConfigParamCategory::spells, "CreatureHasteDuration");
+static ConfigParam<double> CREATURE_HASTE_VALUE(ConfigParamCategory::spells, "CreatureHasteValue");
+
 const std::string SpellCreatureHasteName = "creatureHaste";
 const std::string SpellCreatureHasteNameDisplay = "Creature haste";
 const std::string SpellCreatureHasteCooldownKey = "CreatureHasteCooldown";
@@ -75,7 +80,7 @@ static SpellRegister reg(new SpellCreatureHasteFactory);
 void SpellCreatureHaste::checkSpellCast(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand)
 {
     Player* player = gameMap->getLocalPlayer();
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureHastePrice");
+    int32_t pricePerTarget = CREATURE_HASTE_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
@@ -193,13 +198,13 @@ bool SpellCreatureHaste::castSpell(GameMap* gameMap, Player* player, ODPacket& p
         return false;
     }
 
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureHastePrice");
+    int32_t pricePerTarget = CREATURE_HASTE_PRICE.get();
 
     if(!player->getSeat()->takeMana(pricePerTarget))
         return false;
 
-    uint32_t duration = ConfigManager::getSingleton().getSpellConfigUInt32("CreatureHasteDuration");
-    double value = ConfigManager::getSingleton().getSpellConfigDouble("CreatureHasteValue");
+    uint32_t duration = CREATURE_HASTE_DURATION.get();
+    double value = CREATURE_HASTE_VALUE.get();
     CreatureEffectSpeedChange* effect = new CreatureEffectSpeedChange(duration, value, "SpellCreatureHaste");
     creature->addCreatureEffect(effect);
 
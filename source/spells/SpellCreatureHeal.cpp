@@ -31,9 +31,14 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CREATURE_HEAL_PRICE(ConfigParamCategory::spells, "CreatureHealPrice");
+static ConfigParam<uint32_t> CREATURE_HEAL_DURATION(ConfigParamCategory::spells, "CreatureHealDuration");
+static ConfigParam<double> CREATURE_HEAL_VALUE(ConfigParamCategory::spells, "CreatureHealValue");
+
 const std::string SpellCreatureHealName = "creatureHeal";
 const std::string SpellCreatureHealNameDisplay = "Creature heal";
 const std::string SpellCreatureHealCooldownKey = "CreatureHealCooldown";
@@ -76,7 +81,7 @@ void SpellCreatureHeal::checkSpellCast(GameMap* gameMap, const InputManager& inp
 {
     Player* player = gameMap->getLocalPlayer();
     int32_t priceTotal = 0;
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureHealPrice");
+    int32_t pricePerTarget = CREATURE_HEAL_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
@@ -233,7 +238,7 @@ bool SpellCreatureHeal::castSpell(GameMap* gameMap, Player* player, ODPacket& pa
     if(creatures.empty())
         return false;
 
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureHealPrice");
+    int32_t pricePerTarget = CREATURE_HEAL_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     uint32_t nbTargets = std::min(static_cast<uint32_t>(playerMana / pricePerTarget), static_cast<uint32_t>(creatures.size()));
     int32_t priceTotal = nbTargets * pricePerTarget;
@@ -244,8 +249,8 @@ bool SpellCreatureHeal::castSpell(GameMap* gameMap, Player* player, ODPacket& pa
     if(!player->getSeat()->takeMana(priceTotal))
         return false;
 
-    uint32_t duration = ConfigManager::getSingleton().getSpellConfigUInt32("CreatureHealDuration");
-    double value = ConfigManager::getSingleton().getSpellConfigDouble("CreatureHealValue");
+    uint32_t duration = CREATURE_HEAL_DURATION.get();
+    double value = CREATURE_HEAL_VALUE.get();
     std::vector<Tile*> affectedTiles;
     for(Creature* creature : creatures)
     {
@@ -31,9 +31,14 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CREATURE_SLOW_PRICE(ConfigParamCategory::spells, "CreatureSlowPrice");
+static ConfigParam<uint32_t> CREATURE_SLOW_DURATION(ConfigParamCategory::spells, "CreatureSlowDuration");
+static ConfigParam<double> CREATURE_SLOW_VALUE(ConfigParamCategory::spells, "CreatureSlowValue");
+
 const std::string SpellCreatureSlowName = "creatureSlow";
 const std::string SpellCreatureSlowNameDisplay = "Creature Slow";
 const std::string SpellCreatureSlowCooldownKey = "CreatureSlowCooldown";
@@ -75,7 +80,7 @@ static SpellRegister reg(new SpellCreatureSlowFactory);
 void SpellCreatureSlow::checkSpellCast(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand)
 {
     Player* player = gameMap->getLocalPlayer();
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureSlowPrice");
+    int32_t pricePerTarget = CREATURE_SLOW_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
@@ -193,13 +198,13 @@ bool SpellCreatureSlow::castSpell(GameMap* gameMap, Player* player, ODPacket& pa
         return false;
     }
 
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureSlowPrice");
+    int32_t pricePerTarget = CREATURE_SLOW_PRICE.get();
 
     if(!player->getSeat()->takeMana(pricePerTarget))
         return false;
 
-    uint32_t duration = ConfigManager::getSingleton().getSpellConfigUInt32("CreatureSlowDuration");
-    double value = ConfigManager::getSingleton().getSpellConfigDouble("CreatureSlowValue");
+    uint32_t duration = CREATURE_SLOW_DURATION.get();
+    double value = CREATURE_SLOW_VALUE.get();
     CreatureEffectSpeedChange* effect = new CreatureEffectSpeedChange(duration, value, "SpellCreatureSlow");
     creature->addCreatureEffect(effect);
 
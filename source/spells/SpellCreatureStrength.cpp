@@ -31,9 +31,14 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CREATURE_STRENGTH_PRICE(ConfigParamCategory::spells, "CreatureStrengthPrice");
+static ConfigParam<uint32_t> CREATURE_STRENGTH_DURATION(ConfigParamCategory::spells, "CreatureStrengthDuration");
+static ConfigParam<double> CREATURE_STRENGTH_VALUE(ConfigParamCategory::spells, "CreatureStrengthValue");
+
 const std::string SpellCreatureStrengthName = "creatureStrength";
 const std::string SpellCreatureStrengthNameDisplay = "Creature Strength";
 const std::string SpellCreatureStrengthCooldownKey = "CreatureStrengthCooldown";
@@ -75,7 +80,7 @@ static SpellRegister reg(new SpellCreatureStrengthFactory);
 void SpellCreatureStrength::checkSpellCast(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand)
 {
     Player* player = gameMap->getLocalPlayer();
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureStrengthPrice");
+    int32_t pricePerTarget = CREATURE_STRENGTH_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
@@ -193,13 +198,13 @@ bool SpellCreatureStrength::castSpell(GameMap* gameMap, Player* player, ODPacket
         return false;
     }
 
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureStrengthPrice");
+    int32_t pricePerTarget = CREATURE_STRENGTH_PRICE.get();
 
     if(!player->getSeat()->takeMana(pricePerTarget))
         return false;
 
-    uint32_t duration = ConfigManager::getSingleton().getSpellConfigUInt32("CreatureStrengthDuration");
-    double value = ConfigManager::getSingleton().getSpellConfigDouble("CreatureStrengthValue");
+    uint32_t duration = CREATURE_STRENGTH_DURATION.get();
+    double value = CREATURE_STRENGTH_VALUE.get();
     CreatureEffectStrengthChange* effect = new CreatureEffectStrengthChange(duration, value, "SpellCreatureStrength");
     creature->addCreatureEffect(effect);
 
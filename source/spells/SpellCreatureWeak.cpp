@@ -31,9 +31,14 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CREATURE_WEAK_PRICE(ConfigParamCategory::spells, "CreatureWeakPrice");
+static ConfigParam<uint32_t> CREATURE_WEAK_DURATION(ConfigParamCategory::spells, "CreatureWeakDuration");
+static ConfigParam<double> CREATURE_WEAK_VALUE(ConfigParamCategory::spells, "CreatureWeakValue");
+
 const std::string SpellCreatureWeakName = "creatureWeak";
 const std::string SpellCreatureWeakNameDisplay = "Creature Weak";
 const std::string SpellCreatureWeakCooldownKey = "CreatureWeakCooldown";
@@ -75,7 +80,7 @@ static SpellRegister reg(new SpellCreatureWeakFactory);
 void SpellCreatureWeak::checkSpellCast(GameMap* gameMap, const InputManager& inputManager, InputCommand& inputCommand)
 {
     Player* player = gameMap->getLocalPlayer();
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureWeakPrice");
+    int32_t pricePerTarget = CREATURE_WEAK_PRICE.get();
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
@@ -193,13 +198,13 @@ bool SpellCreatureWeak::castSpell(GameMap* gameMap, Player* player, ODPacket& pa
         return false;
     }
 
-    int32_t pricePerTarget = ConfigManager::getSingleton().getSpellConfigInt32("CreatureWeakPrice");
+    int32_t pricePerTarget = CREATURE_WEAK_PRICE.get();
 
     if(!player->getSeat()->takeMana(pricePerTarget))
         return false;
 
-    uint32_t duration = ConfigManager::getSingleton().getSpellConfigUInt32("CreatureWeakDuration");
-    double value = ConfigManager::getSingleton().getSpellConfigDouble("CreatureWeakValue");
+    uint32_t duration = CREATURE_WEAK_DURATION.get();
+    double value = CREATURE_WEAK_VALUE.get();
     CreatureEffectStrengthChange* effect = new CreatureEffectStrengthChange(duration, value, "SpellCreatureWeak");
     creature->addCreatureEffect(effect);
 
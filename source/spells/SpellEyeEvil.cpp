@@ -27,9 +27,14 @@
 #include "network/ODClient.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> EYE_EVIL_NB_TURNS(ConfigParamCategory::spells, "EyeEvilNbTurns");
+static ConfigParam<uint32_t> EYE_EVIL_RADIUS_TILES(ConfigParamCategory::spells, "EyeEvilRadiusTiles");
+static ConfigParam<int32_t> EYE_EVIL_PRICE(ConfigParamCategory::spells, "EyeEvilPrice");
+
 const std::string SpellEyeEvilName = "eyeEvil";
 const std::string SpellEyeEvilNameDisplay = "Eye of Evil";
 const std::string SpellEyeEvilCooldownKey = "EyeEvilCooldown";
@@ -70,7 +75,7 @@ static SpellRegister reg(new SpellEyeEvilFactory);
 
 SpellEyeEvil::SpellEyeEvil(GameMap* gameMap) :
     Spell(gameMap, SpellManager::getSpellNameFromSpellType(getSpellType()), "FlyingSkull", 0.0,
-        ConfigManager::getSingleton().getSpellConfigInt32("EyeEvilNbTurns"))
+        EYE_EVIL_NB_TURNS.get())
 {
     mPrevAnimationState = "Triggered";
     mPrevAnimationStateLoop = true;
@@ -82,7 +87,7 @@ SpellEyeEvil::~SpellEyeEvil()
 
 void SpellEyeEvil::computeVisibleTiles()
 {
-    uint32_t radius = ConfigManager::getSingleton().getSpellConfigUInt32("EyeEvilRadiusTiles");
+    uint32_t radius = EYE_EVIL_RADIUS_TILES.get();
     Tile* posTile = getPositionTile();
     if(posTile == nullptr)
     {
@@ -104,7 +109,7 @@ void SpellEyeEvil::checkSpellCast(GameMap* gameMap, const InputManager& inputMan
         return;
 
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
-    int32_t price = ConfigManager::getSingleton().getSpellConfigInt32("EyeEvilPrice");
+    int32_t price = EYE_EVIL_PRICE.get();
     if(inputManager.mCommandState == InputCommandState::infoOnly)
     {
         if(playerMana < price)
@@ -147,7 +152,7 @@ bool SpellEyeEvil::castSpell(GameMap* gameMap, Player* player, ODPacket& packet)
         return false;
 
     int32_t playerMana = static_cast<int32_t>(player->getSeat()->getMana());
-    int32_t manaCost = ConfigManager::getSingleton().getSpellConfigInt32("EyeEvilPrice");
+    int32_t manaCost = EYE_EVIL_PRICE.get();
     if(playerMana < manaCost)
         return false;
 
@@ -30,9 +30,13 @@
 #include "spells/SpellType.h"
 #include "spells/SpellManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> SUMMON_WORKER_NB_FREE(ConfigParamCategory::spells, "SummonWorkerNbFree");
+static ConfigParam<int32_t> SUMMON_WORKER_BASE_PRICE(ConfigParamCategory::spells, "SummonWorkerBasePrice");
+
 const std::string SpellSummonWorkerName = "summonWorker";
 const std::string SpellSummonWorkerNameDisplay = "Summon worker";
 const std::string SpellSummonWorkerCooldownKey = "SummonWorkerCooldown";
@@ -97,9 +101,9 @@ void SpellSummonWorker::checkSpellCast(GameMap* gameMap, const InputManager& inp
     gameMap->playerSelects(targets, inputManager.mXPos, inputManager.mYPos, inputManager.mLStartDragX,
         inputManager.mLStartDragY, SelectionTileAllowed::groundClaimedAllied, SelectionEntityWanted::tiles, player);
 
-    int32_t nbFreeWorkers = ConfigManager::getSingleton().getSpellConfigInt32("SummonWorkerNbFree");
+    int32_t nbFreeWorkers = SUMMON_WORKER_NB_FREE.get();
     int32_t nbWorkers = player->getSeat()->getNumCreaturesWorkers();
-    int32_t pricePerWorker = ConfigManager::getSingleton().getSpellConfigInt32("SummonWorkerBasePrice");
+    int32_t pricePerWorker = SUMMON_WORKER_BASE_PRICE.get();
     if(nbWorkers > nbFreeWorkers)
         pricePerWorker *= std::pow(2, nbWorkers - nbFreeWorkers);
 
@@ -187,9 +191,9 @@ bool SpellSummonWorker::summonWorkersOnTiles(GameMap* gameMap, Player* player, c
         return false;
     }
 
-    int32_t nbFreeWorkers = ConfigManager::getSingleton().getSpellConfigInt32("SummonWorkerNbFree");
+    int32_t nbFreeWorkers = SUMMON_WORKER_NB_FREE.get();
     int32_t nbWorkers = player->getSeat()->getNumCreaturesWorkers();
-    int32_t pricePerWorker = ConfigManager::getSingleton().getSpellConfigInt32("SummonWorkerBasePrice");
+    int32_t pricePerWorker = SUMMON_WORKER_BASE_PRICE.get();
     if(nbWorkers > nbFreeWorkers)
         pricePerWorker *= std::pow(2, nbWorkers - nbFreeWorkers);
 
@@ -238,11 +242,11 @@ bool SpellSummonWorker::summonWorkersOnTiles(GameMap* gameMap, Player* player, c
 int32_t SpellSummonWorker::getNextWorkerPriceForPlayer(GameMap* gameMap, Player* player)
 {
     int32_t nbWorkers = player->getSeat()->getNumCreaturesWorkers();
-    int32_t nbFreeWorkers = ConfigManager::getSingleton().getSpellConfigInt32("SummonWorkerNbFree");
+    int32_t nbFreeWorkers = SUMMON_WORKER_NB_FREE.get();
     if(nbWorkers < nbFreeWorkers)
         return 0;
 
-    int32_t price = ConfigManager::getSingleton().getSpellConfigInt32("SummonWorkerBasePrice");
+    int32_t price = SUMMON_WORKER_BASE_PRICE.get();
     price *= std::pow(2, nbWorkers - nbFreeWorkers);
 
     return price;
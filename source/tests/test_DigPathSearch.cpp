@@ -0,0 +1,317 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE DigPathSearch
+#include "BoostTestTargetConfig.h"
+
+#include "gamemap/DigPathSearch.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+const double WALK_COST = 1.0;
+const double DIG_COST = 10.0;
+
+//! \brief Simple grid. '.' is walkable, '#' has to be dug and 'X' cannot be crossed
+struct Grid
+{
+    int32_t mSizeX;
+    int32_t mSizeY;
+    std::string mTiles;
+
+    double cost(int32_t x, int32_t y) const
+    {
+        switch(mTiles[x + y * mSizeX])
+        {
+            case '.':
+                return WALK_COST;
+            case '#':
+                return WALK_COST + DIG_COST;
+            default:
+                return -1.0;
+        }
+    }
+};
+
+Grid buildGrid(const std::vector<std::string>& lines)
+{
+    Grid grid;
+    grid.mSizeY = static_cast<int32_t>(lines.size());
+    grid.mSizeX = static_cast<int32_t>(lines[0].size());
+    for(const std::string& line : lines)
+        grid.mTiles += line;
+
+    return grid;
+}
+
+//! \brief Reference cost computed with a plain Dijkstra. Returns -1 if the destination cannot be reached
+double referenceCost(const Grid& grid, int32_t startX, int32_t startY, int32_t destX, int32_t destY)
+{
+    typedef std::pair<double, int32_t> Entry;
+    std::vector<double> costs(grid.mTiles.size(), -1.0);
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    costs[startX + startY * grid.mSizeX] = grid.cost(startX, startY);
+    queue.push(Entry(costs[startX + startY * grid.mSizeX], startX + startY * grid.mSizeX));
+    while(!queue.empty())
+    {
+        Entry entry = queue.top();
+        queue.pop();
+        if(entry.first > costs[entry.second])
+            continue;
+
+        int32_t x = entry.second % grid.mSizeX;
+        int32_t y = entry.second / grid.mSizeX;
+        const int32_t neighbors[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+        for(const int32_t* neighbor : neighbors)
+        {
+            int32_t neighX = x + neighbor[0];
+            int32_t neighY = y + neighbor[1];
+            if((neighX < 0) || (neighX >= grid.mSizeX) || (neighY < 0) || (neighY >= grid.mSizeY))
+                continue;
+
+            double cost = grid.cost(neighX, neighY);
+            if(cost < 0.0)
+                continue;
+
+            int32_t index = neighX + neighY * grid.mSizeX;
+            cost += entry.first;
+            if((costs[index] >= 0.0) && (costs[index] <= cost))
+                continue;
+
+            costs[index] = cost;
+            queue.push(Entry(cost, index));
+        }
+    }
+
+    return costs[destX + destY * grid.mSizeX];
+}
+
+//! \brief Checks the path is made of adjacent crossable tiles and returns its cost
+double checkPath(const Grid& grid, const std::vector<uint32_t>& path)
+{
+    double cost = 0.0;
+    for(uint32_t i = 0; i < path.size(); ++i)
+    {
+        int32_t x = static_cast<int32_t>(path[i]) % grid.mSizeX;
+        int32_t y = static_cast<int32_t>(path[i]) / grid.mSizeX;
+        BOOST_CHECK(grid.cost(x, y) >= 0.0);
+        cost += grid.cost(x, y);
+        if(i == 0)
+            continue;
+
+        int32_t prevX = static_cast<int32_t>(path[i - 1]) % grid.mSizeX;
+        int32_t prevY = static_cast<int32_t>(path[i - 1]) / grid.mSizeX;
+        BOOST_CHECK(std::abs(x - prevX) + std::abs(y - prevY) == 1);
+    }
+    return cost;
+}
+
+uint32_t countTilesToDig(const Grid& grid, const std::vector<uint32_t>& path)
+{
+    uint32_t nb = 0;
+    for(uint32_t index : path)
+    {
+        if(grid.mTiles[index] == '#')
+            ++nb;
+    }
+    return nb;
+}
+
+//! \brief Reads the tiles of a level file. Tiles not listed are full dirt. Walls (dirt/gold with
+//! fullness) should be dug, rock, water, lava and gems cannot be crossed by a digger walking on ground
+bool readLevelGrid(const std::string& fileName, Grid& grid)
+{
+    std::ifstream file(fileName);
+    if(!file.is_open())
+        return false;
+
+    std::string line;
+    while(std::getline(file, line))
+    {
+        if(line.compare(0, 7, "[Tiles]") == 0)
+            break;
+    }
+
+    bool isSizeRead = false;
+    while(std::getline(file, line))
+    {
+        std::string::size_type comment = line.find('#');
+        if(comment != std::string::npos)
+            line.erase(comment);
+
+        std::stringstream ss(line);
+        if(!isSizeRead)
+        {
+            if(!(ss >> grid.mSizeX))
+                continue;
+
+            if(!(std::getline(file, line) && (std::stringstream(line) >> grid.mSizeY)))
+                return false;
+
+            grid.mTiles.assign(static_cast<size_t>(grid.mSizeX * grid.mSizeY), '#');
+            isSizeRead = true;
+            continue;
+        }
+
+        std::string first;
+        if(!(ss >> first))
+            continue;
+
+        if(first == "[/Tiles]")
+            return true;
+
+        int32_t x = std::stoi(first);
+        int32_t y;
+        int32_t type;
+        double fullness = 0.0;
+        if(!(ss >> y >> type))
+            return false;
+        ss >> fullness;
+
+        char tile;
+        if((type == 1) || (type == 2))
+            tile = (fullness > 0.0) ? '#' : '.';
+        else
+            tile = 'X';
+
+        grid.mTiles[x + y * grid.mSizeX] = tile;
+    }
+
+    return false;
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_DigPathSearchGrid)
+{
+    DigPathSearch search;
+    std::vector<uint32_t> path;
+
+    // The detour through the walkable tiles is cheaper than digging the wall
+    Grid detour = buildGrid({
+        "........",
+        ".######.",
+        ".#....#.",
+        ".######.",
+        "........"});
+    auto detourCost = [&detour](int32_t x, int32_t y) { return detour.cost(x, y); };
+    BOOST_CHECK(search.search(detour.mSizeX, detour.mSizeY, 0, 2, 7, 2, WALK_COST, detourCost, path));
+    BOOST_CHECK(countTilesToDig(detour, path) == 0);
+    BOOST_CHECK(checkPath(detour, path) == referenceCost(detour, 0, 2, 7, 2));
+
+    // Digging one tile is cheaper than the long detour
+    Grid wall = buildGrid({
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "...#...",
+        "......."});
+    auto wallCost = [&wall](int32_t x, int32_t y) { return wall.cost(x, y); };
+    BOOST_CHECK(search.search(wall.mSizeX, wall.mSizeY, 0, 0, 6, 0, WALK_COST, wallCost, path));
+    BOOST_CHECK(countTilesToDig(wall, path) == 1);
+    BOOST_CHECK(checkPath(wall, path) == referenceCost(wall, 0, 0, 6, 0));
+
+    // Unreachable destination: the path leads as close as possible
+    Grid blocked = buildGrid({
+        "...X...",
+        "...X...",
+        "...X..."});
+    auto blockedCost = [&blocked](int32_t x, int32_t y) { return blocked.cost(x, y); };
+    BOOST_CHECK(!search.search(blocked.mSizeX, blocked.mSizeY, 0, 1, 6, 1, WALK_COST, blockedCost, path));
+    BOOST_CHECK(!path.empty());
+    BOOST_CHECK(path.back() == static_cast<uint32_t>(2 + 1 * blocked.mSizeX));
+    checkPath(blocked, path);
+
+    // Not crossable start tile
+    BOOST_CHECK(!search.search(blocked.mSizeX, blocked.mSizeY, 3, 1, 6, 1, WALK_COST, blockedCost, path));
+    BOOST_CHECK(path.empty());
+
+    // The number of expanded tiles is bounded
+    DigPathSearch boundedSearch(10);
+    BOOST_CHECK(!boundedSearch.search(wall.mSizeX, wall.mSizeY, 0, 0, 6, 0, WALK_COST, wallCost, path));
+    BOOST_CHECK(boundedSearch.getNbExpandedTiles() <= 10);
+}
+
+BOOST_AUTO_TEST_CASE(test_DigPathSearchLevels)
+{
+    boost::filesystem::path levelsPath = boost::filesystem::path(__FILE__).parent_path() / ".." / ".." / "levels";
+    BOOST_REQUIRE(boost::filesystem::is_directory(levelsPath));
+
+    uint32_t nbLevels = 0;
+    DigPathSearch search(0xFFFFFFFF);
+    std::vector<uint32_t> path;
+    for(boost::filesystem::recursive_directory_iterator it(levelsPath), end; it != end; ++it)
+    {
+        if(it->path().extension() != ".level")
+            continue;
+
+        Grid grid;
+        if(!readLevelGrid(it->path().string(), grid))
+            continue;
+
+        ++nbLevels;
+        auto gridCost = [&grid](int32_t x, int32_t y) { return grid.cost(x, y); };
+
+        // We search paths between walkable tiles spread over the map
+        std::vector<int32_t> walkableTiles;
+        for(int32_t i = 0; i < static_cast<int32_t>(grid.mTiles.size()); ++i)
+        {
+            if(grid.mTiles[i] == '.')
+                walkableTiles.push_back(i);
+        }
+        if(walkableTiles.size() < 2)
+            continue;
+
+        const uint32_t nbSearches = 8;
+        for(uint32_t i = 0; i < nbSearches; ++i)
+        {
+            int32_t start = walkableTiles[(i * walkableTiles.size()) / nbSearches];
+            int32_t dest = walkableTiles[walkableTiles.size() - 1 - (i * walkableTiles.size()) / (2 * nbSearches)];
+            int32_t startX = start % grid.mSizeX;
+            int32_t startY = start / grid.mSizeX;
+            int32_t destX = dest % grid.mSizeX;
+            int32_t destY = dest / grid.mSizeX;
+            double expectedCost = referenceCost(grid, startX, startY, destX, destY);
+            bool isFound = search.search(grid.mSizeX, grid.mSizeY, startX, startY, destX, destY,
+                WALK_COST, gridCost, path);
+            BOOST_CHECK(isFound == (expectedCost >= 0.0));
+            if(!isFound)
+                continue;
+
+            BOOST_CHECK(path.front() == static_cast<uint32_t>(start));
+            BOOST_CHECK(path.back() == static_cast<uint32_t>(dest));
+            BOOST_CHECK(checkPath(grid, path) == expectedCost);
+        }
+    }
+
+    BOOST_CHECK(nbLevels > 0);
+}
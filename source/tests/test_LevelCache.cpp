@@ -0,0 +1,209 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "gamemap/LevelCache.h"
+#include "gamemap/LevelTokenizer.h"
+#include "utils/LogManager.h"
+#include "utils/LogSinkConsole.h"
+
+#define BOOST_TEST_MODULE LevelCache
+#include "BoostTestTargetConfig.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+static const std::string LEVEL_CONTENT =
+    "# Level used by the LevelCache tests\n"
+    "0.7.0 # version\n"
+    "[Seat]\n"
+    "name \"My level name\" # trailing comment\n"
+    "   \n"
+    "\t\r\n"
+    "[Tiles]\n"
+    "4 3\n"
+    "0 0 1 100.0\n"
+    "1 0 2 0.0 1   # claimed tile\n"
+    "2 0 3\n"
+    "[/Tiles]\n";
+
+//! \brief Returns the directory where the test files are written. Like the level cache directory,
+//! it ends with a separator
+static std::string getTestDirectory()
+{
+    boost::filesystem::path dir = boost::filesystem::temp_directory_path() / "od_test_LevelCache";
+    boost::filesystem::create_directories(dir);
+    return dir.string() + "/";
+}
+
+static void writeFile(const std::string& fileName, const std::string& content)
+{
+    std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+//! \brief Reads the tiles of the given level file as the level loader does
+static bool readTiles(const std::string& fileName, LevelCache::CompiledTiles& tiles)
+{
+    LevelTokenizer levelFile(fileName);
+    if(!levelFile.isOpen())
+        return false;
+
+    std::string token;
+    while(levelFile.nextToken(token))
+    {
+        if(token == "[Tiles]")
+            return LevelCache::readTilesFromText(levelFile, tiles);
+    }
+
+    return false;
+}
+
+BOOST_AUTO_TEST_CASE(test_Tokenizer)
+{
+    LogManager logMgr;
+    logMgr.addSink(std::unique_ptr<LogSink>(new LogSinkConsole()));
+
+    std::string fileName = getTestDirectory() + "tokenizer.level";
+    writeFile(fileName, LEVEL_CONTENT);
+
+    LevelTokenizer levelFile(fileName);
+    BOOST_REQUIRE(levelFile.isOpen());
+    BOOST_CHECK(levelFile.getSize() == LEVEL_CONTENT.size());
+
+    // Comments are skipped
+    std::string token;
+    BOOST_CHECK(levelFile.nextToken(token));
+    BOOST_CHECK(token == "0.7.0");
+    BOOST_CHECK(levelFile.isEndOfLine());
+    BOOST_CHECK(levelFile.nextToken(token));
+    BOOST_CHECK(token == "[Seat]");
+
+    // Quoted values are read by line, without the comment
+    std::string line;
+    BOOST_CHECK(levelFile.nextLine(line));
+    BOOST_CHECK(line.empty());
+    BOOST_CHECK(levelFile.nextToken(token));
+    BOOST_CHECK(token == "name");
+    BOOST_CHECK(levelFile.nextLine(line));
+    BOOST_CHECK(line == " \"My level name\" ");
+
+    // Blank lines are skipped. A token is not a number
+    int32_t value = 0;
+    BOOST_CHECK(!levelFile.nextInt32(value));
+    BOOST_CHECK(levelFile.nextToken(token));
+    BOOST_CHECK(token == "[Tiles]");
+
+    LevelCache::CompiledTiles tiles;
+    BOOST_REQUIRE(LevelCache::readTilesFromText(levelFile, tiles));
+    BOOST_CHECK(tiles.mMapSizeX == 4);
+    BOOST_CHECK(tiles.mMapSizeY == 3);
+    BOOST_REQUIRE(tiles.mTiles.size() == 3);
+
+    BOOST_CHECK(tiles.mTiles[0].mX == 0);
+    BOOST_CHECK(tiles.mTiles[0].mY == 0);
+    BOOST_CHECK(tiles.mTiles[0].mType == 1);
+    BOOST_CHECK(tiles.mTiles[0].mFullness == 100.0);
+    BOOST_CHECK(tiles.mTiles[0].mHasSeatId == 0);
+
+    BOOST_CHECK(tiles.mTiles[1].mX == 1);
+    BOOST_CHECK(tiles.mTiles[1].mType == 2);
+    BOOST_CHECK(tiles.mTiles[1].mFullness == 0.0);
+    BOOST_CHECK(tiles.mTiles[1].mHasSeatId == 1);
+    BOOST_CHECK(tiles.mTiles[1].mSeatId == 1);
+
+    BOOST_CHECK(tiles.mTiles[2].mX == 2);
+    BOOST_CHECK(tiles.mTiles[2].mType == 3);
+    BOOST_CHECK(tiles.mTiles[2].mFullness == 0.0);
+    BOOST_CHECK(tiles.mTiles[2].mHasSeatId == 0);
+
+    BOOST_CHECK(tiles.mTilesEndOffset == levelFile.getPosition());
+    BOOST_CHECK(!levelFile.nextToken(token));
+}
+
+BOOST_AUTO_TEST_CASE(test_CompiledTiles)
+{
+    LogManager logMgr;
+    logMgr.addSink(std::unique_ptr<LogSink>(new LogSinkConsole()));
+
+    std::string fileName = getTestDirectory() + "compiled.level";
+    writeFile(fileName, LEVEL_CONTENT);
+
+    LevelCache::CompiledTiles textTiles;
+    BOOST_REQUIRE(readTiles(fileName, textTiles));
+
+    uint64_t levelSize;
+    uint64_t levelChecksum;
+    {
+        LevelTokenizer levelFile(fileName);
+        BOOST_REQUIRE(levelFile.isOpen());
+        levelSize = levelFile.getSize();
+        levelChecksum = levelFile.computeChecksum();
+    }
+
+    std::string cacheDir = getTestDirectory();
+    std::string compiledFileName = LevelCache::getCompiledLevelPath(cacheDir, fileName);
+    BOOST_CHECK(compiledFileName.compare(0, cacheDir.size(), cacheDir) == 0);
+    BOOST_CHECK(compiledFileName.size() > 9);
+    BOOST_CHECK(compiledFileName.compare(compiledFileName.size() - 9, 9, ".levelbin") == 0);
+
+    // The compiled file gives the same tiles as the text file
+    BOOST_REQUIRE(LevelCache::saveCompiledTiles(compiledFileName, levelSize, levelChecksum, textTiles));
+    LevelCache::CompiledTiles binTiles;
+    BOOST_REQUIRE(LevelCache::loadCompiledTiles(compiledFileName, levelSize, levelChecksum, binTiles));
+    BOOST_CHECK(binTiles.mMapSizeX == textTiles.mMapSizeX);
+    BOOST_CHECK(binTiles.mMapSizeY == textTiles.mMapSizeY);
+    BOOST_CHECK(binTiles.mTilesEndOffset == textTiles.mTilesEndOffset);
+    BOOST_REQUIRE(binTiles.mTiles.size() == textTiles.mTiles.size());
+    for(uint32_t i = 0; i < textTiles.mTiles.size(); ++i)
+    {
+        const LevelCache::TileRecord& text = textTiles.mTiles[i];
+        const LevelCache::TileRecord& bin = binTiles.mTiles[i];
+        BOOST_CHECK(bin.mX == text.mX);
+        BOOST_CHECK(bin.mY == text.mY);
+        BOOST_CHECK(bin.mType == text.mType);
+        BOOST_CHECK(bin.mFullness == text.mFullness);
+        BOOST_CHECK(bin.mHasSeatId == text.mHasSeatId);
+        BOOST_CHECK(bin.mSeatId == text.mSeatId);
+    }
+
+    // If the level file changes, the compiled file is not used anymore
+    writeFile(fileName, LEVEL_CONTENT + "# Changed\n");
+    {
+        LevelTokenizer levelFile(fileName);
+        BOOST_REQUIRE(levelFile.isOpen());
+        BOOST_CHECK(levelFile.computeChecksum() != levelChecksum);
+        LevelCache::CompiledTiles tiles;
+        BOOST_CHECK(!LevelCache::loadCompiledTiles(compiledFileName, levelFile.getSize(), levelFile.computeChecksum(), tiles));
+    }
+    LevelCache::CompiledTiles tiles;
+    BOOST_CHECK(!LevelCache::loadCompiledTiles(compiledFileName, levelSize, levelChecksum + 1, tiles));
+    BOOST_CHECK(!LevelCache::loadCompiledTiles(compiledFileName, levelSize + 1, levelChecksum, tiles));
+
+    // Compiled files from another format version are not used either. The version follows the 4 bytes magic
+    {
+        std::fstream file(compiledFileName.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+        BOOST_REQUIRE(file.good());
+        file.seekp(4);
+        uint32_t version = 0xFFFFFFFF;
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    BOOST_CHECK(!LevelCache::loadCompiledTiles(compiledFileName, levelSize, levelChecksum, tiles));
+
+    boost::filesystem::remove_all(cacheDir);
+}
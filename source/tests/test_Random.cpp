@@ -17,6 +17,8 @@
 
 #include "utils/Random.h"
 
+#include <vector>
+
 #define BOOST_TEST_MODULE Random
 #include "BoostTestTargetConfig.h"
 
@@ -25,3 +27,16 @@ BOOST_AUTO_TEST_CASE(test_Random)
     Random::initialize();
     BOOST_CHECK (Random::Int(1, 2 ) <= 2);
 }
+
+BOOST_AUTO_TEST_CASE(test_RandomSeed)
+{
+    // The same seed should give the same numbers
+    std::vector<int> values;
+    Random::initialize(42);
+    for(int i = 0; i < 10; ++i)
+        values.push_back(Random::Int(0, 1000));
+
+    Random::initialize(42);
+    for(int i = 0; i < 10; ++i)
+        BOOST_CHECK(Random::Int(0, 1000) == values[i]);
+}
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "gamemap/TileChangeJournal.h"
+
+#define BOOST_TEST_MODULE TileChangeJournal
+#include "BoostTestTargetConfig.h"
+
+// The journal does not care about the tile types values. We do not include Tile.h to avoid
+// depending on the rendering
+enum class TileType
+{
+    dirt = 1,
+    gold = 2
+};
+
+static TileChangeJournal::TileChange makeChange(int x, TileType oldType, TileType newType)
+{
+    TileChangeJournal::TileChange change;
+    change.mX = x;
+    change.mY = 0;
+    change.mOldType = oldType;
+    change.mOldFullness = 100.0;
+    change.mOldSeatId = -1;
+    change.mNewType = newType;
+    change.mNewFullness = 0.0;
+    change.mNewSeatId = 1;
+    return change;
+}
+
+//! \brief Undoes the last batch as if every change could be applied
+static bool undo(TileChangeJournal& journal, std::vector<TileChangeJournal::TileChange>& batch)
+{
+    if(!journal.getUndoBatch(batch))
+        return false;
+
+    std::vector<TileChangeJournal::TileChange> applied = batch;
+    journal.undoApplied(applied);
+    return true;
+}
+
+static bool redo(TileChangeJournal& journal, std::vector<TileChangeJournal::TileChange>& batch)
+{
+    if(!journal.getRedoBatch(batch))
+        return false;
+
+    std::vector<TileChangeJournal::TileChange> applied = batch;
+    journal.redoApplied(applied);
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(test_UndoRedo)
+{
+    TileChangeJournal journal(2);
+    std::vector<TileChangeJournal::TileChange> batch;
+    BOOST_CHECK(!undo(journal, batch));
+    BOOST_CHECK(!redo(journal, batch));
+
+    for(int i = 0; i < 3; ++i)
+    {
+        batch.push_back(makeChange(i, TileType::dirt, TileType::gold));
+        journal.pushBatch(batch);
+        BOOST_CHECK(batch.empty());
+    }
+
+    // Only the 2 last batches are kept
+    BOOST_CHECK(undo(journal, batch));
+    BOOST_CHECK(batch.size() == 1 && batch[0].mX == 2);
+    BOOST_CHECK(undo(journal, batch));
+    BOOST_CHECK(batch.size() == 1 && batch[0].mX == 1);
+    BOOST_CHECK(!undo(journal, batch));
+
+    BOOST_CHECK(redo(journal, batch));
+    BOOST_CHECK(batch.size() == 1 && batch[0].mX == 1);
+
+    // A new batch clears the redo history
+    batch.clear();
+    batch.push_back(makeChange(5, TileType::gold, TileType::dirt));
+    journal.pushBatch(batch);
+    BOOST_CHECK(!redo(journal, batch));
+    BOOST_CHECK(undo(journal, batch));
+    BOOST_CHECK(batch.size() == 1 && batch[0].mX == 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_PartialUndo)
+{
+    TileChangeJournal journal(2);
+    std::vector<TileChangeJournal::TileChange> batch;
+    for(int i = 0; i < 3; ++i)
+        batch.push_back(makeChange(i, TileType::dirt, TileType::gold));
+    journal.pushBatch(batch);
+
+    // The change on tile 1 cannot be undone. It stays in the undo history
+    BOOST_CHECK(journal.getUndoBatch(batch));
+    BOOST_CHECK(batch.size() == 3);
+    batch.erase(batch.begin() + 1);
+    journal.undoApplied(batch);
+    BOOST_CHECK(batch.empty());
+
+    BOOST_CHECK(journal.getUndoBatch(batch));
+    BOOST_CHECK(batch.size() == 1 && batch[0].mX == 1);
+
+    // Only the undone changes can be redone
+    BOOST_CHECK(journal.getRedoBatch(batch));
+    BOOST_CHECK(batch.size() == 2 && batch[0].mX == 0 && batch[1].mX == 2);
+
+    // Nothing could be redone: the history does not change
+    std::vector<TileChangeJournal::TileChange> applied;
+    journal.redoApplied(applied);
+    BOOST_CHECK(journal.getRedoBatch(batch));
+    BOOST_CHECK(batch.size() == 2);
+
+    journal.redoApplied(batch);
+    BOOST_CHECK(!journal.getRedoBatch(batch));
+    BOOST_CHECK(journal.getUndoBatch(batch));
+    BOOST_CHECK(batch.size() == 2 && batch[0].mX == 0 && batch[1].mX == 2);
+}
@@ -25,9 +25,17 @@
 #include "network/ODPacket.h"
 #include "traps/TrapManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Random.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> BOULDER_COST_PER_TILE(ConfigParamCategory::traps, "BoulderCostPerTile");
+static ConfigParam<uint32_t> BOULDER_RELOAD_TURNS(ConfigParamCategory::traps, "BoulderReloadTurns");
+static ConfigParam<double> BOULDER_DAMAGE_PER_HIT_MIN(ConfigParamCategory::traps, "BoulderDamagePerHitMin");
+static ConfigParam<double> BOULDER_DAMAGE_PER_HIT_MAX(ConfigParamCategory::traps, "BoulderDamagePerHitMax");
+static ConfigParam<uint32_t> BOULDER_NB_SHOOTS_BEFORE_DEACTIVATION(ConfigParamCategory::traps, "BoulderNbShootsBeforeDeactivation");
+static ConfigParam<double> BOULDER_SPEED(ConfigParamCategory::traps, "BoulderSpeed");
+
 const std::string TrapBoulderName = "Boulder";
 const std::string TrapBoulderNameDisplay = "Boulder trap";
 const TrapType TrapBoulder::mTrapType = TrapType::boulder;
@@ -46,7 +54,7 @@ class TrapBoulderFactory : public TrapFactory
     { return TrapBoulderNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getTrapConfigInt32("BoulderCostPerTile"); }
+    { return BOULDER_COST_PER_TILE.get(); }
 
     const std::string& getMeshName() const override
     {
@@ -114,10 +122,10 @@ static TrapRegister reg(new TrapBoulderFactory);
 TrapBoulder::TrapBoulder(GameMap* gameMap) :
     Trap(gameMap)
 {
-    mReloadTime = ConfigManager::getSingleton().getTrapConfigUInt32("BoulderReloadTurns");
-    mMinDamage = ConfigManager::getSingleton().getTrapConfigDouble("BoulderDamagePerHitMin");
-    mMaxDamage = ConfigManager::getSingleton().getTrapConfigDouble("BoulderDamagePerHitMax");
-    mNbShootsBeforeDeactivation = ConfigManager::getSingleton().getTrapConfigUInt32("BoulderNbShootsBeforeDeactivation");
+    mReloadTime = BOULDER_RELOAD_TURNS.get();
+    mMinDamage = BOULDER_DAMAGE_PER_HIT_MIN.get();
+    mMaxDamage = BOULDER_DAMAGE_PER_HIT_MAX.get();
+    mNbShootsBeforeDeactivation = BOULDER_NB_SHOOTS_BEFORE_DEACTIVATION.get();
     setMeshName("");
 }
 
@@ -150,7 +158,7 @@ bool TrapBoulder::shoot(Tile* tile)
     position.z = 0;
     direction.normalise();
     MissileBoulder* missile = new MissileBoulder(getGameMap(), getSeat(), getName(), "Boulder",
-        direction, ConfigManager::getSingleton().getTrapConfigDouble("BoulderSpeed"),
+        direction, BOULDER_SPEED.get(),
         Random::Double(mMinDamage, mMaxDamage), nullptr, true);
     missile->addToGameMap();
     missile->createMesh();
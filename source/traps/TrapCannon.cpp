@@ -17,18 +17,32 @@
 
 #include "traps/TrapCannon.h"
 
+#include "entities/Creature.h"
 #include "entities/Tile.h"
 #include "entities/TrapEntity.h"
 #include "entities/MissileOneHit.h"
 #include "game/Player.h"
+#include "game/Seat.h"
 #include "gamemap/GameMap.h"
 #include "network/ODPacket.h"
 #include "sound/SoundEffectsManager.h"
 #include "traps/TrapManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Random.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CANNON_COST_PER_TILE(ConfigParamCategory::traps, "CannonCostPerTile");
+static ConfigParam<uint32_t> CANNON_RELOAD_TURNS(ConfigParamCategory::traps, "CannonReloadTurns");
+static ConfigParam<uint32_t> CANNON_RANGE(ConfigParamCategory::traps, "CannonRange");
+static ConfigParam<double> CANNON_DAMAGE_PER_HIT_MIN(ConfigParamCategory::traps, "CannonDamagePerHitMin");
+static ConfigParam<double> CANNON_DAMAGE_PER_HIT_MAX(ConfigParamCategory::traps, "CannonDamagePerHitMax");
+static ConfigParam<uint32_t> CANNON_NB_SHOOTS_BEFORE_DEACTIVATION(ConfigParamCategory::traps, "CannonNbShootsBeforeDeactivation");
+static ConfigParam<double> CANNON_SPEED(ConfigParamCategory::traps, "CannonSpeed");
+static ConfigParam<uint32_t> CANNON_PHY_DEF(ConfigParamCategory::traps, "CannonPhyDef");
+static ConfigParam<uint32_t> CANNON_MAG_DEF(ConfigParamCategory::traps, "CannonMagDef");
+static ConfigParam<uint32_t> CANNON_ELE_DEF(ConfigParamCategory::traps, "CannonEleDef");
+
 const std::string TrapCannonName = "Cannon";
 const std::string TrapCannonNameDisplay = "Cannon trap";
 const TrapType TrapCannon::mTrapType = TrapType::cannon;
@@ -47,7 +61,7 @@ class TrapCannonFactory : public TrapFactory
     { return TrapCannonNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getTrapConfigInt32("CannonCostPerTile"); }
+    { return CANNON_COST_PER_TILE.get(); }
 
     const std::string& getMeshName() const override
     {
@@ -118,24 +132,60 @@ TrapCannon::TrapCannon(GameMap* gameMap) :
     Trap(gameMap),
     mRange(0)
 {
-    mReloadTime = ConfigManager::getSingleton().getTrapConfigUInt32("CannonReloadTurns");
-    mRange = ConfigManager::getSingleton().getTrapConfigUInt32("CannonRange");
-    mMinDamage = ConfigManager::getSingleton().getTrapConfigDouble("CannonDamagePerHitMin");
-    mMaxDamage = ConfigManager::getSingleton().getTrapConfigDouble("CannonDamagePerHitMax");
-    mNbShootsBeforeDeactivation = ConfigManager::getSingleton().getTrapConfigUInt32("CannonNbShootsBeforeDeactivation");
+    mReloadTime = CANNON_RELOAD_TURNS.get();
+    mRange = CANNON_RANGE.get();
+    mMinDamage = CANNON_DAMAGE_PER_HIT_MIN.get();
+    mMaxDamage = CANNON_DAMAGE_PER_HIT_MAX.get();
+    mNbShootsBeforeDeactivation = CANNON_NB_SHOOTS_BEFORE_DEACTIVATION.get();
     setMeshName("");
 }
 
 bool TrapCannon::shoot(Tile* tile)
 {
-    std::vector<Tile*> visibleTiles = getGameMap()->visibleTiles(tile->getX(), tile->getY(), mRange);
-    std::vector<GameEntity*> enemyObjects = getGameMap()->getVisibleCreatures(visibleTiles, getSeat(), true);
+    TrapCannonTileData* tileData = static_cast<TrapCannonTileData*>(mTileData.at(tile));
+    int range = static_cast<int>(mRange);
+    uint32_t visionVersion = getGameMap()->getVisionVersion(tile->getX(), tile->getY(), range);
+    if(!tileData->mIsVisionComputed || (tileData->mVisionVersion != visionVersion))
+        computeVision(*tile, *tileData, visionVersion);
+
+    // There are usually far less creatures on the map than tiles within range. We look for the
+    // enemy creatures standing on a tile visible from the trap
+    int size = 2 * range + 1;
+    mTargets.clear();
+    for(Creature* creature : getGameMap()->getCreatures())
+    {
+        if(!creature->getIsOnMap())
+            continue;
+
+        if((creature->getSeat() == nullptr) || getSeat()->isAlliedSeat(creature->getSeat()))
+            continue;
+
+        if(!creature->isAlive())
+            continue;
+
+        Tile* creatureTile = creature->getPositionTile();
+        if(creatureTile == nullptr)
+            continue;
+
+        int diffX = creatureTile->getX() - tile->getX() + range;
+        int diffY = creatureTile->getY() - tile->getY() + range;
+        if((diffX < 0) || (diffX >= size) || (diffY < 0) || (diffY >= size))
+            continue;
+
+        if(!tileData->mVisibleTiles[diffX * size + diffY])
+            continue;
+
+        if(!creature->isAttackable(creatureTile, getSeat()))
+            continue;
+
+        mTargets.push_back(creature);
+    }
 
-    if(enemyObjects.empty())
+    if(mTargets.empty())
         return false;
 
     // Select an enemy to shoot at.
-    GameEntity* targetEnemy = enemyObjects[Random::Uint(0, enemyObjects.size()-1)];
+    Creature* targetEnemy = mTargets[Random::Uint(0, mTargets.size()-1)];
 
     // Create the cannonball to move toward the enemy creature.
     Ogre::Vector3 direction(static_cast<Ogre::Real>(targetEnemy->getCoveredTile(0)->getX()),
@@ -149,7 +199,7 @@ bool TrapCannon::shoot(Tile* tile)
     direction = direction - position;
     direction.normalise();
     MissileOneHit* missile = new MissileOneHit(getGameMap(), getSeat(), getName(), "Cannonball",
-        "", direction, ConfigManager::getSingleton().getTrapConfigDouble("CannonSpeed"),
+        "", direction, CANNON_SPEED.get(),
         Random::Double(mMinDamage, mMaxDamage), 0.0, 0.0, nullptr, false, false, true);
     missile->addToGameMap();
     missile->createMesh();
@@ -164,6 +214,26 @@ bool TrapCannon::shoot(Tile* tile)
     return true;
 }
 
+void TrapCannon::computeVision(Tile& tile, TrapCannonTileData& tileData, uint32_t visionVersion) const
+{
+    int range = static_cast<int>(mRange);
+    int size = 2 * range + 1;
+    tileData.mIsVisionComputed = true;
+    tileData.mVisionVersion = visionVersion;
+    tileData.mVisibleTiles.assign(size * size, false);
+    for(Tile* visibleTile : getGameMap()->visibleTiles(tile.getX(), tile.getY(), range))
+    {
+        int diffX = visibleTile->getX() - tile.getX() + range;
+        int diffY = visibleTile->getY() - tile.getY() + range;
+        tileData.mVisibleTiles[diffX * size + diffY] = true;
+    }
+}
+
+TrapCannonTileData* TrapCannon::createTileData(Tile* tile)
+{
+    return new TrapCannonTileData;
+}
+
 TrapEntity* TrapCannon::getTrapEntity(Tile* tile)
 {
     return new TrapEntity(getGameMap(), *this, reg.getTrapFactory()->getMeshName(), tile, 90.0, false, isActivated(tile) ? 1.0f : 0.5f);
@@ -171,15 +241,15 @@ TrapEntity* TrapCannon::getTrapEntity(Tile* tile)
 
 double TrapCannon::getPhysicalDefense() const
 {
-    return ConfigManager::getSingleton().getTrapConfigUInt32("CannonPhyDef");
+    return CANNON_PHY_DEF.get();
 }
 
 double TrapCannon::getMagicalDefense() const
 {
-    return ConfigManager::getSingleton().getTrapConfigUInt32("CannonMagDef");
+    return CANNON_MAG_DEF.get();
 }
 
 double TrapCannon::getElementDefense() const
 {
-    return ConfigManager::getSingleton().getTrapConfigUInt32("CannonEleDef");
+    return CANNON_ELE_DEF.get();
 }
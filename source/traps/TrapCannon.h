@@ -21,8 +21,42 @@
 #include "Trap.h"
 #include "traps/TrapType.h"
 
+#include <vector>
+
+class Creature;
 class ODPacket;
 
+//! \brief Trap tile data caching the tiles the cannon can see from its tile. The cache is
+//! refreshed when the vision version of the area around the tile changes.
+class TrapCannonTileData : public TrapTileData
+{
+public:
+    TrapCannonTileData() :
+        TrapTileData(),
+        mIsVisionComputed(false),
+        mVisionVersion(0)
+    {}
+
+    TrapCannonTileData(const TrapCannonTileData* trapCannonTileData) :
+        TrapTileData(trapCannonTileData),
+        mIsVisionComputed(trapCannonTileData->mIsVisionComputed),
+        mVisionVersion(trapCannonTileData->mVisionVersion),
+        mVisibleTiles(trapCannonTileData->mVisibleTiles)
+    {}
+
+    virtual ~TrapCannonTileData()
+    {}
+
+    virtual TrapCannonTileData* cloneTileData() const override
+    { return new TrapCannonTileData(this); }
+
+    bool mIsVisionComputed;
+    uint32_t mVisionVersion;
+
+    //! \brief Visible tiles within the square of side 2 * range + 1 centered on the trap tile
+    std::vector<bool> mVisibleTiles;
+};
+
 class TrapCannon : public Trap
 {
 public:
@@ -48,8 +82,17 @@ public:
 
     static const TrapType mTrapType;
 
+protected:
+    virtual TrapCannonTileData* createTileData(Tile* tile) override;
+
 private:
     uint32_t mRange;
+
+    //! \brief Targets found during the last shoot. Kept to avoid reallocating it
+    std::vector<Creature*> mTargets;
+
+    //! \brief Fills the vision cache of the given trap tile
+    void computeVision(Tile& tile, TrapCannonTileData& tileData, uint32_t visionVersion) const;
 };
 
 #endif // TRAPCANNON_H
@@ -32,10 +32,13 @@
 #include "network/ODClient.h"
 #include "traps/TrapManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/Random.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> WOODEN_DOOR_COST_PER_TILE(ConfigParamCategory::traps, "WoodenDoorCostPerTile");
+
 const std::string TrapDoorName = "DoorWooden";
 const std::string TrapDoorNameDisplay = "Wooden door";
 const TrapType TrapDoor::mTrapType = TrapType::doorWooden;
@@ -54,7 +57,7 @@ class TrapDoorFactory : public TrapFactory
     { return TrapDoorNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getTrapConfigInt32("WoodenDoorCostPerTile"); }
+    { return WOODEN_DOOR_COST_PER_TILE.get(); }
 
     const std::string& getMeshName() const override
     {
@@ -31,9 +31,15 @@
 #include "traps/Trap.h"
 #include "traps/TrapType.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> CANNON_WORKSHOP_POINTS_PER_TILE(ConfigParamCategory::traps, "CannonWorkshopPointsPerTile");
+static ConfigParam<int32_t> SPIKE_WORKSHOP_POINTS_PER_TILE(ConfigParamCategory::traps, "SpikeWorkshopPointsPerTile");
+static ConfigParam<int32_t> BOULDER_WORKSHOP_POINTS_PER_TILE(ConfigParamCategory::traps, "BoulderWorkshopPointsPerTile");
+static ConfigParam<int32_t> WOODEN_DOOR_POINTS_PER_TILE(ConfigParamCategory::traps, "WoodenDoorPointsPerTile");
+
 static const std::string EMPTY_STRING;
 
 namespace
@@ -784,13 +790,13 @@ int32_t TrapManager::getNeededWorkshopPointsPerTrap(TrapType trapType)
         case TrapType::nullTrapType:
             return 0;
         case TrapType::cannon:
-            return ConfigManager::getSingleton().getTrapConfigInt32("CannonWorkshopPointsPerTile");
+            return CANNON_WORKSHOP_POINTS_PER_TILE.get();
         case TrapType::spike:
-            return ConfigManager::getSingleton().getTrapConfigInt32("SpikeWorkshopPointsPerTile");
+            return SPIKE_WORKSHOP_POINTS_PER_TILE.get();
         case TrapType::boulder:
-            return ConfigManager::getSingleton().getTrapConfigInt32("BoulderWorkshopPointsPerTile");
+            return BOULDER_WORKSHOP_POINTS_PER_TILE.get();
         case TrapType::doorWooden:
-            return ConfigManager::getSingleton().getTrapConfigInt32("WoodenDoorPointsPerTile");
+            return WOODEN_DOOR_POINTS_PER_TILE.get();
         default:
             OD_LOG_ERR("Asked for wrong trap type=" + getTrapNameFromTrapType(trapType));
             break;
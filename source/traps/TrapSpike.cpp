@@ -24,9 +24,16 @@
 #include "gamemap/GameMap.h"
 #include "traps/TrapManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/ConfigParam.h"
 #include "utils/Random.h"
 #include "utils/LogManager.h"
 
+static ConfigParam<int32_t> SPIKE_COST_PER_TILE(ConfigParamCategory::traps, "SpikeCostPerTile");
+static ConfigParam<uint32_t> SPIKE_RELOAD_TURNS(ConfigParamCategory::traps, "SpikeReloadTurns");
+static ConfigParam<double> SPIKE_DAMAGE_PER_HIT_MIN(ConfigParamCategory::traps, "SpikeDamagePerHitMin");
+static ConfigParam<double> SPIKE_DAMAGE_PER_HIT_MAX(ConfigParamCategory::traps, "SpikeDamagePerHitMax");
+static ConfigParam<uint32_t> SPIKE_NB_SHOOTS_BEFORE_DEACTIVATION(ConfigParamCategory::traps, "SpikeNbShootsBeforeDeactivation");
+
 const std::string TrapSpikeName = "Spike";
 const std::string TrapSpikeNameDisplay = "Spike trap";
 const TrapType TrapSpike::mTrapType = TrapType::spike;
@@ -45,7 +52,7 @@ class TrapSpikeFactory : public TrapFactory
     { return TrapSpikeNameDisplay; }
 
     int getCostPerTile() const override
-    { return ConfigManager::getSingleton().getTrapConfigInt32("SpikeCostPerTile"); }
+    { return SPIKE_COST_PER_TILE.get(); }
 
     const std::string& getMeshName() const override
     {
@@ -113,10 +120,10 @@ static TrapRegister reg(new TrapSpikeFactory);
 TrapSpike::TrapSpike(GameMap* gameMap) :
     Trap(gameMap)
 {
-    mReloadTime = ConfigManager::getSingleton().getTrapConfigUInt32("SpikeReloadTurns");
-    mMinDamage = ConfigManager::getSingleton().getTrapConfigDouble("SpikeDamagePerHitMin");
-    mMaxDamage = ConfigManager::getSingleton().getTrapConfigDouble("SpikeDamagePerHitMax");
-    mNbShootsBeforeDeactivation = ConfigManager::getSingleton().getTrapConfigUInt32("SpikeNbShootsBeforeDeactivation");
+    mReloadTime = SPIKE_RELOAD_TURNS.get();
+    mMinDamage = SPIKE_DAMAGE_PER_HIT_MIN.get();
+    mMaxDamage = SPIKE_DAMAGE_PER_HIT_MAX.get();
+    mNbShootsBeforeDeactivation = SPIKE_NB_SHOOTS_BEFORE_DEACTIVATION.get();
     setMeshName("");
 }
 
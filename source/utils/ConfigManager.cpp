@@ -23,6 +23,7 @@
 #include "game/Skill.h"
 #include "gamemap/TileSet.h"
 #include "spawnconditions/SpawnCondition.h"
+#include "utils/ConfigParam.h"
 #include "utils/Helper.h"
 #include "utils/LogManager.h"
 
@@ -58,6 +59,7 @@ ConfigManager::ConfigManager(const std::string& configPath, const std::string& u
     mTimePayDay(300),
     mNbTurnsFuriousMax(120),
     mMaxManaPerSeat(250000.0),
+    mAITurnBudget(5000),
     mClaimingWallPenalty(0.8),
     mDigCoefGold(5.0),
     mDigCoefGem(1.0),
@@ -117,6 +119,10 @@ ConfigManager::ConfigManager(const std::string& configPath, const std::string& u
         OD_LOG_ERR("Couldn't read loadSpellConfig");
         exit(1);
     }
+    if(!resolveConfigParams())
+    {
+        OD_LOG_ERR("Some rooms/traps/spells parameters are missing from the config files");
+    }
     fileName = configPath + mFilenameSkills;
     if(!loadSkills(fileName))
     {
@@ -507,6 +513,13 @@ bool ConfigManager::loadGlobalGameConfig(std::stringstream& configFile)
             // Not mandatory
         }
 
+        if(nextParam == "AITurnBudget")
+        {
+            configFile >> nextParam;
+            mAITurnBudget = Helper::toUInt32(nextParam);
+            // Not mandatory
+        }
+
         if(nextParam == "ClaimingWallPenalty")
         {
             configFile >> nextParam;
@@ -1372,6 +1385,43 @@ const std::string ConfigManager::getUserValue(Config::Ctg category,
     return it->second;
 }
 
+bool ConfigManager::resolveConfigParams()
+{
+    bool isOk = true;
+    for(ConfigParamBase* param : ConfigParamBase::getRegisteredParams())
+    {
+        const std::map<const std::string, std::string>* config = nullptr;
+        switch(param->getCategory())
+        {
+            case ConfigParamCategory::rooms:
+                config = &mRoomsConfig;
+                break;
+            case ConfigParamCategory::traps:
+                config = &mTrapsConfig;
+                break;
+            case ConfigParamCategory::spells:
+                config = &mSpellConfig;
+                break;
+            default:
+                OD_LOG_ERR("Unexpected category for param=" + param->getName());
+                isOk = false;
+                continue;
+        }
+
+        auto it = config->find(param->getName());
+        if(it == config->end())
+        {
+            OD_LOG_ERR("Unknown parameter param=" + param->getName());
+            isOk = false;
+            continue;
+        }
+
+        param->setValue(it->second);
+    }
+
+    return isOk;
+}
+
 const std::string& ConfigManager::getRoomConfigString(const std::string& param) const
 {
     auto it = mRoomsConfig.find(param);
@@ -138,6 +138,10 @@ public:
     inline double getMaxManaPerSeat() const
     { return mMaxManaPerSeat; }
 
+    //! \brief Cost units (see AITask) the AI tasks of every AI can use each turn. 0 means no limit
+    inline uint32_t getAITurnBudget() const
+    { return mAITurnBudget; }
+
     inline double getClaimingWallPenalty() const
     { return mClaimingWallPenalty; }
 
@@ -174,6 +178,8 @@ public:
     { return mFactions; }
 
     //! Rooms configuration
+    //! \note These functions look up and parse the parameter for every call. Code called often
+    //! should declare a static ConfigParam handle instead (see ConfigParam.h)
     const std::string& getRoomConfigString(const std::string& param) const;
     uint32_t getRoomConfigUInt32(const std::string& param) const;
     int32_t getRoomConfigInt32(const std::string& param) const;
@@ -261,6 +267,10 @@ private:
     bool loadTilesets(const std::string& fileName);
     bool loadTilesetValues(std::istream& defFile, TileVisual tileVisual, std::vector<TileSetValue>& tileValues);
 
+    //! \brief Parses the rooms/traps/spells values for every declared ConfigParam handle. Returns
+    //! false if a handle refers to a parameter that is not in the config files
+    bool resolveConfigParams();
+
     //! \brief Loads the user configuration values, and use default ones if it cannot do it.
     void loadUserConfig(const std::string& fileName);
 
@@ -301,6 +311,7 @@ private:
     int64_t mTimePayDay;
     int32_t mNbTurnsFuriousMax;
     double mMaxManaPerSeat;
+    uint32_t mAITurnBudget;
     double mClaimingWallPenalty;
     double mDigCoefGold;
     double mDigCoefGem;
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "utils/ConfigParam.h"
+
+#include "utils/Helper.h"
+
+#include <algorithm>
+
+ConfigParamBase::ConfigParamBase(ConfigParamCategory category, const std::string& name) :
+    mCategory(category),
+    mName(name)
+{
+    getParams().push_back(this);
+}
+
+ConfigParamBase::~ConfigParamBase()
+{
+    std::vector<ConfigParamBase*>& params = getParams();
+    auto it = std::find(params.begin(), params.end(), this);
+    if(it != params.end())
+        params.erase(it);
+}
+
+std::vector<ConfigParamBase*>& ConfigParamBase::getParams()
+{
+    static std::vector<ConfigParamBase*> params;
+    return params;
+}
+
+template<>
+void ConfigParam<uint32_t>::setValue(const std::string& value)
+{
+    mValue = Helper::toUInt32(value);
+}
+
+template<>
+void ConfigParam<int32_t>::setValue(const std::string& value)
+{
+    mValue = Helper::toInt(value);
+}
+
+template<>
+void ConfigParam<double>::setValue(const std::string& value)
+{
+    mValue = Helper::toDouble(value);
+}
+
+template<>
+void ConfigParam<std::string>::setValue(const std::string& value)
+{
+    mValue = value;
+}
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CONFIGPARAM_H
+#define CONFIGPARAM_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//! \brief Config file a parameter is read from
+enum class ConfigParamCategory
+{
+    rooms,
+    traps,
+    spells
+};
+
+//! \brief Base class for the rooms/traps/spells parameters handles. Handles are
+//! meant to be declared as static variables. They register themselves at static
+//! initialization and are resolved once by the ConfigManager when the config files
+//! are loaded. After that, reading a parameter does not cost anything more than
+//! reading a member.
+class ConfigParamBase
+{
+public:
+    ConfigParamBase(ConfigParamCategory category, const std::string& name);
+    virtual ~ConfigParamBase();
+
+    inline ConfigParamCategory getCategory() const
+    { return mCategory; }
+
+    inline const std::string& getName() const
+    { return mName; }
+
+    //! \brief Called by the ConfigManager with the value read from the config file
+    virtual void setValue(const std::string& value) = 0;
+
+    //! \brief Returns all the declared parameters handles
+    static const std::vector<ConfigParamBase*>& getRegisteredParams()
+    { return getParams(); }
+
+private:
+    ConfigParamBase(const ConfigParamBase&) = delete;
+    ConfigParamBase& operator=(const ConfigParamBase&) = delete;
+
+    static std::vector<ConfigParamBase*>& getParams();
+
+    ConfigParamCategory mCategory;
+    std::string mName;
+};
+
+//! \brief Typed handle on a parameter. The value is parsed when the config is loaded.
+//! Only uint32_t, int32_t, double and std::string are supported.
+template<typename T>
+class ConfigParam : public ConfigParamBase
+{
+public:
+    ConfigParam(ConfigParamCategory category, const std::string& name) :
+        ConfigParamBase(category, name),
+        mValue()
+    {}
+
+    inline const T& get() const
+    { return mValue; }
+
+    void setValue(const std::string& value) override;
+
+private:
+    T mValue;
+};
+
+template<> void ConfigParam<uint32_t>::setValue(const std::string& value);
+template<> void ConfigParam<int32_t>::setValue(const std::string& value);
+template<> void ConfigParam<double>::setValue(const std::string& value);
+template<> void ConfigParam<std::string>::setValue(const std::string& value);
+
+#endif // CONFIGPARAM_H
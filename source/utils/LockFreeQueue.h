@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOCKFREEQUEUE_H
+#define LOCKFREEQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+//! \brief Bounded multi-producer/multi-consumer queue that does not use any lock.
+//! Each cell carries a sequence number telling producers and consumers whether
+//! it is ready to be written or read. The capacity is rounded up to the next
+//! power of 2.
+template<typename T>
+class LockFreeQueue
+{
+public:
+    explicit LockFreeQueue(size_t capacity) :
+        mCapacity(roundCapacity(capacity)),
+        mMask(mCapacity - 1),
+        mCells(new Cell[mCapacity]),
+        mEnqueuePos(0),
+        mDequeuePos(0)
+    {
+        for(size_t i = 0; i < mCapacity; ++i)
+            mCells[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+
+    //! \brief Moves the given value in the queue. Returns false if the queue is full.
+    //! In that case, value is not modified.
+    bool tryPush(T& value)
+    {
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while(true)
+        {
+            cell = &mCells[pos & mMask];
+            size_t seq = cell->mSequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if(diff == 0)
+            {
+                if(mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(diff < 0)
+                return false;
+            else
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->mData = std::move(value);
+        cell->mSequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! \brief Moves the first value of the queue in value. Returns false if the queue is empty.
+    bool tryPop(T& value)
+    {
+        size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while(true)
+        {
+            cell = &mCells[pos & mMask];
+            size_t seq = cell->mSequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if(diff == 0)
+            {
+                if(mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(diff < 0)
+                return false;
+            else
+                pos = mDequeuePos.load(std::memory_order_relaxed);
+        }
+
+        value = std::move(cell->mData);
+        cell->mSequence.store(pos + mMask + 1, std::memory_order_release);
+        return true;
+    }
+
+    inline size_t getCapacity() const
+    { return mCapacity; }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> mSequence;
+        T mData;
+    };
+
+    static size_t roundCapacity(size_t capacity)
+    {
+        size_t ret = 2;
+        while(ret < capacity)
+            ret <<= 1;
+
+        return ret;
+    }
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    const size_t mCapacity;
+    const size_t mMask;
+    std::unique_ptr<Cell[]> mCells;
+
+    std::atomic<size_t> mEnqueuePos;
+    std::atomic<size_t> mDequeuePos;
+};
+
+#endif // LOCKFREEQUEUE_H
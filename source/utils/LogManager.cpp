@@ -17,88 +17,156 @@
 
 #include "utils/LogManager.h"
 
-#include <boost/filesystem.hpp>
-
-#include <iomanip>
+#include <chrono>
 
 template<> LogManager* Ogre::Singleton<LogManager>::msSingleton = nullptr;
 
 //! \brief Log filename used when OD Application throws errors without using Ogre default logger.
 const std::string LogManager::GAMELOG_NAME = "gameLog";
 
-LogManager::LogManager()
-    : mLevel(LogMessageLevel::NORMAL)
-{
+//! \brief Number of messages that can be waiting for the writer thread. If the queue gets full,
+//! the logging threads wait for the writer.
+const size_t QUEUE_CAPACITY = 8192;
 
+//! \brief Maximum time the writer thread waits before writing pending messages.
+const int WRITER_INTERVAL_MS = 50;
+
+LogManager::LogManager() :
+    mLevel(LogMessageLevel::NORMAL),
+    mHasModuleLevels(false),
+    mQueue(QUEUE_CAPACITY),
+    mLastTimestampTime(0),
+    mIsRunning(true),
+    mWriterThread(&LogManager::writerThread, this)
+{
 }
 
 LogManager::~LogManager()
 {
+    {
+        std::lock_guard<std::mutex> lock(mWriterWakeLock);
+        mIsRunning.store(false);
+    }
+    mWriterWake.notify_one();
+    mWriterThread.join();
 
+    // We write the messages that may have been logged while the writer was stopping
+    flush();
 }
 
 void LogManager::addSink(std::unique_ptr<LogSink> sink)
 {
+    std::lock_guard<std::mutex> lock(mSinksLock);
     mSinks.push_back(std::move(sink));
 }
 
 void LogManager::setLevel(LogMessageLevel level)
 {
-    mLevel = level;
+    mLevel.store(level);
 }
 
 void LogManager::setModuleLevel(const char* module, LogMessageLevel level)
 {
+    std::lock_guard<std::mutex> lock(mModuleLevelLock);
     mModuleLevel[module] = level;
+    mHasModuleLevels.store(true);
+}
+
+bool LogManager::isModuleLogged(LogMessageLevel level, const char* fileName, uint32_t moduleLength) const
+{
+    std::lock_guard<std::mutex> lock(mModuleLevelLock);
+    auto found = mModuleLevel.find(std::string(fileName, moduleLength));
+    if (found == mModuleLevel.end())
+        return false;
+
+    return found->second <= level;
+}
+
+void LogManager::logMessage(LogMessageLevel level, const char* fileName, uint32_t moduleLength, int line, std::string message)
+{
+    LogEntry entry;
+    entry.mLevel = level;
+    entry.mTime = ::time(0);
+    entry.mFileName = fileName;
+    entry.mModuleLength = moduleLength;
+    entry.mLine = line;
+    entry.mMessage = std::move(message);
+
+    while(!mQueue.tryPush(entry))
+    {
+        // The queue is full. We wake up the writer and wait for it
+        mWriterWake.notify_one();
+        std::this_thread::yield();
+    }
+
+    // Important messages are written as soon as possible
+    if (level >= LogMessageLevel::WARNING)
+        mWriterWake.notify_one();
 }
 
 void LogManager::logMessage(LogMessageLevel level, const char* filepath, int line, const std::string& message)
 {
-    sf::Lock locked(mLock);
+    const char* fileName = LogModule::fileName(filepath);
+    if (!isLogged(level, fileName, LogModule::stemLength(fileName)))
+        return;
 
-    // module
+    logMessage(level, fileName, LogModule::stemLength(fileName), line, message);
+}
+
+void LogManager::flush()
+{
+    writePending();
+}
 
-    const boost::filesystem::path strippedPath(filepath);
-    std::string module = strippedPath.stem().string();
+void LogManager::writerThread()
+{
+    std::unique_lock<std::mutex> lock(mWriterWakeLock);
+    while(mIsRunning.load())
+    {
+        mWriterWake.wait_for(lock, std::chrono::milliseconds(WRITER_INTERVAL_MS));
+
+        lock.unlock();
+        writePending();
+        lock.lock();
+    }
+}
 
-    // Check if the message fails the global threshold.
+uint32_t LogManager::writePending()
+{
+    std::lock_guard<std::mutex> lock(mSinksLock);
 
-    if (mLevel > level)
+    uint32_t nbMessages = 0;
+    LogEntry entry;
+    while(mQueue.tryPop(entry))
     {
-        // Allow per-module overrides of the global logging level.
+        ++nbMessages;
 
-        if (mModuleLevel.empty())
+        // Many messages are logged during the same second. We only format the timestamp
+        // when it changes
+        if (entry.mTime != mLastTimestampTime)
         {
-            return;
+            mLastTimestampTime = entry.mTime;
+            struct tm* now = ::localtime(&entry.mTime);
+            char timestamp[16];
+            std::strftime(timestamp, sizeof(timestamp), "%H:%M:%S", now);
+            mLastTimestamp = timestamp;
         }
 
-        auto found = mModuleLevel.find(module);
-        if (found == mModuleLevel.end() ||
-            found->second > level)
+        std::string module(entry.mFileName, entry.mModuleLength);
+        std::string filename(entry.mFileName);
+        for (const auto& sink : mSinks)
         {
-            return;
+            sink->write(entry.mLevel, module, mLastTimestamp, filename, entry.mLine, entry.mMessage);
         }
     }
 
-    // filename
-
-    std::string filename = strippedPath.filename().string();
-
-    // timestamp
-
-    time_t current_time = ::time(0);
-    struct tm* now = ::localtime(&current_time);
-
-    mTimestampStream.str("");
-    mTimestampStream
-        << std::setfill('0') << std::setw(2) << now->tm_hour << ':'
-        << std::setfill('0') << std::setw(2) << now->tm_min << ':'
-        << std::setfill('0') << std::setw(2) << now->tm_sec;
-
-    std::string timestamp = mTimestampStream.str();
+    if (nbMessages == 0)
+        return 0;
 
     for (const auto& sink : mSinks)
     {
-        sink->write(level, module, timestamp, filename, line, message);
+        sink->flush();
     }
+
+    return nbMessages;
 }
@@ -18,26 +18,77 @@
 #ifndef LOGMANAGER_H
 #define LOGMANAGER_H
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
-
-#include <SFML/System.hpp>
+#include <thread>
+#include <vector>
 
 #include <OgreSingleton.h>
 
 #include "utils/Helper.h"
+#include "utils/LockFreeQueue.h"
 #include "utils/LogMessageLevel.h"
 #include "utils/LogSink.h"
 
-#define OD_LOG_ERR(_message)                      LogManager::getSingleton().logMessage(LogMessageLevel::CRITICAL, __FILE__, __LINE__, (std::string("") + _message))
-#define OD_LOG_WRN(_message)                      LogManager::getSingleton().logMessage(LogMessageLevel::WARNING, __FILE__, __LINE__, (std::string("") + _message))
-#define OD_LOG_INF(_message)                      LogManager::getSingleton().logMessage(LogMessageLevel::NORMAL, __FILE__, __LINE__, (std::string("") + _message))
-#define OD_LOG_DBG(_message)                      LogManager::getSingleton().logMessage(LogMessageLevel::TRIVIAL, __FILE__, __LINE__, (std::string("") + _message))
+// MSVC 2013 does not support constexpr. In that case, the module is computed
+// once per call site when it is first reached.
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define OD_LOG_CONSTEXPR
+#else
+#define OD_LOG_CONSTEXPR constexpr
+#endif
+
+//! \brief Helper functions allowing to compute the module (the source file name without
+//! path nor extension) from __FILE__ at compile time.
+namespace LogModule
+{
+    OD_LOG_CONSTEXPR inline const char* fileName(const char* path, const char* last)
+    {
+        return (*path == '\0') ? last : fileName(path + 1, ((*path == '/') || (*path == '\\')) ? path + 1 : last);
+    }
+
+    //! \brief Returns a pointer on the file name part of the given path
+    OD_LOG_CONSTEXPR inline const char* fileName(const char* path)
+    {
+        return fileName(path, path);
+    }
+
+    //! \brief Returns the length of the given file name without its extension
+    OD_LOG_CONSTEXPR inline uint32_t stemLength(const char* name, uint32_t length = 0)
+    {
+        return ((name[length] == '\0') || (name[length] == '.')) ? length : stemLength(name, length + 1);
+    }
+}
 
-#define OD_ASSERT_TRUE(_condition)                if (!(_condition)) LogManager::getSingleton().logMessage(LogMessageLevel::CRITICAL, __FILE__, __LINE__, std::string(#_condition))
-#define OD_ASSERT_TRUE_MSG(_condition, _message)  if (!(_condition)) LogManager::getSingleton().logMessage(LogMessageLevel::CRITICAL, __FILE__, __LINE__, (std::string("") + _message))
+//! \brief The level (and the module level if any) is checked before the message is built.
+//! That way, messages filtered out do not cost anything more than a few comparisons.
+#define OD_LOG_LEVEL(_level, _message) \
+    do \
+    { \
+        static const char* const odLogFile = LogModule::fileName(__FILE__); \
+        static const uint32_t odLogModuleLength = LogModule::stemLength(odLogFile); \
+        LogManager& odLogMgr = LogManager::getSingleton(); \
+        if (odLogMgr.isLogged(_level, odLogFile, odLogModuleLength)) \
+            odLogMgr.logMessage(_level, odLogFile, odLogModuleLength, __LINE__, (std::string("") + _message)); \
+    } while(0)
 
-//! \brief Helper/wrapper class to provide thread-safe logging when ogre is compiled without threads.
+#define OD_LOG_ERR(_message)                      OD_LOG_LEVEL(LogMessageLevel::CRITICAL, _message)
+#define OD_LOG_WRN(_message)                      OD_LOG_LEVEL(LogMessageLevel::WARNING, _message)
+#define OD_LOG_INF(_message)                      OD_LOG_LEVEL(LogMessageLevel::NORMAL, _message)
+#define OD_LOG_DBG(_message)                      OD_LOG_LEVEL(LogMessageLevel::TRIVIAL, _message)
+
+#define OD_ASSERT_TRUE(_condition)                if (!(_condition)) OD_LOG_LEVEL(LogMessageLevel::CRITICAL, std::string(#_condition))
+#define OD_ASSERT_TRUE_MSG(_condition, _message)  if (!(_condition)) OD_LOG_LEVEL(LogMessageLevel::CRITICAL, _message)
+
+//! \brief Thread-safe logging. Messages are pushed in a lock-free queue by the logging
+//! threads and written to the sinks by a dedicated writer thread. Sinks are flushed
+//! once per batch of messages instead of once per message.
 class LogManager : public Ogre::Singleton<LogManager>
 {
 public:
@@ -53,19 +104,73 @@ public:
     //! \brief Set the minimum logging level per module.
     void setModuleLevel(const char* module, LogMessageLevel level);
 
-    //! \brief Log a message to the sinks.
+    //! \brief Returns true if a message with the given level from the given module should be
+    //! logged. The module is given by the first moduleLength characters of fileName.
+    inline bool isLogged(LogMessageLevel level, const char* fileName, uint32_t moduleLength) const
+    {
+        if (level >= mLevel.load(std::memory_order_relaxed))
+            return true;
+
+        // Allow per-module overrides of the global logging level.
+        if (!mHasModuleLevels.load(std::memory_order_relaxed))
+            return false;
+
+        return isModuleLogged(level, fileName, moduleLength);
+    }
+
+    //! \brief Queues a message for the sinks. fileName is expected to be a part of __FILE__
+    //! so that it is valid until the message is written. Note that this function does not
+    //! check the level. That should be done with isLogged before building the message.
+    void logMessage(LogMessageLevel level, const char* fileName, uint32_t moduleLength, int line, std::string message);
+
+    //! \brief Convenience function for logging from places where the OD_LOG macros cannot be
+    //! used. filepath is expected to be __FILE__.
     void logMessage(LogMessageLevel level, const char* filepath, int line, const std::string& message);
 
+    //! \brief Writes the pending messages to the sinks from the calling thread and flushes
+    //! them. Useful when the application is about to crash.
+    void flush();
+
     static const std::string GAMELOG_NAME;
 private:
+    //! \brief A queued log message. The timestamp is formatted by the writer thread.
+    struct LogEntry
+    {
+        LogMessageLevel mLevel;
+        std::time_t mTime;
+        const char* mFileName;
+        uint32_t mModuleLength;
+        int mLine;
+        std::string mMessage;
+    };
+
     LogManager(const LogManager&) = delete;
     LogManager& operator=(const LogManager&) = delete;
 
-    LogMessageLevel mLevel;
+    bool isModuleLogged(LogMessageLevel level, const char* fileName, uint32_t moduleLength) const;
+
+    void writerThread();
+
+    //! \brief Writes the queued messages to the sinks. Returns the number of written messages.
+    uint32_t writePending();
+
+    std::atomic<LogMessageLevel> mLevel;
+    std::atomic<bool> mHasModuleLevels;
     std::map<std::string, LogMessageLevel> mModuleLevel;
-    sf::Mutex mLock;
+    mutable std::mutex mModuleLevelLock;
+
+    LockFreeQueue<LogEntry> mQueue;
+
+    //! \brief Protects the sinks. Only taken by the thread writing to the sinks.
+    std::mutex mSinksLock;
     std::vector<std::unique_ptr<LogSink>> mSinks;
-    std::stringstream mTimestampStream;
+    std::time_t mLastTimestampTime;
+    std::string mLastTimestamp;
+
+    std::atomic<bool> mIsRunning;
+    std::mutex mWriterWakeLock;
+    std::condition_variable mWriterWake;
+    std::thread mWriterThread;
 };
 
 #endif // LOGMANAGER_H
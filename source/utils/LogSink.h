@@ -29,6 +29,9 @@ public:
     virtual ~LogSink() { }
 
     virtual void write(LogMessageLevel level, const std::string& module, const std::string& timestamp, const std::string& filename, int line, const std::string& message) = 0;
+
+    //! \brief Called after a batch of messages have been written.
+    virtual void flush() { }
 };
 
 #endif // _LOGSINK_H_
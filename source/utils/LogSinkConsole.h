@@ -27,6 +27,7 @@ public:
     ~LogSinkConsole();
 
     virtual void write(LogMessageLevel level, const std::string& module, const std::string& timestamp, const std::string& filename, int line, const std::string& message) override;
+    virtual void flush() override;
 };
 
 #endif // _LOGSINKCONSOLE_H_
@@ -47,7 +47,13 @@ void LogSinkFile::write(LogMessageLevel level, const std::string& module, const
 
     mFile
         << message
-        << std::endl;
+        << '\n';
+}
+
+void LogSinkFile::flush()
+{
+    if (!mFile.is_open())
+        return;
 
     mFile.flush();
 }
@@ -29,6 +29,7 @@ public:
     ~LogSinkFile();
 
     virtual void write(LogMessageLevel level, const std::string& module, const std::string& timestamp, const std::string& filename, int line, const std::string& message) override;
+    virtual void flush() override;
 private:
     std::ofstream mFile;
 };
@@ -28,6 +28,10 @@ namespace Random
     //! \brief initializes the semaphore and seeds the generator
     void initialize();
 
+    //! \brief seeds the generator with the given value. Used to get the same random
+    //! numbers in 2 runs of the same game
+    void initialize(unsigned long seed);
+
     /*! \brief generate a random double
      *
      *  \param min, max One or both can be negative
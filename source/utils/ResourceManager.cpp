@@ -68,6 +68,7 @@ const std::string ResourceManager::CONFIGSUBPATH = "config/";
 const std::string ResourceManager::SCRIPTSUBPATH = "scripts/";
 const std::string ResourceManager::LANGUAGESUBPATH = "lang/";
 const std::string ResourceManager::SHADERCACHESUBPATH = "shaderCache/";
+const std::string ResourceManager::LEVELCACHESUBPATH = "levelCache/";
 const std::string ResourceManager::LOGFILENAME = "opendungeons.log";
 const std::string ResourceManager::CEGUILOGFILENAME = "CEGUI.log";
 const std::string ResourceManager::USERCFGFILENAME = "config.cfg";
@@ -86,9 +87,12 @@ ResourceManager::ResourceManager(boost::program_options::variables_map& options)
         mServerMode(false),
         mForcedNetworkPort(-1),
         mLogLevel(LogMessageLevel::NORMAL),
+        mAutosavePeriodSeconds(0),
+        mRandomSeed(-1),
         mGameDataPath("./"),
         mUserDataPath("./"),
-        mUserConfigPath("./")
+        mUserConfigPath("./"),
+        mLevelCacheEnabled(true)
 {
     setupDataPath(options);
     setupUserDataFolders(options);
@@ -345,6 +349,21 @@ void ResourceManager::setupUserDataFolders(boost::program_options::variables_map
         exit(1);
     }
 
+    mLevelCachePath = mUserDataPath + LEVELCACHESUBPATH;
+    try
+    {
+      boost::filesystem::create_directories(mLevelCachePath);
+    }
+    catch (const boost::filesystem::filesystem_error& e)
+    {
+        // The compiled levels are only an optimization. We can work without them
+        std::cerr << "Error creating level cache folder: " << e.what() <<  std::endl;
+        mLevelCacheEnabled = false;
+    }
+
+    if(options.count("nolevelcache") > 0)
+        mLevelCacheEnabled = false;
+
     itOption = options.find("log");
     if(itOption != options.end())
     {
@@ -433,6 +452,24 @@ void ResourceManager::setupUserDataFolders(boost::program_options::variables_map
     if(itOption != options.end())
         mLogLevel = static_cast<LogMessageLevel>(itOption->second.as<int32_t>());
 
+    itOption = options.find("autosave");
+    if(itOption != options.end())
+    {
+        int32_t period = itOption->second.as<int32_t>();
+        mAutosavePeriodSeconds = (period > 0) ? period : 0;
+    }
+
+    itOption = options.find("seed");
+    if(itOption != options.end())
+    {
+        int32_t seed = itOption->second.as<int32_t>();
+        mRandomSeed = (seed >= 0) ? seed : -1;
+    }
+
+    itOption = options.find("statehashtrace");
+    if(itOption != options.end())
+        mStateHashTraceFile = mUserDataPath + itOption->second.as<std::string>();
+
     mUserConfigFile = mUserConfigPath + USERCFGFILENAME;
     mCeguiLogFile = mUserDataPath + CEGUILOGFILENAME;
     mShaderCachePath = mUserDataPath + SHADERCACHESUBPATH;
@@ -578,6 +615,10 @@ void ResourceManager::buildCommandOptions(boost::program_options::options_descri
         ("mscreator", boost::program_options::value<std::string>(), "Sets the creator for this map to connect to the master server. server/servercustom/serversave option needs to be on")
         ("port", boost::program_options::value<int32_t>(), "Sets the port used. Note that the port is used for both single and multi player")
         ("loglevel", boost::program_options::value<int32_t>(), "Sets the log level (between 0=Trivial and 3=Critical)")
+        ("autosave", boost::program_options::value<int32_t>(), "Saves the game every given number of seconds (0 to disable)")
+        ("seed", boost::program_options::value<int32_t>(), "Seeds the random generator with the given value (>= 0) instead of the current time. The server then uses a fixed turn length")
+        ("statehashtrace", boost::program_options::value<std::string>(), "In server mode, writes the hash of the game state of each turn in the given file. The server then uses a fixed turn length")
+        ("nolevelcache", "Disables the compiled levels cache (levels are always parsed from the text files)")
     ;
 }
 
@@ -151,6 +151,25 @@ public:
     inline LogMessageLevel getLogLevel() const
     { return mLogLevel; }
 
+    //! \brief Time between 2 automatic saves of the game. 0 if autosave is disabled
+    inline int32_t getAutosavePeriodSeconds() const
+    { return mAutosavePeriodSeconds; }
+
+    //! \brief Seed forced for the random generator (--seed). -1 if the seed should be taken from the time
+    inline int32_t getRandomSeed() const
+    { return mRandomSeed; }
+
+    //! \brief File where the server writes the state hash of each turn (--statehashtrace). Empty if disabled
+    inline const std::string& getStateHashTraceFile() const
+    { return mStateHashTraceFile; }
+
+    //! \brief Folder where the compiled levels are stored
+    inline const std::string& getLevelCachePath() const
+    { return mLevelCachePath; }
+
+    inline bool isLevelCacheEnabled() const
+    { return mLevelCacheEnabled; }
+
 private:
     //! \brief used when the executable is launched in server mode
     bool mServerMode;
@@ -163,6 +182,15 @@ private:
     //! \brief The log level
     LogMessageLevel mLogLevel;
 
+    //! \brief Autosave period (--autosave). 0 if disabled
+    int32_t mAutosavePeriodSeconds;
+
+    //! \brief Random seed (--seed). -1 if not forced
+    int32_t mRandomSeed;
+
+    //! \brief State hash trace file (--statehashtrace). Empty if disabled
+    std::string mStateHashTraceFile;
+
     //! \brief The application data path
     //! \example "/usr/share/game/opendungeons" on linux
     //! \example "C:/opendungeons" on windows
@@ -198,6 +226,10 @@ private:
     std::string mSaveGamePath;
     std::string mUserSkirmishLevelsPath;
     std::string mUserMultiplayerLevelsPath;
+    std::string mLevelCachePath;
+
+    //! \brief false if the compiled levels should not be used (--nolevelcache)
+    bool mLevelCacheEnabled;
 
     static const std::string PLUGINSCFG;
     static const std::string RESOURCECFG;
@@ -207,6 +239,7 @@ private:
     static const std::string CONFIGSUBPATH;
     static const std::string LANGUAGESUBPATH;
     static const std::string SHADERCACHESUBPATH;
+    static const std::string LEVELCACHESUBPATH;
     static const std::string LOGFILENAME;
     static const std::string CEGUILOGFILENAME;
     static const std::string USERCFGFILENAME;
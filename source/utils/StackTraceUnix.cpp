@@ -196,6 +196,9 @@ void StackTracePrintPrivateData::critErrHandler(int sig_num, siginfo_t* info, vo
 
             logMgr->logMessage(LogMessageLevel::CRITICAL, __FILE__, __LINE__, log);
         }
+
+        // We are about to crash. We cannot wait for the writer thread
+        logMgr->flush();
     }
 
     // Set the stream at beginning
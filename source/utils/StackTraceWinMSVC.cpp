@@ -185,6 +185,9 @@ LONG WINAPI StackTracePrintPrivateData::exceptionFilter(LPEXCEPTION_POINTERS inf
 
             logMgr->logMessage(LogMessageLevel::CRITICAL, __FILE__, __LINE__, log);
         }
+
+        // We are about to crash. We cannot wait for the writer thread
+        logMgr->flush();
     }
 
     // Set the stream at beginning
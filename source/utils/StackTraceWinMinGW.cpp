@@ -313,6 +313,9 @@ LONG WINAPI StackTracePrintPrivateData::exceptionFilter(LPEXCEPTION_POINTERS inf
 
             logMgr->logMessage(LogMessageLevel::CRITICAL, __FILE__, __LINE__, log);
         }
+
+        // We are about to crash. We cannot wait for the writer thread
+        logMgr->flush();
     }
 
     // Set the stream at beginning
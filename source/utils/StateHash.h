@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2011-2016  OpenDungeons Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef STATEHASH_H
+#define STATEHASH_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+//! \brief Small FNV-1a hash used to compute a fingerprint of the game state. It is not
+//! meant to be secure, only to be cheap and to give the same value for the same data
+//! whatever the platform. Doubles are hashed from their bits, so 2 values that differ
+//! only in the last decimal give different hashes.
+class StateHash
+{
+public:
+    StateHash() :
+        mValue(OFFSET_BASIS)
+    {}
+
+    inline void add(uint32_t value)
+    {
+        for(uint32_t i = 0; i < 4; ++i)
+        {
+            addByte(static_cast<uint8_t>(value & 0xFF));
+            value >>= 8;
+        }
+    }
+
+    inline void add(int32_t value)
+    { add(static_cast<uint32_t>(value)); }
+
+    inline void add(uint64_t value)
+    {
+        add(static_cast<uint32_t>(value & 0xFFFFFFFF));
+        add(static_cast<uint32_t>(value >> 32));
+    }
+
+    inline void add(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        add(bits);
+    }
+
+    inline void add(const std::string& value)
+    {
+        add(static_cast<uint32_t>(value.size()));
+        for(char c : value)
+            addByte(static_cast<uint8_t>(c));
+    }
+
+    inline uint64_t getValue() const
+    { return mValue; }
+
+private:
+    static const uint64_t OFFSET_BASIS = 14695981039346656037ULL;
+    static const uint64_t PRIME = 1099511628211ULL;
+
+    inline void addByte(uint8_t byte)
+    {
+        mValue ^= byte;
+        mValue *= PRIME;
+    }
+
+    uint64_t mValue;
+};
+
+#endif // STATEHASH_H